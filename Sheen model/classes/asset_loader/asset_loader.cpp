@@ -0,0 +1,226 @@
+/**
+ * @file asset_loader.cpp
+ * @brief Asset loader class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "asset_loader.h"
+
+#include <sys/stat.h>
+
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GL/glew.h"
+
+#include "classes/loader_assimp/loader_assimp.h"
+#include "classes/object/object.h"
+#include "classes/texture/texture.h"
+#include "classes/thread_pool/thread_pool.h"
+#include "structs/image/image.h"
+
+namespace bgq_opengl {
+
+	namespace {
+
+		/**
+		 * Gets the size of a file, or 0 if it cannot be read.
+		 */
+		off_t fileSize(const std::string& filename) {
+
+			struct stat info;
+
+			if (stat(filename.c_str(), &info) != 0)
+				return 0;
+
+			return info.st_size;
+
+		}
+
+		/**
+		 * Gets the milliseconds since a time.
+		 */
+		double millisecondsSince(std::chrono::steady_clock::time_point start) {
+
+			return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		}
+
+	}  // namespace
+
+	AssetLoader::AssetLoader(int threads, VertexFormat format, bool keep_vertices, bool upload) {
+
+		if (threads <= 0)
+			threads = std::max(1, (int) std::thread::hardware_concurrency());
+
+		this->threads = threads;
+		this->format = format;
+		this->keep_vertices = keep_vertices;
+		this->upload = upload;
+
+	}
+
+	int AssetLoader::addModel(const char* filename) {
+
+		std::unique_ptr<Asset> asset(new Asset());
+		asset->filename = std::string(filename);
+		asset->size = fileSize(asset->filename);
+		asset->model = true;
+		asset->format = this->format;
+		asset->keep_vertices = this->keep_vertices;
+		asset->upload = this->upload;
+		asset->index = 0;
+
+		// Number the models in the order they are added.
+		for (size_t i = 0; i < this->assets.size(); i++)
+			if (this->assets[i]->model)
+				asset->index++;
+
+		this->assets.push_back(std::move(asset));
+
+		return this->assets.back()->index;
+
+	}
+
+	int AssetLoader::addTexture(const char* filename, const char* name, GLuint slot, GLint param1, GLint param2) {
+
+		std::unique_ptr<Asset> asset(new Asset());
+		asset->filename = std::string(filename);
+		asset->size = fileSize(asset->filename);
+		asset->name = std::string(name);
+		asset->slot = slot;
+		asset->param1 = param1;
+		asset->param2 = param2;
+		asset->index = (int) this->images.size();
+
+		this->images.push_back((int) this->assets.size());
+		this->assets.push_back(std::move(asset));
+
+		return this->assets.back()->index;
+
+	}
+
+	const Image& AssetLoader::getImage(int num) {
+
+		return this->assets[this->images[num]]->image;
+
+	}
+
+	Object& AssetLoader::getObject(int num) {
+
+		return this->objects[num];
+
+	}
+
+	Texture& AssetLoader::getTexture(int num) {
+
+		return this->textures[num];
+
+	}
+
+	void AssetLoader::load() {
+
+		auto start = std::chrono::steady_clock::now();
+
+		// Start the largest files first, so a big model is not left alone at the end.
+		std::vector<Asset*> order;
+
+		for (size_t i = 0; i < this->assets.size(); i++)
+			order.push_back(this->assets[i].get());
+
+		std::stable_sort(order.begin(), order.end(), [](const Asset* a, const Asset* b) {
+			return a->size > b->size;
+		});
+
+		// Decode and import everything on the threads. Nothing here touches OpenGL.
+		int threads = std::max(1, std::min(this->threads, (int) order.size()));
+		ThreadPool pool(threads);
+
+		pool.run((int) order.size(), [&order](int task, int /*thread*/) {
+			AssetLoader::import(*order[task]);
+		});
+
+		double import_time = millisecondsSince(start);
+
+		// Upload them on this thread, which owns the context, in the order they were added.
+		for (size_t i = 0; i < this->assets.size(); i++) {
+
+			Asset& asset = *this->assets[i];
+			auto upload_start = std::chrono::steady_clock::now();
+
+			if (asset.model) {
+
+				this->objects.push_back(Object(asset.loader.get()));
+				asset.loader.reset();
+
+			} else {
+
+				if (!asset.decoded) {
+
+					std::cerr << "Asset loader error: could not load " << asset.filename << "." << std::endl;
+					exit(1);
+
+				}
+
+				// Without OpenGL only the decoded image is kept.
+				if (this->upload)
+					this->textures.push_back(Texture(asset.image, asset.name.c_str(), asset.slot, asset.param1, asset.param2));
+
+			}
+
+			asset.upload_ms = millisecondsSince(upload_start);
+
+		}
+
+		// Report how long every asset took.
+		double total = millisecondsSince(start);
+		double work = 0.0;
+
+		for (size_t i = 0; i < this->assets.size(); i++)
+			work += this->assets[i]->import_ms;
+
+		std::cerr << std::fixed << std::setprecision(1);
+		std::cerr << "Loaded " << this->assets.size() << " assets in " << total << " ms on " << threads << " threads: " << import_time << " ms importing (" << work << " ms of work), " << total - import_time << " ms uploading." << std::endl;
+
+		for (size_t i = 0; i < this->assets.size(); i++)
+			std::cerr << "  " << this->assets[i]->filename << ": " << this->assets[i]->import_ms << " ms " << (this->assets[i]->model ? "importing" : "decoding") << ", " << this->assets[i]->upload_ms << " ms uploading" << std::endl;
+
+		std::cerr << std::defaultfloat << std::setprecision(6);
+
+	}
+
+	void AssetLoader::import(Asset& asset) {
+
+		auto start = std::chrono::steady_clock::now();
+
+		if (asset.model) {
+
+			asset.loader.reset(new LoaderAssimp(asset.filename.c_str(), asset.format, asset.keep_vertices, asset.upload));
+			asset.loader->importModel();
+
+		} else {
+
+			asset.decoded = Texture::loadImage(asset.filename.c_str(), &asset.image);
+
+		}
+
+		asset.import_ms = millisecondsSince(start);
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,179 @@
+/**
+ * @file asset_loader.h
+ * @brief Asset loader class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_ASSET_LOADER_H_
+#define BGQ_OPENGL_CLASSES_ASSET_LOADER_H_
+
+#include <sys/types.h>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+
+#include "classes/loader_assimp/loader_assimp.h"
+#include "classes/object/object.h"
+#include "classes/texture/texture.h"
+#include "structs/image/image.h"
+#include "structs/packed_vertex/packed_vertex.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implements a parallel loader of models and textures.
+	 *
+	 * Implements a loader that decodes the images and imports the models of
+	 * a scene on a ThreadPool, then uploads them one by one on the thread
+	 * that owns the OpenGL context, timing every asset.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class AssetLoader {
+
+		public:
+
+			/**
+			 * @brief Builds an asset loader.
+			 *
+			 * Builds an asset loader with nothing to load.
+			 *
+			 * @param threads Threads decoding and importing, 0 to use all the cores.
+			 * @param format Layout the vertices of the models are uploaded in.
+			 * @param keep_vertices Whether the models keep a CPU copy of their vertices.
+			 * @param upload Whether to upload the assets, else only the CPU copies are kept and no OpenGL context is needed.
+			 */
+			AssetLoader(int threads, VertexFormat format = VERTEX_FORMAT_FULL, bool keep_vertices = true, bool upload = true);
+
+			/**
+			 * @brief Adds a model.
+			 *
+			 * Adds a model to load with Assimp.
+			 *
+			 * @param filename The model file.
+			 *
+			 * @returns The number of the model, for getObject.
+			 */
+			int addModel(const char* filename);
+
+			/**
+			 * @brief Adds a texture.
+			 *
+			 * Adds an image to load as a texture.
+			 *
+			 * @param filename The image file.
+			 * @param name Texture name in the shader.
+			 * @param slot Texture slot.
+			 * @param param1 GL_TEXTURE_MIN_FILTER parameter.
+			 * @param param2 GL_TEXTURE_MAG_FILTER parameter.
+			 *
+			 * @returns The number of the texture, for getTexture and getImage.
+			 */
+			int addTexture(const char* filename, const char* name, GLuint slot, GLint param1, GLint param2);
+
+			/**
+			 * @brief Get a loaded image.
+			 *
+			 * Get the decoded pixels of a texture, kept after uploading it.
+			 *
+			 * @param num The number of the texture.
+			 *
+			 * @returns The image.
+			 */
+			const Image& getImage(int num);
+
+			/**
+			 * @brief Get a loaded model.
+			 *
+			 * Get the object a model was loaded into.
+			 *
+			 * @param num The number of the model.
+			 *
+			 * @returns The object.
+			 */
+			Object& getObject(int num);
+
+			/**
+			 * @brief Get a loaded texture.
+			 *
+			 * Get a texture, already in OpenGL. There are none if the assets
+			 * are not uploaded.
+			 *
+			 * @param num The number of the texture.
+			 *
+			 * @returns The texture.
+			 */
+			Texture& getTexture(int num);
+
+			/**
+			 * @brief Loads everything.
+			 *
+			 * Decodes the images and imports the models on the threads, the
+			 * largest files first, then uploads them on this thread in the
+			 * order they were added and prints how long each took.
+			 */
+			void load();
+
+		private:
+
+			/**
+			 * @brief A file to load.
+			 *
+			 * A model or image file, and what it was loaded into.
+			 */
+			struct Asset {
+
+				std::string filename;					/// The file.
+				off_t size = 0;							/// Bytes of the file.
+				bool model = false;						/// Whether it is a model, else an image.
+				std::string name;						/// Texture name in the shader.
+				GLuint slot = 0;						/// Texture slot.
+				GLint param1 = 0;						/// GL_TEXTURE_MIN_FILTER parameter.
+				GLint param2 = 0;						/// GL_TEXTURE_MAG_FILTER parameter.
+				int index = 0;							/// Number of the object or texture.
+				VertexFormat format = VERTEX_FORMAT_FULL;	/// Layout the vertices of the model are uploaded in.
+				bool keep_vertices = true;				/// Whether the model keeps a CPU copy of its vertices.
+				bool upload = true;						/// Whether the model is uploaded.
+				std::unique_ptr<LoaderAssimp> loader;	/// Loader of the model.
+				Image image;							/// Decoded image.
+				bool decoded = false;					/// Whether the image could be decoded.
+				double import_ms = 0.0;					/// Time decoding or importing, on a worker.
+				double upload_ms = 0.0;					/// Time uploading, on this thread.
+
+			};
+
+			/**
+			 * @brief Decodes or imports one asset.
+			 *
+			 * Decodes or imports one asset. It does not touch OpenGL.
+			 *
+			 * @param asset The asset.
+			 */
+			static void import(Asset& asset);
+
+			std::vector<std::unique_ptr<Asset>> assets;		/// Files to load, in the order they were added.
+			std::vector<Object> objects;					/// Loaded models.
+			std::vector<Texture> textures;					/// Loaded textures.
+			std::vector<int> images;						/// Asset of every texture.
+			int threads;									/// Threads decoding and importing.
+			VertexFormat format;							/// Layout the vertices of the models are uploaded in.
+			bool keep_vertices;								/// Whether the models keep a CPU copy of their vertices.
+			bool upload;									/// Whether the assets are uploaded.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_ASSET_LOADER_H_
@@ -22,6 +22,8 @@
 #include "glm/gtc/matrix_transform.hpp"
 #include "glm/gtc/type_ptr.hpp"
 
+#include "structs/frustum/frustum.h"
+
 namespace bgq_opengl {
 
 	Camera::Camera(glm::vec3 position, glm::vec3 direction, float fov, float near, float far, int width, int height) {
@@ -52,6 +54,31 @@ namespace bgq_opengl {
 
 	}
 
+	Frustum Camera::getFrustum() {
+
+		// Every plane is the last row of the camera matrix plus or minus one of the others.
+		glm::mat4 matrix = this->getCameraMatrix();
+		glm::vec4 rows[4];
+
+		for (int i = 0; i < 4; i++)
+			rows[i] = glm::vec4(matrix[0][i], matrix[1][i], matrix[2][i], matrix[3][i]);
+
+		Frustum frustum;
+		frustum.planes[0] = rows[3] + rows[0];
+		frustum.planes[1] = rows[3] - rows[0];
+		frustum.planes[2] = rows[3] + rows[1];
+		frustum.planes[3] = rows[3] - rows[1];
+		frustum.planes[4] = rows[3] + rows[2];
+		frustum.planes[5] = rows[3] - rows[2];
+
+		// Normalize them, so they give distances.
+		for (int i = 0; i < 6; i++)
+			frustum.planes[i] /= glm::length(glm::vec3(frustum.planes[i]));
+
+		return frustum;
+
+	}
+
 	glm::vec3 Camera::getPosition() {
 
         return glm::vec3(transforms * glm::vec4(this->position, 1.0));
@@ -90,6 +117,15 @@ namespace bgq_opengl {
         
     }
 
+    void Camera::setPose(glm::vec3 position, glm::vec3 target) {
+        
+        this->position = position;
+        this->direction = glm::normalize(target - position);
+        this->up = glm::vec3(0.0f, 1.0f, 0.0f);
+        this->transforms = glm::mat4(1.0f);
+        
+    }
+
     void Camera::setHeight(int new_height) {
         
         this->window_height = new_height;
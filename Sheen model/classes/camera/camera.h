@@ -18,6 +18,8 @@
 
 #include "glm/glm.hpp"
 
+#include "structs/frustum/frustum.h"
+
 namespace bgq_opengl {
 
 	/**
@@ -61,6 +63,16 @@ namespace bgq_opengl {
 			 */
 			glm::vec3 getDirection();
 
+			/**
+			 * @brief Get the view frustum.
+			 *
+			 * Get the planes of the view frustum in world space, from the
+			 * camera matrix.
+			 *
+			 * @returns The frustum, with the normals pointing inside.
+			 */
+			Frustum getFrustum();
+
 			/**
 			 * @brief Get the camera position.
 			 *
@@ -103,6 +115,17 @@ namespace bgq_opengl {
              */
             void setHeight(int new_height);
 
+            /**
+             * @brief Place the camera.
+             *
+             * Move the camera to a position, looking at a point, and drop
+             * the transforms applied so far.
+             *
+             * @param position The camera coordinates.
+             * @param target The point the camera looks at.
+             */
+            void setPose(glm::vec3 position, glm::vec3 target);
+
 			/**
 			 * @brief Move tha camera backwards.
 			 * 
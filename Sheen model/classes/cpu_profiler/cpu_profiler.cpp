@@ -0,0 +1,267 @@
+/**
+ * @file cpu_profiler.cpp
+ * @brief CPU profiler class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "cpu_profiler.h"
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "classes/json/json.h"
+
+namespace bgq_opengl {
+
+	namespace {
+
+		/**
+		 * A zone, as recorded.
+		 */
+		struct Event {
+
+			const char* name;		/// Name of the zone.
+			uint64_t start;			/// When it opened, in nanoseconds.
+			uint64_t end;			/// When it closed, in nanoseconds.
+			int thread;				/// Thread that recorded it, once flushed.
+
+		};
+
+		/**
+		 * The ring of a thread.
+		 */
+		struct Ring {
+
+			Event events[CPU_PROFILER_RING_SIZE];	/// The zones, written by the thread only.
+			std::atomic<uint64_t> head;				/// Zones written so far, published after each one.
+			uint64_t tail = 0;						/// Zones flushed so far, only read by the flusher.
+			int thread = 0;							/// Index of the thread in the trace.
+			std::string name;						/// Name of the thread in the trace.
+
+		};
+
+		// The rings outlive their threads, so that what they recorded is still flushed.
+		std::mutex rings_mutex;
+		std::vector<std::unique_ptr<Ring>> rings;
+
+		// What was flushed, in the order it was flushed.
+		std::vector<Event> flushed;
+		std::atomic<size_t> dropped(0);
+
+		std::atomic<bool> recording(false);
+		const std::chrono::steady_clock::time_point epoch = std::chrono::steady_clock::now();
+
+		thread_local Ring* ring = nullptr;
+		thread_local std::string thread_name;
+
+		/**
+		 * Gets the ring of the calling thread, creating it on its first zone.
+		 */
+		Ring* getRing() {
+
+			if (ring != nullptr)
+				return ring;
+
+			std::lock_guard<std::mutex> lock(rings_mutex);
+
+			rings.push_back(std::unique_ptr<Ring>(new Ring()));
+			ring = rings.back().get();
+			ring->head.store(0);
+			ring->thread = (int) rings.size();
+			ring->name = thread_name.empty() ? "Thread " + std::to_string(ring->thread) : thread_name;
+
+			return ring;
+
+		}
+
+	}  // namespace
+
+	CPUProfiler::Zone::Zone(const char* name) {
+
+		this->name = name;
+		this->start = recording.load(std::memory_order_relaxed) ? CPUProfiler::now() : 0;
+
+	}
+
+	CPUProfiler::Zone::~Zone() {
+
+		if (this->start != 0)
+			CPUProfiler::record(this->name, this->start, CPUProfiler::now());
+
+	}
+
+	size_t CPUProfiler::flush() {
+
+		std::lock_guard<std::mutex> lock(rings_mutex);
+
+		size_t moved = 0;
+
+		for (size_t r = 0; r < rings.size(); r++) {
+
+			Ring& ring = *rings[r];
+
+			// Everything before the head is written.
+			uint64_t head = ring.head.load(std::memory_order_acquire);
+			uint64_t tail = ring.tail;
+
+			// The thread may have gone round the ring since the last flush.
+			if (head - tail > CPU_PROFILER_RING_SIZE) {
+
+				dropped += (size_t) (head - tail - CPU_PROFILER_RING_SIZE);
+				tail = head - CPU_PROFILER_RING_SIZE;
+
+			}
+
+			size_t first = flushed.size();
+
+			for (uint64_t i = tail; i < head; i++) {
+
+				Event event = ring.events[i % CPU_PROFILER_RING_SIZE];
+				event.thread = ring.thread;
+				flushed.push_back(event);
+
+			}
+
+			// The thread kept writing while they were copied, so the oldest ones may have been overwritten.
+			// It may also be writing the zone after the head right now, which overwrites one more.
+			uint64_t overwritten = ring.head.load(std::memory_order_acquire);
+
+			if (overwritten + 1 - tail > CPU_PROFILER_RING_SIZE) {
+
+				size_t lost = (size_t) std::min<uint64_t>(overwritten + 1 - tail - CPU_PROFILER_RING_SIZE, head - tail);
+				flushed.erase(flushed.begin() + first, flushed.begin() + first + lost);
+				dropped += lost;
+
+			}
+
+			// Keep the list bounded, a long session drops the newest.
+			if (flushed.size() > CPU_PROFILER_MAX_EVENTS) {
+
+				dropped += flushed.size() - CPU_PROFILER_MAX_EVENTS;
+				flushed.resize(CPU_PROFILER_MAX_EVENTS);
+
+			}
+
+			moved += flushed.size() - first;
+			ring.tail = head;
+
+		}
+
+		return moved;
+
+	}
+
+	size_t CPUProfiler::getDropped() {
+
+		return dropped.load();
+
+	}
+
+	bool CPUProfiler::isEnabled() {
+
+		return recording.load();
+
+	}
+
+	uint64_t CPUProfiler::now() {
+
+		// 0 means a zone opened while the profiler was off.
+		uint64_t ns = (uint64_t) std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - epoch).count();
+
+		return ns + 1;
+
+	}
+
+	void CPUProfiler::record(const char* name, uint64_t start, uint64_t end) {
+
+		Ring* ring = getRing();
+
+		// Only this thread writes the head, so a relaxed read is enough.
+		uint64_t head = ring->head.load(std::memory_order_relaxed);
+
+		Event& event = ring->events[head % CPU_PROFILER_RING_SIZE];
+		event.name = name;
+		event.start = start;
+		event.end = end;
+
+		ring->head.store(head + 1, std::memory_order_release);
+
+	}
+
+	void CPUProfiler::setEnabled(bool enabled) {
+
+		recording.store(enabled);
+
+	}
+
+	void CPUProfiler::setThreadName(const std::string& name) {
+
+		// The ring takes it when it is created, threads that record nothing do not get one.
+		thread_name = name;
+
+		if (ring == nullptr)
+			return;
+
+		std::lock_guard<std::mutex> lock(rings_mutex);
+		ring->name = name;
+
+	}
+
+	bool CPUProfiler::writeTrace(const std::string& filename) {
+
+		CPUProfiler::flush();
+
+		std::ofstream file(filename);
+		if (!file)
+			return false;
+
+		std::lock_guard<std::mutex> lock(rings_mutex);
+
+		file << "{\"displayTimeUnit\": \"ms\", \"traceEvents\": [" << std::endl;
+
+		// Name the threads first.
+		for (size_t r = 0; r < rings.size(); r++) {
+
+			file << (r > 0 ? "," : "") << "{\"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << rings[r]->thread << ", \"args\": {\"name\": ";
+			JSON::writeString(file, rings[r]->name);
+			file << "}}" << std::endl;
+
+		}
+
+		// Complete events, in microseconds.
+		file.setf(std::ios::fixed);
+		file.precision(3);
+
+		for (size_t i = 0; i < flushed.size(); i++) {
+
+			file << (i > 0 || !rings.empty() ? "," : "") << "{\"name\": ";
+			JSON::writeString(file, flushed[i].name);
+			file << ", \"cat\": \"cpu\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << flushed[i].thread;
+			file << ", \"ts\": " << flushed[i].start / 1000.0 << ", \"dur\": " << (flushed[i].end - flushed[i].start) / 1000.0 << "}" << std::endl;
+
+		}
+
+		file << "]}" << std::endl;
+
+		return (bool) file;
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,176 @@
+/**
+ * @file cpu_profiler.h
+ * @brief CPU profiler class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_CPU_PROFILER_H_
+#define BGQ_OPENGL_CLASS_CPU_PROFILER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+// Zones are compiled in unless BGQ_OPENGL_NO_PROFILE is defined, in which case they are not there at all.
+#if !defined(BGQ_OPENGL_NO_PROFILE)
+#define BGQ_OPENGL_PROFILE
+#endif
+
+// Events every thread holds until they are flushed.
+#define CPU_PROFILER_RING_SIZE 16384
+
+// Events kept after flushing them, the rest are dropped.
+#define CPU_PROFILER_MAX_EVENTS 1000000
+
+#define BGQ_OPENGL_ZONE_CONCAT_(a, b) a##b
+#define BGQ_OPENGL_ZONE_CONCAT(a, b) BGQ_OPENGL_ZONE_CONCAT_(a, b)
+
+#ifdef BGQ_OPENGL_PROFILE
+// Times the rest of the scope. The name must be a string literal.
+#define PROFILE_ZONE(name) bgq_opengl::CPUProfiler::Zone BGQ_OPENGL_ZONE_CONCAT(profile_zone_, __LINE__)(name)
+#else
+#define PROFILE_ZONE(name)
+#endif
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a CPU profiler.
+	 *
+	 * Implementation of a profiler of scoped zones on any thread. Every
+	 * thread writes the zones it closes into a ring of its own, and only
+	 * publishes how far it got, so recording takes no locks. Flushing moves
+	 * what the rings hold into a single list without stopping the threads,
+	 * and the list is written as Chrome trace events, which chrome://tracing
+	 * and Perfetto open.
+	 *
+	 * Nothing is recorded until it is enabled, and with BGQ_OPENGL_NO_PROFILE
+	 * defined PROFILE_ZONE is compiled out.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class CPUProfiler {
+
+	public:
+
+		/**
+		 * @brief A scoped zone.
+		 *
+		 * Records the time between its construction and its destruction on
+		 * the ring of the thread. Use it through PROFILE_ZONE.
+		 */
+		class Zone {
+
+		public:
+
+			/**
+			 * @brief Opens the zone.
+			 *
+			 * @param name The name of the zone, which must outlive the profiler.
+			 */
+			Zone(const char* name);
+
+			/**
+			 * @brief Closes the zone.
+			 */
+			~Zone();
+
+		private:
+
+			Zone(const Zone&) = delete;
+			Zone& operator=(const Zone&) = delete;
+
+			const char* name;		/// Name of the zone.
+			uint64_t start;			/// When it was opened, 0 if the profiler was off.
+
+		};
+
+		/**
+		 * @brief Moves the recorded zones out of the rings.
+		 *
+		 * Moves the zones every thread recorded since the last flush into
+		 * the list that is written. It must be called often enough for the
+		 * rings not to wrap, such as once per frame. Only one thread may
+		 * flush at a time.
+		 *
+		 * @returns The number of zones moved.
+		 */
+		static size_t flush();
+
+		/**
+		 * @brief Get the number of zones dropped.
+		 *
+		 * Get the number of zones lost because a ring wrapped before it was
+		 * flushed or the list was full.
+		 *
+		 * @returns The number of zones dropped.
+		 */
+		static size_t getDropped();
+
+		/**
+		 * @brief Whether zones are recorded.
+		 *
+		 * @returns True if they are.
+		 */
+		static bool isEnabled();
+
+		/**
+		 * @brief Turns the recording on or off.
+		 *
+		 * @param enabled Whether to record the zones.
+		 */
+		static void setEnabled(bool enabled);
+
+		/**
+		 * @brief Names the calling thread.
+		 *
+		 * Names the calling thread in the trace. It costs nothing if the
+		 * thread never records a zone.
+		 *
+		 * @param name The name of the thread.
+		 */
+		static void setThreadName(const std::string& name);
+
+		/**
+		 * @brief Writes the trace.
+		 *
+		 * Flushes the rings and writes every zone recorded as Chrome trace
+		 * event JSON.
+		 *
+		 * @param filename The file to write.
+		 *
+		 * @returns True if it was written.
+		 */
+		static bool writeTrace(const std::string& filename);
+
+	private:
+
+		/**
+		 * @brief Get the current time.
+		 *
+		 * @returns Nanoseconds since the profiler started, never 0.
+		 */
+		static uint64_t now();
+
+		/**
+		 * @brief Records a zone.
+		 *
+		 * Writes a zone into the ring of the calling thread.
+		 */
+		static void record(const char* name, uint64_t start, uint64_t end);
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_CPU_PROFILER_H_
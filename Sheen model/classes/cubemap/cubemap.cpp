@@ -21,6 +21,8 @@
 
 #include "GL/glew.h"
 #include "stb/stb_image.h"
+
+#include "classes/gl_state/gl_state.h"
 
 namespace bgq_opengl {
 
@@ -39,8 +41,7 @@ namespace bgq_opengl {
 
         // Generate a texture in OpenGL and store the parameters in the attributes.
         glGenTextures(1, &this->ID);
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, this->ID);
+        GLState::bindTexture(GL_TEXTURE_CUBE_MAP, slot, this->ID);
         
         this->name = std::string(name);
         this->slot = slot;
@@ -86,23 +87,23 @@ namespace bgq_opengl {
         glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);
         
         // Unbinds the OpenGL Texture.
-        glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+        GLState::bindTexture(GL_TEXTURE_CUBE_MAP, slot, 0);
         
     }
 
-    GLuint Cubemap::getID() {
+    GLuint Cubemap::getID() const {
         
         return this->ID;
         
     }
 
-    GLuint Cubemap::getSlot() {
+    GLuint Cubemap::getSlot() const {
         
         return this->slot;
         
     }
 
-    std::string Cubemap::getName() {
+    std::string Cubemap::getName() const {
         
         return this->name;
         
@@ -111,20 +112,20 @@ namespace bgq_opengl {
     void Cubemap::bind() {
         
         // Activate the texture and bind it.
-        glActiveTexture(GL_TEXTURE0 + this->slot);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, this->ID);
+        GLState::bindTexture(GL_TEXTURE_CUBE_MAP, this->slot, this->ID);
         
     }
 
     void Cubemap::remove() {
         
+        GLState::forgetTexture(this->ID);
         glDeleteTextures(1, &this->ID);
         
     }
 
     void Cubemap::unbind() {
         
-        glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+        GLState::bindTexture(GL_TEXTURE_CUBE_MAP, this->slot, 0);
         
     }
 
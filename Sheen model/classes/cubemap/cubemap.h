@@ -65,7 +65,7 @@ namespace bgq_opengl {
              *
              * @returns The ID of the texture.
              */
-            GLuint getID();
+            GLuint getID() const;
 
             /**
              * @brief Get the slot of the texture.
@@ -74,7 +74,7 @@ namespace bgq_opengl {
              *
              * @returns The slot of the texture.
              */
-            GLuint getSlot();
+            GLuint getSlot() const;
 
             /**
              * @brief Gets the texture name.
@@ -83,7 +83,7 @@ namespace bgq_opengl {
              *
              * @returns A char string containing the name name of the texture.
              */
-            std::string getName();
+            std::string getName() const;
 
             /**
              * @brief Binds the texture.
@@ -22,14 +22,16 @@
 namespace bgq_opengl {
 
 	// Constructor that generates a Elements Buffer Object and links it to indices
-	EBO::EBO(const std::vector<GLuint> &indices) {
+	EBO::EBO(const std::vector<GLuint> &indices) : EBO(indices.data(), indices.size()) {}
+
+	EBO::EBO(const GLuint* indices, size_t count) {
 		
 		// Generate the buffer.
 		glGenBuffers(1, &this->ID);
 		glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, this->ID);
 
 		// Link the indices.
-		glBufferData(GL_ELEMENT_ARRAY_BUFFER, indices.size() * sizeof(GLuint), indices.data(), GL_STATIC_DRAW);
+		glBufferData(GL_ELEMENT_ARRAY_BUFFER, count * sizeof(GLuint), indices, GL_STATIC_DRAW);
 	
 	}
 
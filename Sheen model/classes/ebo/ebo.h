@@ -43,6 +43,17 @@ namespace bgq_opengl {
 			 */
 			EBO(const std::vector<GLuint> &indices);
 
+			/**
+			 * @brief Constructs a Elements Buffer Object.
+			 *
+			 * Constructs a Elements Buffer Object from indices that are not in
+			 * a vector, such as a mapped file.
+			 *
+			 * @param indices Indices that will be linked.
+			 * @param count Number of indices.
+			 */
+			EBO(const GLuint* indices, size_t count);
+
 			/**
 			 * @brief Binds the EBO.
 			 *
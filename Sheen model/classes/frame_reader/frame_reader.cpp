@@ -0,0 +1,164 @@
+/**
+ * @file frame_reader.cpp
+ * @brief Frame reader class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "frame_reader.h"
+
+#include <string.h>
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+
+#include "structs/frame/frame.h"
+
+namespace bgq_opengl {
+
+	FrameReader::FrameReader(GLsizei width, GLsizei height, int ring_size) {
+
+		// Store the parameters.
+		this->width = width;
+		this->height = height;
+		this->slots = std::vector<Slot>(ring_size);
+
+		// Allocate a buffer big enough for a frame in every slot.
+		for (int i = 0; i < ring_size; i++) {
+
+			glGenBuffers(1, &this->slots[i].pbo);
+			glBindBuffer(GL_PIXEL_PACK_BUFFER, this->slots[i].pbo);
+			glBufferData(GL_PIXEL_PACK_BUFFER, (GLsizeiptr) width * height * 4, NULL, GL_STREAM_READ);
+
+		}
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	}
+
+	bool FrameReader::collect(Frame* frame, bool wait) {
+
+		// Nothing to collect.
+		if (this->pending == 0)
+			return false;
+
+		Slot& slot = this->slots[this->oldest];
+
+		// Check whether the copy is done, waiting for it if asked to.
+		GLenum result = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 0);
+
+		if (result == GL_TIMEOUT_EXPIRED) {
+
+			if (!wait)
+				return false;
+
+			while (result == GL_TIMEOUT_EXPIRED)
+				result = glClientWaitSync(slot.fence, GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000);
+
+		}
+
+		if (result == GL_WAIT_FAILED) {
+
+			std::cerr << "Frame reader error: could not wait for frame " << slot.name << "." << std::endl;
+			exit(1);
+
+		}
+
+		glDeleteSync(slot.fence);
+		slot.fence = 0;
+
+		// Copy the pixels out of the buffer.
+		frame->name = slot.name;
+		frame->width = this->width;
+		frame->height = this->height;
+		frame->pixels.resize((size_t) this->width * this->height * 4);
+
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+		void* pixels = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, (GLsizeiptr) frame->pixels.size(), GL_MAP_READ_BIT);
+
+		// A frame that cannot be read is lost, so do not go on as if it had been written.
+		if (pixels == NULL) {
+
+			std::cerr << "Frame reader error: could not map frame " << slot.name << "." << std::endl;
+			exit(1);
+
+		}
+
+		memcpy(frame->pixels.data(), pixels, frame->pixels.size());
+		glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		// Free the slot.
+		this->oldest = (this->oldest + 1) % (int) this->slots.size();
+		this->pending--;
+
+		return true;
+
+	}
+
+	bool FrameReader::isFull() {
+
+		return this->pending == (int) this->slots.size();
+
+	}
+
+	int FrameReader::getPending() {
+
+		return this->pending;
+
+	}
+
+	void FrameReader::remove() {
+
+		// Delete the buffers and the fences still in flight.
+		for (size_t i = 0; i < this->slots.size(); i++) {
+
+			if (this->slots[i].fence != 0)
+				glDeleteSync(this->slots[i].fence);
+
+			glDeleteBuffers(1, &this->slots[i].pbo);
+
+		}
+
+		this->pending = 0;
+
+	}
+
+	void FrameReader::request(const std::string& name) {
+
+		if (this->isFull()) {
+
+			std::cerr << "Frame reader error: no free buffer for frame " << name << "." << std::endl;
+			exit(1);
+
+		}
+
+		// Get the next free slot.
+		Slot& slot = this->slots[(this->oldest + this->pending) % (int) this->slots.size()];
+		slot.name = name;
+
+		// Start the copy into the buffer. It returns straight away.
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, slot.pbo);
+		glPixelStorei(GL_PACK_ALIGNMENT, 1);
+		glReadBuffer(GL_COLOR_ATTACHMENT0);
+		glReadPixels(0, 0, this->width, this->height, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+		glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		// Fence it to know when it is done.
+		slot.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+		this->pending++;
+
+	}
+
+}  // namespace bgq_opengl
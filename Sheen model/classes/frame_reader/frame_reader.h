@@ -0,0 +1,128 @@
+/**
+ * @file frame_reader.h
+ * @brief Frame reader class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_FRAME_READER_H_
+#define BGQ_OPENGL_CLASS_FRAME_READER_H_
+
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+
+#include "structs/frame/frame.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of an asynchronous frame reader.
+	 *
+	 * Implementation of a ring of Pixel Buffer Objects that reads frames back
+	 * from the bound framebuffer without stalling. Every request copies the
+	 * frame into the next buffer of the ring and fences it, and the frame is
+	 * collected a few frames later, once the GPU is done with it.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class FrameReader {
+
+	public:
+
+		/**
+		 * @brief Constructs a frame reader.
+		 *
+		 * Constructs a frame reader and allocates its pixel buffers.
+		 *
+		 * @param width Width of the frames in pixels.
+		 * @param height Height of the frames in pixels.
+		 * @param ring_size Number of frames that can be in flight.
+		 */
+		FrameReader(GLsizei width, GLsizei height, int ring_size);
+
+		/**
+		 * @brief Collects the oldest frame in flight.
+		 *
+		 * Copies the oldest frame in flight out of its pixel buffer, freeing
+		 * the buffer for a new request. A frame that cannot be waited for or
+		 * mapped would be lost, so the program stops with an error instead.
+		 *
+		 * @param frame Output frame.
+		 * @param wait Whether to wait for the GPU if the frame is not ready yet.
+		 *
+		 * @returns True if a frame was collected, false if there is none or it is not ready.
+		 */
+		bool collect(Frame* frame, bool wait);
+
+		/**
+		 * @brief Whether every buffer of the ring is in flight.
+		 *
+		 * Whether every buffer of the ring is in flight, so a frame has to be
+		 * collected before the next request.
+		 *
+		 * @returns True if the ring is full.
+		 */
+		bool isFull();
+
+		/**
+		 * @brief Get the number of frames in flight.
+		 *
+		 * Get the number of frames requested and not collected yet.
+		 *
+		 * @returns The number of frames in flight.
+		 */
+		int getPending();
+
+		/**
+		 * @brief Removes the frame reader.
+		 *
+		 * Removes the pixel buffers and fences from OpenGL.
+		 */
+		void remove();
+
+		/**
+		 * @brief Requests a frame.
+		 *
+		 * Starts copying the color attachment of the bound framebuffer into
+		 * the next buffer of the ring. The ring must not be full.
+		 *
+		 * @param name The name of the frame.
+		 */
+		void request(const std::string& name);
+
+	private:
+
+		/**
+		 * @brief A buffer of the ring.
+		 *
+		 * A pixel buffer of the ring and the frame it holds.
+		 */
+		struct Slot {
+
+			GLuint pbo = 0;				/// GL ID of the pixel buffer.
+			GLsync fence = 0;			/// Signaled when the copy is done.
+			std::string name;			/// Name of the frame it holds.
+
+		};
+
+		std::vector<Slot> slots;	/// The ring of buffers.
+		GLsizei width;				/// Width of the frames in pixels.
+		GLsizei height;				/// Height of the frames in pixels.
+		int oldest = 0;				/// Index of the oldest frame in flight.
+		int pending = 0;			/// Number of frames in flight.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_FRAME_READER_H_
@@ -0,0 +1,120 @@
+/**
+ * @file frame_writer.cpp
+ * @brief Frame writer class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "frame_writer.h"
+
+#include <algorithm>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "classes/png_writer/png_writer.h"
+#include "structs/frame/frame.h"
+
+namespace bgq_opengl {
+
+	FrameWriter::FrameWriter(int threads, size_t max_queued) {
+
+		this->max_queued = std::max<size_t>(1, max_queued);
+
+		// Start the workers.
+		for (int i = 0; i < std::max(1, threads); i++)
+			this->workers.push_back(std::thread(&FrameWriter::work, this));
+
+	}
+
+	void FrameWriter::finish() {
+
+		// Tell the workers to stop once the queue is empty.
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->finishing = true;
+		}
+
+		this->has_frames.notify_all();
+
+		for (size_t i = 0; i < this->workers.size(); i++)
+			this->workers[i].join();
+
+		this->workers.clear();
+
+	}
+
+	unsigned int FrameWriter::getFailed() {
+
+		std::lock_guard<std::mutex> lock(this->mutex);
+		return this->failed;
+
+	}
+
+	unsigned int FrameWriter::getWritten() {
+
+		std::lock_guard<std::mutex> lock(this->mutex);
+		return this->written;
+
+	}
+
+	void FrameWriter::push(Frame&& frame) {
+
+		// Wait for room in the queue.
+		{
+			std::unique_lock<std::mutex> lock(this->mutex);
+			this->has_room.wait(lock, [this] { return this->queue.size() < this->max_queued; });
+			this->queue.push_back(std::move(frame));
+		}
+
+		this->has_frames.notify_one();
+
+	}
+
+	void FrameWriter::work() {
+
+		while (true) {
+
+			Frame frame;
+
+			// Take the next frame, or leave if there are no more.
+			{
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->has_frames.wait(lock, [this] { return !this->queue.empty() || this->finishing; });
+
+				if (this->queue.empty())
+					return;
+
+				frame = std::move(this->queue.front());
+				this->queue.pop_front();
+			}
+
+			this->has_room.notify_one();
+
+			// Encode and write it without holding the lock.
+			bool ok = PNGWriter::write(frame.name, frame.width, frame.height, 4, frame.pixels.data(), true);
+
+			if (!ok)
+				std::cerr << "Frame writer error: could not write " << frame.name << "." << std::endl;
+
+			std::lock_guard<std::mutex> lock(this->mutex);
+
+			if (ok)
+				this->written++;
+			else
+				this->failed++;
+
+		}
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,113 @@
+/**
+ * @file frame_writer.h
+ * @brief Frame writer class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_FRAME_WRITER_H_
+#define BGQ_OPENGL_CLASS_FRAME_WRITER_H_
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "structs/frame/frame.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a pool of PNG writers.
+	 *
+	 * Implementation of a pool of worker threads that encode frames as PNG
+	 * and write them to disk, so the render loop only hands them over. The
+	 * queue is bounded, so a slow disk makes the render loop wait instead of
+	 * piling frames up in memory.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class FrameWriter {
+
+	public:
+
+		/**
+		 * @brief Starts the workers.
+		 *
+		 * Starts the worker threads.
+		 *
+		 * @param threads Number of worker threads.
+		 * @param max_queued Frames that can wait in the queue.
+		 */
+		FrameWriter(int threads, size_t max_queued);
+
+		/**
+		 * @brief Waits for the frames and stops the workers.
+		 *
+		 * Waits until every frame in the queue is written and joins the
+		 * worker threads.
+		 */
+		void finish();
+
+		/**
+		 * @brief Get the number of frames that could not be written.
+		 *
+		 * Get the number of frames whose file could not be written.
+		 *
+		 * @returns The number of failed frames.
+		 */
+		unsigned int getFailed();
+
+		/**
+		 * @brief Get the number of frames written.
+		 *
+		 * Get the number of frames written so far.
+		 *
+		 * @returns The number of frames written.
+		 */
+		unsigned int getWritten();
+
+		/**
+		 * @brief Queues a frame.
+		 *
+		 * Queues a frame to be written to the file it is named after, waiting
+		 * if the queue is full.
+		 *
+		 * @param frame The frame, which is moved into the queue.
+		 */
+		void push(Frame&& frame);
+
+	private:
+
+		/**
+		 * @brief Loop of the worker threads.
+		 *
+		 * Takes frames from the queue and writes them until finish is called
+		 * and the queue is empty.
+		 */
+		void work();
+
+		std::vector<std::thread> workers;		/// The worker threads.
+		std::deque<Frame> queue;				/// Frames waiting to be written.
+		size_t max_queued;						/// Frames that can wait in the queue.
+		std::mutex mutex;						/// Guards the queue and the counters.
+		std::condition_variable has_frames;		/// Signaled when a frame is queued or on finish.
+		std::condition_variable has_room;		/// Signaled when a frame leaves the queue.
+		bool finishing = false;					/// Whether the workers must stop once the queue is empty.
+		unsigned int written = 0;				/// Frames written.
+		unsigned int failed = 0;				/// Frames that could not be written.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_FRAME_WRITER_H_
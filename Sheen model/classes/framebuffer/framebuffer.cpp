@@ -0,0 +1,98 @@
+/**
+ * @file framebuffer.cpp
+ * @brief Framebuffer class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "framebuffer.h"
+
+#include <iostream>
+
+#include "GL/glew.h"
+
+namespace bgq_opengl {
+
+	Framebuffer::Framebuffer(GLsizei width, GLsizei height) {
+
+		// Store the size.
+		this->width = width;
+		this->height = height;
+
+		// Generate the framebuffer.
+		glGenFramebuffers(1, &this->ID);
+		glBindFramebuffer(GL_FRAMEBUFFER, this->ID);
+
+		// Allocate the color attachment.
+		glGenRenderbuffers(1, &this->color);
+		glBindRenderbuffer(GL_RENDERBUFFER, this->color);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, width, height);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, this->color);
+
+		// Allocate the depth attachment.
+		glGenRenderbuffers(1, &this->depth);
+		glBindRenderbuffer(GL_RENDERBUFFER, this->depth);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, width, height);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, this->depth);
+
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		// Check that the driver can render to it.
+		GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+		if (status != GL_FRAMEBUFFER_COMPLETE) {
+
+			std::cerr << "Framebuffer error: framebuffer is incomplete (0x" << std::hex << status << std::dec << ")." << std::endl;
+			exit(1);
+
+		}
+
+		// Unbind it again.
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	}
+
+	void Framebuffer::bind() {
+
+		// Bind it and render to the whole of it.
+		glBindFramebuffer(GL_FRAMEBUFFER, this->ID);
+		glViewport(0, 0, this->width, this->height);
+
+	}
+
+	GLsizei Framebuffer::getHeight() {
+
+		return this->height;
+
+	}
+
+	GLsizei Framebuffer::getWidth() {
+
+		return this->width;
+
+	}
+
+	void Framebuffer::remove() {
+
+		// Delete the framebuffer and its attachments.
+		glDeleteFramebuffers(1, &this->ID);
+		glDeleteRenderbuffers(1, &this->color);
+		glDeleteRenderbuffers(1, &this->depth);
+
+	}
+
+	void Framebuffer::unbind() {
+
+		// Bind the default framebuffer.
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+	}
+
+}  // namespace bgq_opengl
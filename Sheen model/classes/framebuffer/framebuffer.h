@@ -0,0 +1,98 @@
+/**
+ * @file framebuffer.h
+ * @brief Framebuffer class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_FRAMEBUFFER_H_
+#define BGQ_OPENGL_CLASS_FRAMEBUFFER_H_
+
+#include "GL/glew.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a Framebuffer class.
+	 *
+	 * Implementation of a Framebuffer Object class with an 8-bit RGBA color
+	 * attachment and a depth attachment, so the scene can be rendered without
+	 * a window and read back.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class Framebuffer {
+
+	public:
+
+		/**
+		 * @brief Constructs a Framebuffer Object.
+		 *
+		 * Constructs a Framebuffer Object and allocates its attachments.
+		 *
+		 * @param width Width in pixels.
+		 * @param height Height in pixels.
+		 */
+		Framebuffer(GLsizei width, GLsizei height);
+
+		/**
+		 * @brief Binds the framebuffer.
+		 *
+		 * Binds the framebuffer for drawing and reading, and sets the
+		 * viewport to cover it.
+		 */
+		void bind();
+
+		/**
+		 * @brief Get the height.
+		 *
+		 * Get the height of the framebuffer.
+		 *
+		 * @returns The height in pixels.
+		 */
+		GLsizei getHeight();
+
+		/**
+		 * @brief Get the width.
+		 *
+		 * Get the width of the framebuffer.
+		 *
+		 * @returns The width in pixels.
+		 */
+		GLsizei getWidth();
+
+		/**
+		 * @brief Removes the framebuffer.
+		 *
+		 * Removes the framebuffer and its attachments from OpenGL.
+		 */
+		void remove();
+
+		/**
+		 * @brief Unbinds the framebuffer.
+		 *
+		 * Binds the default framebuffer again.
+		 */
+		void unbind();
+
+	private:
+
+		GLuint ID;				/// GL ID of the framebuffer.
+		GLuint color;			/// GL ID of the color renderbuffer.
+		GLuint depth;			/// GL ID of the depth renderbuffer.
+		GLsizei width;			/// Width in pixels.
+		GLsizei height;			/// Height in pixels.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_FRAMEBUFFER_H_
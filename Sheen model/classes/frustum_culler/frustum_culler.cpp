@@ -0,0 +1,130 @@
+/**
+ * @file frustum_culler.cpp
+ * @brief Frustum culler class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "frustum_culler.h"
+
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "classes/ltc_reference/ltc_lanes.h"
+#include "structs/bounding_box/bounding_box.h"
+#include "structs/frustum/frustum.h"
+
+namespace bgq_opengl {
+
+    namespace {
+
+        using namespace lanes;
+
+        // The widest lane type the compiler targets.
+#if defined(BGQ_OPENGL_LANES_AVX2)
+        typedef Float8 Wide;
+        const char* WIDE_NAME = "AVX2";
+#elif defined(BGQ_OPENGL_LANES_SSE2)
+        typedef Float4 Wide;
+        const char* WIDE_NAME = "SSE2";
+#else
+        typedef Float1 Wide;
+        const char* WIDE_NAME = "scalar";
+#endif
+
+    }  // namespace
+
+    size_t FrustumCuller::cull(const Frustum& frustum, std::vector<unsigned char>* visible) {
+
+        // The arrays are padded, so every box goes through the widest lanes.
+        this->cullRange<Wide>(frustum, 0, this->inside.size());
+
+        visible->resize(this->size);
+        size_t count = 0;
+
+        for (size_t i = 0; i < this->size; i++) {
+
+            (*visible)[i] = this->inside[i] > 0.0f ? 1 : 0;
+            count += (*visible)[i];
+
+        }
+
+        return count;
+
+    }
+
+    template <class F>
+    void FrustumCuller::cullRange(const Frustum& frustum, size_t first, size_t last) {
+
+        for (size_t i = first; i < last; i += F::WIDTH) {
+
+            F result(1.0f);
+
+            for (int p = 0; p < 6; p++) {
+
+                // The plane is the same for every lane, so so is the corner to test.
+                const glm::vec4& plane = frustum.planes[p];
+                F x = load(&(plane.x > 0.0f ? this->max_x : this->min_x)[i], F());
+                F y = load(&(plane.y > 0.0f ? this->max_y : this->min_y)[i], F());
+                F z = load(&(plane.z > 0.0f ? this->max_z : this->min_z)[i], F());
+
+                F distance = F(plane.x) * x + F(plane.y) * y + F(plane.z) * z + F(plane.w);
+                result = select(distance < F(0.0f), F(0.0f), result);
+
+            }
+
+            store(&this->inside[i], result);
+
+        }
+
+    }
+
+    const char* FrustumCuller::getInstructionSet() {
+
+        return WIDE_NAME;
+
+    }
+
+    size_t FrustumCuller::getSize() {
+
+        return this->size;
+
+    }
+
+    void FrustumCuller::resize(size_t count) {
+
+        // Round it up to the widest lane, the padding is never read back.
+        size_t padded = (count + Wide::WIDTH - 1) / Wide::WIDTH * Wide::WIDTH;
+
+        this->size = count;
+        this->min_x.resize(padded, 0.0f);
+        this->min_y.resize(padded, 0.0f);
+        this->min_z.resize(padded, 0.0f);
+        this->max_x.resize(padded, 0.0f);
+        this->max_y.resize(padded, 0.0f);
+        this->max_z.resize(padded, 0.0f);
+        this->inside.resize(padded, 0.0f);
+
+    }
+
+    void FrustumCuller::setBox(size_t index, const BoundingBox& box) {
+
+        this->min_x[index] = box.min.x;
+        this->min_y[index] = box.min.y;
+        this->min_z[index] = box.min.z;
+        this->max_x[index] = box.max.x;
+        this->max_y[index] = box.max.y;
+        this->max_z[index] = box.max.z;
+
+    }
+
+}  // namespace bgq_opengl
@@ -0,0 +1,118 @@
+/**
+ * @file frustum_culler.h
+ * @brief Frustum culler class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_FRUSTUM_CULLER_H_
+#define BGQ_OPENGL_CLASSES_FRUSTUM_CULLER_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "structs/bounding_box/bounding_box.h"
+#include "structs/frustum/frustum.h"
+
+namespace bgq_opengl {
+
+    /**
+     * @brief Implements a frustum test over many bounding boxes.
+     *
+     * Implements the test of intersects() in frustum.h for a whole array of
+     * bounding boxes at once. The boxes are kept as one array per coordinate,
+     * so the planes are tested against eight boxes at a time with AVX2 and
+     * four with SSE2, with the same lane types as LTCReference.
+     *
+     * @author Borja García Quiroga <garcaqub@tcd.ie>
+     */
+    class FrustumCuller {
+
+        public:
+
+            /**
+             * @brief Tests the boxes against a frustum.
+             *
+             * Tests all the boxes against a frustum.
+             *
+             * @param frustum The frustum.
+             * @param visible Outputs 1 for every box that touches it and 0 for the rest.
+             *
+             * @returns The number of boxes that touch it.
+             */
+            size_t cull(const Frustum& frustum, std::vector<unsigned char>* visible);
+
+            /**
+             * @brief Get the instruction set of the SIMD path.
+             *
+             * Get the name of the instruction set the boxes are tested with.
+             *
+             * @returns "AVX2", "SSE2" or "scalar".
+             */
+            static const char* getInstructionSet();
+
+            /**
+             * @brief Get the number of boxes.
+             *
+             * Get the number of boxes.
+             *
+             * @returns The number of boxes.
+             */
+            size_t getSize();
+
+            /**
+             * @brief Set the number of boxes.
+             *
+             * Set the number of boxes. New ones are empty boxes at the origin.
+             *
+             * @param count The number of boxes.
+             */
+            void resize(size_t count);
+
+            /**
+             * @brief Set a box.
+             *
+             * Set one of the boxes.
+             *
+             * @param index The box.
+             * @param box Its bounds.
+             */
+            void setBox(size_t index, const BoundingBox& box);
+
+        private:
+
+            /**
+             * @brief Tests a range of boxes.
+             *
+             * Tests the boxes from first to last, a lane of F at a time.
+             *
+             * @param frustum The frustum.
+             * @param first The first box.
+             * @param last One past the last box, first plus a multiple of the width of F.
+             */
+            template <class F>
+            void cullRange(const Frustum& frustum, size_t first, size_t last);
+
+            size_t size = 0;                    /// Number of boxes.
+            std::vector<float> min_x;           /// Minimum x of every box, padded to the widest lane.
+            std::vector<float> min_y;           /// Minimum y of every box, padded to the widest lane.
+            std::vector<float> min_z;           /// Minimum z of every box, padded to the widest lane.
+            std::vector<float> max_x;           /// Maximum x of every box, padded to the widest lane.
+            std::vector<float> max_y;           /// Maximum y of every box, padded to the widest lane.
+            std::vector<float> max_z;           /// Maximum z of every box, padded to the widest lane.
+            std::vector<float> inside;          /// 1 for every box that passed the last test, else 0.
+
+    };
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_FRUSTUM_CULLER_H_
@@ -15,6 +15,8 @@
 
 #include "geometry.h"
 
+#include <stddef.h>
+
 #include <vector>
 #include <stdexcept>
 
@@ -23,35 +25,61 @@
 #include "glm/gtc/type_ptr.hpp"
 
 #include "classes/camera/camera.h"
+#include "classes/cpu_profiler/cpu_profiler.h"
 #include "classes/ebo/ebo.h"
+#include "classes/gl_state/gl_state.h"
 #include "classes/shader/shader.h"
 #include "classes/texture/texture.h"
 #include "classes/vao/vao.h"
+#include "classes/vertex_packer/vertex_packer.h"
+#include "structs/instance_data/instance_data.h"
+#include "structs/packed_vertex/packed_vertex.h"
 #include "structs/vertex/vertex.h"
 #include "structs/bounding_box/bounding_box.h"
 
 namespace bgq_opengl {
 
-	Geometry::Geometry(const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const std::vector<Texture> &textures, const float shininess) {
+	Geometry::Geometry(const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const std::vector<Texture> &textures, const float shininess, VertexFormat format, bool keep_vertices, bool upload) : Geometry(vertices.data(), vertices.size(), indices.data(), indices.size(), textures, shininess, computeBoundingBox(vertices.data(), vertices.size()), format, keep_vertices, upload) {}
+
+	Geometry::Geometry(const Vertex* vertices, size_t vertex_count, const GLuint* indices, size_t index_count, const std::vector<Texture> &textures, const float shininess, const BoundingBox &bounding_box, VertexFormat format, bool keep_vertices, bool upload) : vao(upload ? VAO() : VAO(0)) {
+
+		PROFILE_ZONE("Geometry::upload");
 
-		// Store a copy of these in the attributes.
-		this->vertices = vertices;
-		this->indices = indices;
+		// Store a copy of these in the attributes, only if they will be needed after uploading them or they are not uploaded.
+		if (keep_vertices || !upload) {
+
+			this->vertices.assign(vertices, vertices + vertex_count);
+			this->indices.assign(indices, indices + index_count);
+
+		}
+
+		this->vertex_count = vertex_count;
+		this->index_count = index_count;
         this->textures = textures;
         this->shininess = shininess;
+		this->bounding_box = bounding_box;
+		this->vertex_format = format;
+
+		// The color is the same for the whole mesh.
+		if (vertex_count > 0)
+			this->color = vertices[0].color;
+
+		if (!upload)
+			return;
 
 		// Generate a VAO and bind it, generate a VBO for the vertices and a EBO for the indices.
 		this->vao.bind();
-		VBO vbo(vertices);
-		EBO ebo(indices);
 
-		// Links VBO attributes such as coordinates and colors to VAO.
-		vao.link_attribute(vbo, 0, 3, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)0);
-		vao.link_attribute(vbo, 1, 3, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)(3 * sizeof(float)));
-		vao.link_attribute(vbo, 2, 3, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)(6 * sizeof(float)));
-        vao.link_attribute(vbo, 3, 2, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)(9 * sizeof(float)));
-        vao.link_attribute(vbo, 4, 3, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)(11 * sizeof(float)));
-        vao.link_attribute(vbo, 5, 3, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)(14 * sizeof(float)));
+		// They are uploaded from the arrays given, which may be a mapped file, or packed first.
+		std::vector<unsigned char> packed;
+
+		if (format != VERTEX_FORMAT_FULL)
+			VertexPacker::pack(vertices, vertex_count, format, &packed);
+
+		VBO vbo = format == VERTEX_FORMAT_FULL ? VBO(vertices, vertex_count) : VBO(packed.data(), packed.size());
+		EBO ebo(indices, index_count);
+
+		Geometry::linkAttributes(this->vao, vbo, format);
 
 		vao.unbind();
 		vbo.unbind();
@@ -59,13 +87,46 @@ namespace bgq_opengl {
 
 	}
 
-	std::vector<GLuint> Geometry::getIndices() {
+	void Geometry::linkAttributes(VAO &vao, VBO &vbo, VertexFormat format) {
+
+		if (format == VERTEX_FORMAT_FULL) {
+
+			// Links VBO attributes such as coordinates and colors to VAO.
+			vao.link_attribute(vbo, 0, 3, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)0);
+			vao.link_attribute(vbo, 1, 3, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)(3 * sizeof(float)));
+			vao.link_attribute(vbo, 2, 3, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)(6 * sizeof(float)));
+			vao.link_attribute(vbo, 3, 2, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)(9 * sizeof(float)));
+			vao.link_attribute(vbo, 4, 3, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)(11 * sizeof(float)));
+			vao.link_attribute(vbo, 5, 3, GL_FLOAT, sizeof(bgq_opengl::Vertex), (void*)(14 * sizeof(float)));
+
+			return;
+
+		}
+
+		// Else they are packed. The shader rebuilds the bitangent, and the color is passed on every draw.
+		GLsizeiptr stride = (GLsizeiptr) VertexPacker::getStride(format);
+		size_t directions = format == VERTEX_FORMAT_HALF ? 4 * sizeof(uint16_t) : 4 * sizeof(float);
+
+		vao.link_attribute(vbo, 0, 4, format == VERTEX_FORMAT_HALF ? GL_HALF_FLOAT : GL_FLOAT, stride, (void*)0);
+		vao.link_attribute(vbo, 1, 2, GL_SHORT, stride, (void*)directions, GL_TRUE);
+		vao.link_attribute(vbo, 4, 2, GL_SHORT, stride, (void*)(directions + 2 * sizeof(int16_t)), GL_TRUE);
+		vao.link_attribute(vbo, 3, 2, GL_HALF_FLOAT, stride, (void*)(directions + 4 * sizeof(int16_t)));
+
+	}
+
+	size_t Geometry::getIndexCount() {
+
+		return this->index_count;
+
+	}
+
+	const std::vector<GLuint>& Geometry::getIndices() {
 
 		return this->indices;
 
 	}
 
-	std::vector<Texture>  Geometry::getTextures() {
+	const std::vector<Texture>& Geometry::getTextures() {
 
 		return this->textures;
 
@@ -77,12 +138,38 @@ namespace bgq_opengl {
 
 	}
 
-	std::vector<Vertex> Geometry::getVertices() {
+	size_t Geometry::getVertexCount() {
+
+		return this->vertex_count;
+
+	}
+
+	const std::vector<Vertex>& Geometry::getVertices() {
 
 		return this->vertices;
 
 	}
 
+	bool Geometry::hasVertices() {
+
+		return this->vertices.size() == this->vertex_count && this->indices.size() == this->index_count;
+
+	}
+
+	void Geometry::releaseVertices() {
+
+		// Swap them with empty ones, clear would keep the memory.
+		std::vector<Vertex>().swap(this->vertices);
+		std::vector<GLuint>().swap(this->indices);
+
+	}
+
+	VertexFormat Geometry::getVertexFormat() {
+
+		return this->vertex_format;
+
+	}
+
     float Geometry::getShininess() {
         
         return this->shininess;
@@ -104,6 +191,7 @@ namespace bgq_opengl {
     void Geometry::setTransformMat(glm::mat4 transform) {
         
         this->transforms = transform;
+        this->world_dirty = true;
         
     }
 
@@ -119,73 +207,116 @@ namespace bgq_opengl {
 
 	void Geometry::draw(Shader &shader, Camera &camera) {
 
-		// Activate the VAO and the shader to access the uniforms.
+		// Compute the modelView and the normal matrix.
+		glm::mat4 model_view = camera.getView() * this->transforms;
+		glm::mat4 normal_matrix = glm::transpose(glm::inverse(model_view));
+
+		this->draw(shader, camera, model_view, normal_matrix);
+
+	}
+
+	void Geometry::draw(Shader &shader, Camera &camera, const glm::mat4 &model_view, const glm::mat4 &normal_matrix, GLsizei instances) {
+
+		PROFILE_ZONE("Geometry::draw");
+
+		// Activate the VAO and the shader to access the uniforms. Nothing is issued if they already are.
 		shader.activate();
 		vao.bind();
 
-		for (size_t i = 0; i < textures.size(); i++) {
-
-			std::string name = textures[i].getName();
-			std::string id = "";
-			
-            textures[i].bind();
+		// Textures that are already in their slots are not bound again.
+		for (size_t i = 0; i < textures.size(); i++)
 			shader.passTexture(textures[i]);
 
-		}
-
 		// Pass the camera to the shader.
 		shader.passCamera(camera);
+
+        // The handles were resolved when the shader was linked.
+        const Shader::Builtins& builtins = shader.getBuiltins();
         
         // Pass the shininess to the shader.
-        shader.passFloat("materialShininess", this->shininess);
+        builtins.shininess.set(this->shininess);
         
-		// Get the model matrix and pass it.
-		glm::mat4 model = this->transforms;
-		glUniformMatrix4fv(glGetUniformLocation(shader.getProgramID(), "Model"), 1, GL_FALSE, glm::value_ptr(model));
+        // Packed vertices are decoded in the shader. Their color is the same for all of them.
+        builtins.packed_vertices.set(this->vertex_format != VERTEX_FORMAT_FULL);
+        
+        if (this->vertex_format != VERTEX_FORMAT_FULL)
+            glVertexAttrib3f(2, this->color.x, this->color.y, this->color.z);
+        
+		// Pass the model, modelView and normal matrices.
+		builtins.model.set(this->transforms);
+		builtins.model_view.set(model_view);
+		builtins.normal_matrix.set(normal_matrix);
 
-		// Get the View matrix and compute the modelView;
-		glm::mat4 view = camera.getView();
-		glm::mat4 model_view = view * model;
-		glUniformMatrix4fv(glGetUniformLocation(shader.getProgramID(), "modelView"), 1, GL_FALSE, glm::value_ptr(model_view));
+		// Draw the actual Geometry. The instances need a permutation that reads their model matrix and material.
+		if (instances > 0)
+			glDrawElementsInstanced(GL_TRIANGLES, (GLsizei) this->index_count, GL_UNSIGNED_INT, 0, instances);
+		else
+			glDrawElements(GL_TRIANGLES, (GLsizei) this->index_count, GL_UNSIGNED_INT, 0);
 
-		// Get the normal matrix and pass it.
-		glm::mat4 normal_matrix = glm::transpose(glm::inverse(model_view));
-		glUniformMatrix4fv(glGetUniformLocation(shader.getProgramID(), "normalMatrix"), 1, GL_FALSE, glm::value_ptr(normal_matrix));
+		GLState::countDraw(instances > 0 ? (unsigned int) instances : 1);
+
+	}
+
+	void Geometry::linkInstances(VBO &instances) {
+
+		this->vao.bind();
+
+		// The model matrix takes a location per column.
+		GLsizeiptr stride = sizeof(InstanceData);
+
+		for (GLuint column = 0; column < 4; column++)
+			vao.link_attribute(instances, 6 + column, 4, GL_FLOAT, stride, (void*)(column * sizeof(glm::vec4)), GL_FALSE, 1);
 
-		// Draw the actual Geometry
-		glDrawElements(GL_TRIANGLES, (GLsizei) indices.size(), GL_UNSIGNED_INT, 0);
+		vao.link_attribute(instances, 10, 4, GL_FLOAT, stride, (void*)offsetof(InstanceData, diffuse), GL_FALSE, 1);
+		vao.link_attribute(instances, 11, 2, GL_FLOAT, stride, (void*)offsetof(InstanceData, alpha), GL_FALSE, 1);
+
+		this->vao.unbind();
 
 	}
 
 	BoundingBox Geometry::getBoundingBox() {
 
-		// Create the bb.
-		BoundingBox bb;
+		return this->bounding_box;
 
-		// Init the bounding box with the first vertex.
-		bb.min = glm::vec3(this->vertices[0].position.x, this->vertices[0].position.y, this->vertices[0].position.z);
-		bb.max = glm::vec3(this->vertices[0].position.x, this->vertices[0].position.y, this->vertices[0].position.z);
+	}
 
-		// Loop through the vertices and get tge min and max values.
-		for (int i = 1; i < this->vertices.size(); i++) {
+	BoundingBox Geometry::getWorldBoundingBox() {
+
+		// Only transform it again if the transforms changed.
+		if (this->world_dirty) {
+
+			this->world_bounding_box = get_transformed(this->bounding_box, this->transforms);
+			this->world_dirty = false;
+
+		}
 
-			if (bb.min.x > this->vertices[i].position.x)
-				bb.min.x = this->vertices[i].position.x;
+		return this->world_bounding_box;
 
-			if (bb.min.y > this->vertices[i].position.y)
-				bb.min.y = this->vertices[i].position.y;
+	}
+
+	BoundingBox Geometry::computeBoundingBox(const Vertex* vertices, size_t count) {
+
+		// Create the bb.
+		BoundingBox bb;
 
-			if (bb.min.z > this->vertices[i].position.z)
-				bb.min.z = this->vertices[i].position.z;
+		// Geometries with no vertices get an empty box.
+		if (count == 0) {
 
-			if (bb.max.x < this->vertices[i].position.x)
-				bb.max.x = this->vertices[i].position.x;
+			bb.min = glm::vec3(0.0f);
+			bb.max = glm::vec3(0.0f);
+			return bb;
 
-			if (bb.max.y < this->vertices[i].position.y)
-				bb.max.y = this->vertices[i].position.y;
+		}
+
+		// Init the bounding box with the first vertex.
+		bb.min = vertices[0].position;
+		bb.max = vertices[0].position;
+
+		// Loop through the vertices and get tge min and max values.
+		for (size_t i = 1; i < count; i++) {
 
-			if (bb.max.z < this->vertices[i].position.z)
-				bb.max.z = this->vertices[i].position.z;
+			bb.min = glm::min(bb.min, vertices[i].position);
+			bb.max = glm::max(bb.max, vertices[i].position);
 
 		}
 
@@ -196,6 +327,7 @@ namespace bgq_opengl {
 	void Geometry::resetTransforms() {
 
 		this->transforms = glm::mat4(1.0f);
+		this->world_dirty = true;
 
 	}
 
@@ -209,6 +341,7 @@ namespace bgq_opengl {
 		glm::mat4 rotation_matrix = glm::rotate(identity_matrix, radians, glm::vec3(x, y, z));
 
 		this->transforms *= rotation_matrix;
+		this->world_dirty = true;
 
 	}
 
@@ -219,6 +352,7 @@ namespace bgq_opengl {
 		glm::mat4 scale_matrix = glm::scale(identity_matrix, glm::vec3(x, y, z));
 
 		this->transforms *= scale_matrix;
+		this->world_dirty = true;
 
 	}
 
@@ -229,6 +363,7 @@ namespace bgq_opengl {
 
 		// Apply it to the transormations.
 		this->transforms *= trans_matrix;
+		this->world_dirty = true;
 
 	}
 
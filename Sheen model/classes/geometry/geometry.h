@@ -28,6 +28,8 @@
 #include "classes/ebo/ebo.h"
 #include "classes/vbo/vbo.h"
 #include "classes/vao/vao.h"
+#include "structs/instance_data/instance_data.h"
+#include "structs/packed_vertex/packed_vertex.h"
 #include "structs/vertex/vertex.h"
 #include "structs/bounding_box/bounding_box.h"
 
@@ -53,22 +55,57 @@ namespace bgq_opengl {
 			 * @param vertices Vertices of the object.
 			 * @param indices Indices of the vertices.
 			 * @param textures Textures in connection with this geometry.
+			 * @param shininess Shininess of the material.
+			 * @param format Layout the vertices are uploaded in.
+			 * @param keep_vertices Whether to keep a CPU copy of the vertices and indices.
+			 * @param upload Whether to upload them, else only the CPU copy is kept.
 			 */
-			Geometry(const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const std::vector<Texture> &textures, const float shininess);
+			Geometry(const std::vector<Vertex> &vertices, const std::vector<GLuint> &indices, const std::vector<Texture> &textures, const float shininess, VertexFormat format = VERTEX_FORMAT_FULL, bool keep_vertices = true, bool upload = true);
+
+			/**
+			 * @brief Initializes the Geometry from arrays.
+			 *
+			 * Initializes the geometry from arrays that are not in vectors, such
+			 * as a mapped mesh cache, uploading them from where they are. The
+			 * bounding box is given, not computed. Without a CPU copy, nothing
+			 * is kept of the arrays but the counts. Without uploading them, as
+			 * the software renderer does where there may be no OpenGL at all,
+			 * the CPU copy is always kept and the geometry cannot be drawn.
+			 *
+			 * @param vertices Vertices of the object.
+			 * @param vertex_count Number of vertices.
+			 * @param indices Indices of the vertices.
+			 * @param index_count Number of indices.
+			 * @param textures Textures in connection with this geometry.
+			 * @param shininess Shininess of the material.
+			 * @param bounding_box Bounding box of the vertices.
+			 * @param format Layout the vertices are uploaded in.
+			 * @param keep_vertices Whether to keep a CPU copy of the vertices and indices.
+			 * @param upload Whether to upload them, else only the CPU copy is kept.
+			 */
+			Geometry(const Vertex* vertices, size_t vertex_count, const GLuint* indices, size_t index_count, const std::vector<Texture> &textures, const float shininess, const BoundingBox &bounding_box, VertexFormat format = VERTEX_FORMAT_FULL, bool keep_vertices = true, bool upload = true);
+
+			/**
+			 * @brief Get the number of indices.
+			 *
+			 * Get the number of indices uploaded, even if the CPU copy was released.
+			 */
+			size_t getIndexCount();
 
 			/**
 			 * @brief Get the indices of the geometry.
 			 *
-			 * Get the indices of the geometry.
+			 * Get the indices of the geometry, without copying them. Empty if
+			 * the CPU copy was released.
 			 */
-			std::vector<GLuint> getIndices();
+			const std::vector<GLuint>& getIndices();
 			
 			/**
 			 * @brief Get the textures.
 			 *
-			 * Get the textures.
+			 * Get the textures, without copying them.
 			 */
-			std::vector<Texture> getTextures();
+			const std::vector<Texture>& getTextures();
 			
 			/**
 			 * @brief Get the VAO.
@@ -77,12 +114,44 @@ namespace bgq_opengl {
 			 */
 			VAO getVAO();
 			
+			/**
+			 * @brief Get the number of vertices.
+			 *
+			 * Get the number of vertices uploaded, even if the CPU copy was released.
+			 */
+			size_t getVertexCount();
+
 			/**
 			 * @brief Get the vertices of the geometry.
 			 *
-			 * Get the vertices of the geometry.
+			 * Get the vertices of the geometry, without copying them. Empty if
+			 * the CPU copy was released.
+			 */
+			const std::vector<Vertex>& getVertices();
+
+			/**
+			 * @brief Whether there is a CPU copy of the vertices.
+			 *
+			 * Whether the vertices and indices are still kept on the CPU.
+			 *
+			 * @returns True if they are.
+			 */
+			bool hasVertices();
+
+			/**
+			 * @brief Release the CPU copy of the vertices.
+			 *
+			 * Frees the vertices and indices kept on the CPU. The GPU buffers,
+			 * the counts and the bounding box stay, so it can still be drawn.
+			 */
+			void releaseVertices();
+
+			/**
+			 * @brief Get the layout of the vertex buffer.
+			 *
+			 * Get the layout the vertices were uploaded in.
 			 */
-			std::vector<Vertex> getVertices();
+			VertexFormat getVertexFormat();
         
             /**
              * @brief Get the object shininess.
@@ -133,15 +202,72 @@ namespace bgq_opengl {
 			 */
 			void draw(Shader &shader, Camera &camera);
 
+			/**
+			 * @brief Draws the Geometry with its matrices.
+			 *
+			 * Displays the Geometry in OpenGL with a model-view and normal
+			 * matrix that were already computed, such as the ones of a
+			 * SceneGraph.
+			 *
+			 * @param model_view The view times the transform matrix.
+			 * @param normal_matrix The inverse transpose of the model-view.
+			 * @param instances Number of instances to draw in one call, or 0 to draw it once without them.
+			 */
+			void draw(Shader &shader, Camera &camera, const glm::mat4 &model_view, const glm::mat4 &normal_matrix, GLsizei instances = 0);
+
+			/**
+			 * @brief Links the vertex attributes.
+			 *
+			 * Links the attributes of a buffer of vertices in some layout to
+			 * the locations ltc.vert reads them from.
+			 *
+			 * @param vao The VAO, already bound.
+			 * @param vbo The buffer of vertices.
+			 * @param format Layout of the vertices in the buffer.
+			 */
+			static void linkAttributes(VAO &vao, VBO &vbo, VertexFormat format);
+
+			/**
+			 * @brief Links a buffer of instances.
+			 *
+			 * Links a buffer of InstanceData to the VAO, so that the geometry
+			 * can be drawn many times in one call.
+			 *
+			 * @param instances The buffer of instances.
+			 */
+			void linkInstances(VBO &instances);
+
 			/**
 			 * @brief Gets the bounding box.
 			 * 
-			 * Gets the bounding box of the geometry.
+			 * Gets the bounding box of the geometry, computed when it was built.
 			 * 
 			 * @returns The bounding box struct.
 			 */
 			BoundingBox getBoundingBox();
 
+			/**
+			 * @brief Gets the transformed bounding box.
+			 *
+			 * Gets the bounding box after the transforms. It is only computed
+			 * again when they changed since the last call.
+			 *
+			 * @returns The bounding box struct.
+			 */
+			BoundingBox getWorldBoundingBox();
+
+			/**
+			 * @brief Computes a bounding box.
+			 *
+			 * Computes the bounding box of some vertices.
+			 *
+			 * @param vertices The vertices.
+			 * @param count Number of vertices.
+			 *
+			 * @returns The bounding box, or an empty one at the origin if there are no vertices.
+			 */
+			static BoundingBox computeBoundingBox(const Vertex* vertices, size_t count);
+
 			/**
 			 * @brief Reset
 			 *
@@ -196,8 +322,15 @@ namespace bgq_opengl {
 			std::vector<Texture> textures;				/// Textures that will color this geometry.
 			VAO vao;									/// VAO containing this object.
 			std::vector<Vertex> vertices;				/// Geometry vertices.
+			size_t vertex_count = 0;					/// Number of vertices uploaded.
+			size_t index_count = 0;						/// Number of indices uploaded.
 			glm::mat4 transforms = glm::mat4(1.0f);		/// Tranform matrixes that will be passed to the shader.
             float shininess = 1.0;
+			BoundingBox bounding_box;					/// Bounding box of the vertices.
+			BoundingBox world_bounding_box;				/// Bounding box after the transforms.
+			bool world_dirty = true;					/// Whether the transforms changed since the world box was computed.
+			VertexFormat vertex_format;					/// Layout of the vertex buffer.
+			glm::vec3 color = glm::vec3(0.0f);			/// Color of the vertices, as the packed layouts do not store it.
 
 	};
 
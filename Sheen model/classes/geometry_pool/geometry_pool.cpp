@@ -0,0 +1,206 @@
+/**
+ * @file geometry_pool.cpp
+ * @brief Geometry pool class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "geometry_pool.h"
+
+#include <vector>
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+
+#include "classes/camera/camera.h"
+#include "classes/ebo/ebo.h"
+#include "classes/geometry/geometry.h"
+#include "classes/gl_state/gl_state.h"
+#include "classes/shader/shader.h"
+#include "classes/vbo/vbo.h"
+#include "classes/vertex_packer/vertex_packer.h"
+#include "structs/draw_block/draw_block.h"
+#include "structs/material_block/material_block.h"
+#include "structs/vertex/vertex.h"
+
+namespace bgq_opengl {
+
+	GeometryPool::GeometryPool(VertexFormat format, GLuint binding) : draw_block(sizeof(DrawBlock), binding) {
+
+		this->format = format;
+
+	}
+
+	int GeometryPool::add(Geometry &geometry) {
+
+		// The slots are limited by the draw block, and the vertices have to be read back.
+		if (this->ranges.size() >= DRAW_BLOCK_DRAWS || !geometry.hasVertices())
+			return -1;
+
+		int slot = (int) this->ranges.size();
+		const std::vector<Vertex>& vertices = geometry.getVertices();
+		const std::vector<GLuint>& indices = geometry.getIndices();
+
+		// The indices are kept as they are, the base vertex moves them to the geometry.
+		Range range;
+		range.index_count = (GLsizei) indices.size();
+		range.first_index = this->index_count;
+		range.base_vertex = (GLint) this->vertex_count;
+		this->ranges.push_back(range);
+
+		this->staged_vertices.insert(this->staged_vertices.end(), vertices.begin(), vertices.end());
+		this->staged_indices.insert(this->staged_indices.end(), indices.begin(), indices.end());
+		this->staged_slots.insert(this->staged_slots.end(), vertices.size(), (float) slot);
+
+		this->vertex_count += vertices.size();
+		this->index_count += indices.size();
+
+		return slot;
+
+	}
+
+	size_t GeometryPool::getIndexCount() {
+
+		return this->index_count;
+
+	}
+
+	size_t GeometryPool::getQueued() {
+
+		return this->counts.size();
+
+	}
+
+	size_t GeometryPool::getSize() {
+
+		return this->ranges.size();
+
+	}
+
+	size_t GeometryPool::getVertexCount() {
+
+		return this->vertex_count;
+
+	}
+
+	bool GeometryPool::hasIndirect() {
+
+		return GLEW_ARB_multi_draw_indirect != 0;
+
+	}
+
+	void GeometryPool::queue(int slot, const glm::mat4 &model, const MaterialBlock &material) {
+
+		const Range& range = this->ranges[slot];
+
+		this->draw_data.draws[slot].model = model;
+		this->draw_data.draws[slot].material = material;
+
+		this->counts.push_back(range.index_count);
+		this->offsets.push_back((const void*) (range.first_index * sizeof(GLuint)));
+		this->base_vertices.push_back(range.base_vertex);
+
+		IndirectCommand command;
+		command.count = (GLuint) range.index_count;
+		command.instance_count = 1;
+		command.first_index = (GLuint) range.first_index;
+		command.base_vertex = range.base_vertex;
+		command.base_instance = 0;
+		this->commands.push_back(command);
+
+	}
+
+	void GeometryPool::remove() {
+
+		this->vao.remove();
+		this->draw_block.remove();
+
+		if (this->indirect_buffer != 0)
+			glDeleteBuffers(1, &this->indirect_buffer);
+
+	}
+
+	size_t GeometryPool::submit(Shader &shader, Camera &camera) {
+
+		size_t draws = this->counts.size();
+
+		if (draws == 0)
+			return 0;
+
+		shader.activate();
+		shader.passCamera(camera);
+
+		// Only uploaded if a matrix or a material changed since the last submit.
+		this->draw_block.update(&this->draw_data);
+		this->draw_block.bind();
+
+		// The matrices and materials come from the block, which only the pooled permutations read.
+		const Shader::Builtins& builtins = shader.getBuiltins();
+		builtins.packed_vertices.set(this->format != VERTEX_FORMAT_FULL);
+
+		this->vao.bind();
+
+		if (GeometryPool::hasIndirect()) {
+
+			if (this->indirect_buffer == 0)
+				glGenBuffers(1, &this->indirect_buffer);
+
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, this->indirect_buffer);
+			glBufferData(GL_DRAW_INDIRECT_BUFFER, draws * sizeof(IndirectCommand), this->commands.data(), GL_STREAM_DRAW);
+			glMultiDrawElementsIndirect(GL_TRIANGLES, GL_UNSIGNED_INT, (void*)0, (GLsizei) draws, 0);
+			glBindBuffer(GL_DRAW_INDIRECT_BUFFER, 0);
+
+		} else {
+
+			glMultiDrawElementsBaseVertex(GL_TRIANGLES, this->counts.data(), GL_UNSIGNED_INT, this->offsets.data(), (GLsizei) draws, this->base_vertices.data());
+
+		}
+
+		GLState::countDraw((unsigned int) draws);
+
+		this->counts.clear();
+		this->offsets.clear();
+		this->base_vertices.clear();
+		this->commands.clear();
+
+		return draws;
+
+	}
+
+	void GeometryPool::upload() {
+
+		this->vao.bind();
+
+		// Pack them if they have to be, exactly as the geometries do.
+		std::vector<unsigned char> packed;
+
+		if (this->format != VERTEX_FORMAT_FULL)
+			VertexPacker::pack(this->staged_vertices.data(), this->staged_vertices.size(), this->format, &packed);
+
+		VBO vbo = this->format == VERTEX_FORMAT_FULL ? VBO(this->staged_vertices) : VBO(packed.data(), packed.size());
+		VBO slots(this->staged_slots.data(), this->staged_slots.size() * sizeof(float));
+		EBO ebo(this->staged_indices);
+
+		Geometry::linkAttributes(this->vao, vbo, this->format);
+		vao.link_attribute(slots, 12, 1, GL_FLOAT, sizeof(float), (void*)0);
+
+		this->vao.unbind();
+		vbo.unbind();
+		ebo.unbind();
+
+		// Swap them with empty ones, clear would keep the memory.
+		std::vector<Vertex>().swap(this->staged_vertices);
+		std::vector<GLuint>().swap(this->staged_indices);
+		std::vector<float>().swap(this->staged_slots);
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,201 @@
+/**
+ * @file geometry_pool.h
+ * @brief Geometry pool class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_GEOMETRY_POOL_H_
+#define BGQ_OPENGL_CLASSES_GEOMETRY_POOL_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+
+#include "classes/camera/camera.h"
+#include "classes/geometry/geometry.h"
+#include "classes/shader/shader.h"
+#include "classes/ubo/ubo.h"
+#include "classes/vao/vao.h"
+#include "structs/draw_block/draw_block.h"
+#include "structs/material_block/material_block.h"
+#include "structs/packed_vertex/packed_vertex.h"
+#include "structs/vertex/vertex.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a Geometry pool class.
+	 *
+	 * Implementation of a pool that sub-allocates many geometries into one
+	 * vertex buffer and one index buffer, each at its own base vertex, so
+	 * that a whole batch of them is drawn with a single multi-draw. The
+	 * matrix and material of each draw go in a DrawBlock indexed by the slot
+	 * of the geometry, which every vertex carries in location 12, as GLSL
+	 * 3.30 has no draw ID.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class GeometryPool {
+
+		public:
+
+			/**
+			 * @brief Initializes an empty pool.
+			 *
+			 * Initializes an empty pool and its draw block.
+			 *
+			 * @param format Layout the vertices are uploaded in.
+			 * @param binding Binding point of the draw block.
+			 */
+			GeometryPool(VertexFormat format, GLuint binding);
+
+			/**
+			 * @brief Adds a geometry to the pool.
+			 *
+			 * Copies the CPU copy of the vertices and indices of a geometry
+			 * into the pool. Nothing is uploaded until upload is called.
+			 *
+			 * @param geometry The geometry, which must still have its CPU copy.
+			 *
+			 * @returns The slot of the geometry, or -1 if the pool is full or it has no CPU copy.
+			 */
+			int add(Geometry &geometry);
+
+			/**
+			 * @brief Get the number of indices.
+			 *
+			 * Get the number of indices of all the geometries.
+			 */
+			size_t getIndexCount();
+
+			/**
+			 * @brief Get the number of draws queued.
+			 *
+			 * Get the number of draws queued since the last submit.
+			 */
+			size_t getQueued();
+
+			/**
+			 * @brief Get the number of geometries.
+			 *
+			 * Get the number of geometries in the pool.
+			 */
+			size_t getSize();
+
+			/**
+			 * @brief Get the number of vertices.
+			 *
+			 * Get the number of vertices of all the geometries.
+			 */
+			size_t getVertexCount();
+
+			/**
+			 * @brief Whether the draws go through an indirect buffer.
+			 *
+			 * Whether ARB_multi_draw_indirect is there, so that the command
+			 * list is uploaded and drawn with glMultiDrawElementsIndirect
+			 * instead of glMultiDrawElementsBaseVertex.
+			 *
+			 * @returns True if it is.
+			 */
+			static bool hasIndirect();
+
+			/**
+			 * @brief Queues a draw.
+			 *
+			 * Adds a geometry to the command list of the next submit, with its
+			 * matrix and material.
+			 *
+			 * @param slot The slot of the geometry.
+			 * @param model The model matrix.
+			 * @param material The material.
+			 */
+			void queue(int slot, const glm::mat4 &model, const MaterialBlock &material);
+
+			/**
+			 * @brief Removes the pool.
+			 *
+			 * Removes the VAO, the draw block and the command buffer from
+			 * OpenGL.
+			 */
+			void remove();
+
+			/**
+			 * @brief Draws the queued geometries.
+			 *
+			 * Draws all the geometries queued since the last submit in one
+			 * call, with the textures that are bound, and empties the list.
+			 * The shader has to read the draw block, as the POOLED permutations
+			 * of the LTC shaders do.
+			 *
+			 * @returns The number of geometries drawn.
+			 */
+			size_t submit(Shader &shader, Camera &camera);
+
+			/**
+			 * @brief Uploads the pool.
+			 *
+			 * Uploads all the geometries added into one vertex and one index
+			 * buffer, and frees the copies the pool kept of them.
+			 */
+			void upload();
+
+		private:
+
+			/**
+			 * @brief Where a geometry is in the buffers.
+			 */
+			struct Range {
+
+				GLsizei index_count = 0;	/// Number of indices.
+				size_t first_index = 0;		/// First index in the index buffer.
+				GLint base_vertex = 0;		/// First vertex in the vertex buffer.
+
+			};
+
+			/**
+			 * @brief A draw, as glMultiDrawElementsIndirect reads it.
+			 */
+			struct IndirectCommand {
+
+				GLuint count;				/// Number of indices.
+				GLuint instance_count;		/// Number of instances, always 1.
+				GLuint first_index;			/// First index in the index buffer.
+				GLint base_vertex;			/// First vertex in the vertex buffer.
+				GLuint base_instance;		/// First instance, always 0.
+
+			};
+
+			VertexFormat format;						/// Layout of the vertex buffer.
+			VAO vao;									/// VAO of the shared buffers.
+			UBO draw_block;								/// Matrix and material of every slot.
+			DrawBlock draw_data;						/// CPU copy of the draw block.
+			GLuint indirect_buffer = 0;					/// Buffer of commands, if there are indirect draws.
+			std::vector<Vertex> staged_vertices;		/// Vertices added but not uploaded yet.
+			std::vector<GLuint> staged_indices;			/// Indices added but not uploaded yet.
+			std::vector<float> staged_slots;			/// Slot of every vertex added but not uploaded yet.
+			std::vector<Range> ranges;					/// Where every slot is in the buffers.
+			size_t vertex_count = 0;					/// Number of vertices added.
+			size_t index_count = 0;						/// Number of indices added.
+			std::vector<GLsizei> counts;				/// Index count of every queued draw.
+			std::vector<const void*> offsets;			/// Byte offset of the first index of every queued draw.
+			std::vector<GLint> base_vertices;			/// Base vertex of every queued draw.
+			std::vector<IndirectCommand> commands;		/// The same draws, for the indirect path.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //! BGQ_OPENGL_CLASSES_GEOMETRY_POOL_H_
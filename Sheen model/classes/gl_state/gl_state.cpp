@@ -0,0 +1,181 @@
+/**
+ * @file gl_state.cpp
+ * @brief GL state cache implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "gl_state.h"
+
+#include <vector>
+
+#include "GL/glew.h"
+
+namespace bgq_opengl {
+
+    GLuint GLState::program = GLState::UNKNOWN;
+    GLuint GLState::vertex_array = GLState::UNKNOWN;
+    GLuint GLState::active_unit = GLState::UNKNOWN;
+    std::vector<GLuint> GLState::textures_2d;
+    std::vector<GLuint> GLState::textures_cube;
+    GLState::Stats GLState::stats;
+
+    void GLState::activeTexture(GLuint unit) {
+
+        // Skip it if the unit is already active.
+        if (GLState::active_unit == unit) {
+
+            GLState::stats.unit_skips++;
+            return;
+
+        }
+
+        glActiveTexture(GL_TEXTURE0 + unit);
+
+        GLState::active_unit = unit;
+        GLState::stats.unit_changes++;
+
+    }
+
+    void GLState::beginFrame() {
+
+        GLState::stats = Stats();
+
+    }
+
+    void GLState::bindTexture(GLenum target, GLuint unit, GLuint texture_id) {
+
+        // Skip it if the unit already holds the texture.
+        GLuint& bound = GLState::textureSlot(target, unit);
+
+        if (bound == texture_id) {
+
+            GLState::stats.texture_skips++;
+            return;
+
+        }
+
+        // Activate the unit and bind the texture to it.
+        GLState::activeTexture(unit);
+        glBindTexture(target, texture_id);
+
+        bound = texture_id;
+        GLState::stats.texture_binds++;
+
+    }
+
+    void GLState::bindVertexArray(GLuint vao_id) {
+
+        // Skip it if the VAO is already bound.
+        if (GLState::vertex_array == vao_id) {
+
+            GLState::stats.vao_skips++;
+            return;
+
+        }
+
+        glBindVertexArray(vao_id);
+
+        GLState::vertex_array = vao_id;
+        GLState::stats.vao_binds++;
+
+    }
+
+    void GLState::countDraw(unsigned int draws) {
+
+        GLState::stats.draw_calls++;
+        GLState::stats.draws += draws;
+
+    }
+
+    void GLState::countUniforms(unsigned int uploads, unsigned int skips) {
+
+        GLState::stats.uniform_uploads += uploads;
+        GLState::stats.uniform_skips += skips;
+
+    }
+
+    void GLState::forgetProgram(GLuint program_id) {
+
+        // GL stops using a deleted program only once another one is used, so
+        // the safe thing is to issue the next call whatever it is.
+        if (GLState::program == program_id)
+            GLState::program = GLState::UNKNOWN;
+
+    }
+
+    void GLState::forgetTexture(GLuint texture_id) {
+
+        // Deleting a texture unbinds it from every unit.
+        for (size_t i = 0; i < GLState::textures_2d.size(); i++)
+            if (GLState::textures_2d[i] == texture_id)
+                GLState::textures_2d[i] = 0;
+
+        for (size_t i = 0; i < GLState::textures_cube.size(); i++)
+            if (GLState::textures_cube[i] == texture_id)
+                GLState::textures_cube[i] = 0;
+
+    }
+
+    void GLState::forgetVertexArray(GLuint vao_id) {
+
+        // Deleting the bound VAO binds 0.
+        if (GLState::vertex_array == vao_id)
+            GLState::vertex_array = 0;
+
+    }
+
+    const GLState::Stats& GLState::getStats() {
+
+        return GLState::stats;
+
+    }
+
+    void GLState::invalidate() {
+
+        GLState::program = GLState::UNKNOWN;
+        GLState::vertex_array = GLState::UNKNOWN;
+        GLState::active_unit = GLState::UNKNOWN;
+        GLState::textures_2d.clear();
+        GLState::textures_cube.clear();
+
+    }
+
+    void GLState::useProgram(GLuint program_id) {
+
+        // Skip it if the program is already in use.
+        if (GLState::program == program_id) {
+
+            GLState::stats.program_skips++;
+            return;
+
+        }
+
+        glUseProgram(program_id);
+
+        GLState::program = program_id;
+        GLState::stats.program_binds++;
+
+    }
+
+    GLuint& GLState::textureSlot(GLenum target, GLuint unit) {
+
+        std::vector<GLuint>& table = target == GL_TEXTURE_CUBE_MAP ? GLState::textures_cube : GLState::textures_2d;
+
+        // Units that were never used are unknown.
+        if (unit >= table.size())
+            table.resize(unit + 1, GLState::UNKNOWN);
+
+        return table[unit];
+
+    }
+
+}  // namespace bgq_opengl
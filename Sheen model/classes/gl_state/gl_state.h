@@ -0,0 +1,202 @@
+/**
+ * @file gl_state.h
+ * @brief GL state cache header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_GL_STATE_H_
+#define BGQ_OPENGL_CLASSES_GL_STATE_H_
+
+#include <vector>
+
+#include "GL/glew.h"
+
+namespace bgq_opengl {
+
+    /**
+     * @brief Implements a cache of the GL binding state.
+     *
+     * Implements a shadow copy of the bound program, VAO, active texture unit
+     * and the textures bound to every unit, so the wrappers can drop the calls
+     * that would not change anything. There is a single GL context, so the
+     * state is static. Anything that binds behind its back has to call
+     * invalidate() afterwards.
+     *
+     * @author Borja García Quiroga <garcaqub@tcd.ie>
+     */
+    class GLState {
+
+    public:
+
+        /**
+         * @brief Counters of the calls issued and avoided.
+         *
+         * Counters of the calls that reached the driver and the ones that
+         * were dropped because they would not change the state.
+         */
+        struct Stats {
+
+            unsigned int program_binds = 0;     /// glUseProgram calls issued.
+            unsigned int program_skips = 0;     /// glUseProgram calls avoided.
+            unsigned int vao_binds = 0;         /// glBindVertexArray calls issued.
+            unsigned int vao_skips = 0;         /// glBindVertexArray calls avoided.
+            unsigned int unit_changes = 0;      /// glActiveTexture calls issued.
+            unsigned int unit_skips = 0;        /// glActiveTexture calls avoided.
+            unsigned int texture_binds = 0;     /// glBindTexture calls issued.
+            unsigned int texture_skips = 0;     /// glBindTexture calls avoided.
+            unsigned int uniform_uploads = 0;   /// Per-draw uniforms uploaded.
+            unsigned int uniform_skips = 0;     /// Per-draw uniforms that already held their value.
+            unsigned int draw_calls = 0;        /// Draw calls issued, a multi-draw counting as one.
+            unsigned int draws = 0;             /// Geometries and instances those calls drew.
+
+        };
+
+        /**
+         * @brief Activate the texture unit.
+         *
+         * Make a texture unit the active one unless it already is.
+         *
+         * @param unit The texture unit, starting from 0.
+         */
+        static void activeTexture(GLuint unit);
+
+        /**
+         * @brief Start counting a new frame.
+         *
+         * Reset the statistics, usually at the start of a frame.
+         */
+        static void beginFrame();
+
+        /**
+         * @brief Bind a texture to a unit.
+         *
+         * Bind a texture to a target of a texture unit unless it is already
+         * bound there. Leaves the unit active.
+         *
+         * @param target The texture target, GL_TEXTURE_2D or GL_TEXTURE_CUBE_MAP.
+         * @param unit The texture unit, starting from 0.
+         * @param texture_id The OpenGL ID of the texture, or 0 to unbind.
+         */
+        static void bindTexture(GLenum target, GLuint unit, GLuint texture_id);
+
+        /**
+         * @brief Bind a VAO.
+         *
+         * Bind a vertex array object unless it is already bound.
+         *
+         * @param vao_id The OpenGL ID of the VAO, or 0 to unbind.
+         */
+        static void bindVertexArray(GLuint vao_id);
+
+        /**
+         * @brief Forget a deleted program.
+         *
+         * Forget a program that is about to be deleted, so a new one that
+         * reuses its ID is not taken as bound.
+         *
+         * @param program_id The OpenGL ID of the program.
+         */
+        static void forgetProgram(GLuint program_id);
+
+        /**
+         * @brief Forget a deleted texture.
+         *
+         * Forget a texture that is about to be deleted from every unit.
+         *
+         * @param texture_id The OpenGL ID of the texture.
+         */
+        static void forgetTexture(GLuint texture_id);
+
+        /**
+         * @brief Forget a deleted VAO.
+         *
+         * Forget a vertex array object that is about to be deleted.
+         *
+         * @param vao_id The OpenGL ID of the VAO.
+         */
+        static void forgetVertexArray(GLuint vao_id);
+
+        /**
+         * @brief Get the statistics.
+         *
+         * Get the calls issued and avoided since the last beginFrame().
+         *
+         * @returns The statistics.
+         */
+        static const Stats& getStats();
+
+        /**
+         * @brief Forget the whole state.
+         *
+         * Forget the whole state, so the next call of each kind reaches the
+         * driver. Needed after code that binds without going through here.
+         */
+        static void invalidate();
+
+        /**
+         * @brief Count a draw call.
+         *
+         * Count a draw call and how many geometries or instances it drew.
+         *
+         * @param draws Geometries or instances drawn by the call.
+         */
+        static void countDraw(unsigned int draws);
+
+        /**
+         * @brief Count per-draw uniform uploads.
+         *
+         * Count the per-draw uniforms that were uploaded and the ones that
+         * were skipped because the program already held their value.
+         *
+         * @param uploads Uniforms uploaded.
+         * @param skips Uniforms skipped.
+         */
+        static void countUniforms(unsigned int uploads, unsigned int skips);
+
+        /**
+         * @brief Use a program.
+         *
+         * Make a program the active one unless it already is.
+         *
+         * @param program_id The OpenGL ID of the program, or 0 to use none.
+         */
+        static void useProgram(GLuint program_id);
+
+    private:
+
+        /**
+         * @brief Get the shadow binding of a texture target.
+         *
+         * Get the shadow binding of a texture target in a unit, growing the
+         * tables if the unit was never used.
+         *
+         * @param target The texture target.
+         * @param unit The texture unit.
+         *
+         * @returns A reference to the cached ID.
+         */
+        static GLuint& textureSlot(GLenum target, GLuint unit);
+
+        static constexpr GLuint UNKNOWN = 0xFFFFFFFF; /// Value of the entries that have to be re-issued.
+
+        static GLuint program;                      /// Program in use.
+        static GLuint vertex_array;                 /// VAO bound.
+        static GLuint active_unit;                  /// Active texture unit.
+        static std::vector<GLuint> textures_2d;     /// 2D texture bound to every unit.
+        static std::vector<GLuint> textures_cube;   /// Cubemap bound to every unit.
+        static Stats stats;                         /// Counters since the last frame started.
+
+    };
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_GL_STATE_H_
@@ -0,0 +1,306 @@
+/**
+ * @file gpu_profiler.cpp
+ * @brief GPU profiler class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "gpu_profiler.h"
+
+#include <assert.h>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+
+#include "classes/json/json.h"
+
+namespace bgq_opengl {
+
+	GPUProfiler::GPUProfiler(int ring_size, size_t history) {
+
+		// Store the parameters.
+		this->slots = std::vector<Slot>(std::max(ring_size, 2));
+		this->history = std::max(history, (size_t) 1);
+		this->frame.name = "Frame";
+
+	}
+
+	void GPUProfiler::addSample(Pass& pass, double ms) {
+
+		if (pass.samples.size() < this->history) {
+
+			pass.samples.push_back(ms);
+
+		} else {
+
+			pass.samples[pass.next] = ms;
+
+		}
+
+		pass.next = (pass.next + 1) % this->history;
+
+	}
+
+	void GPUProfiler::beginFrame() {
+
+		assert(!this->timing);
+
+		this->current = (this->current + 1) % (int) this->slots.size();
+
+		// This slot was issued a whole ring ago, so its results should be there.
+		Slot& slot = this->slots[this->current];
+		this->collect(slot);
+		slot.passes.clear();
+
+	}
+
+	void GPUProfiler::beginPass(const std::string& name) {
+
+		assert(this->current >= 0 && !this->timing);
+
+		// Look the pass up, adding it if it is new.
+		std::map<std::string, int>::iterator it = this->indices.find(name);
+		int pass;
+
+		if (it == this->indices.end()) {
+
+			pass = (int) this->passes.size();
+			this->indices[name] = pass;
+			this->passes.push_back(Pass());
+			this->passes.back().name = name;
+
+		} else {
+
+			pass = it->second;
+
+		}
+
+		// Create a query if the slot has never had this many.
+		Slot& slot = this->slots[this->current];
+
+		if (slot.passes.size() == slot.queries.size()) {
+
+			GLuint query;
+			glGenQueries(1, &query);
+			slot.queries.push_back(query);
+
+		}
+
+		glBeginQuery(GL_TIME_ELAPSED, slot.queries[slot.passes.size()]);
+		slot.passes.push_back(pass);
+		slot.pending = true;
+		this->timing = true;
+
+	}
+
+	void GPUProfiler::collect(Slot& slot) {
+
+		if (!slot.pending)
+			return;
+
+		slot.pending = false;
+
+		if (slot.passes.empty())
+			return;
+
+		// The queries finish in order, so if the last one is there all of them are.
+		GLint available = 0;
+		glGetQueryObjectiv(slot.queries[slot.passes.size() - 1], GL_QUERY_RESULT_AVAILABLE, &available);
+
+		if (!available) {
+
+			this->dropped++;
+			return;
+
+		}
+
+		// Add up the passes with the same name.
+		std::vector<double> times(this->passes.size(), -1.0);
+		double total = 0.0;
+
+		for (size_t i = 0; i < slot.passes.size(); i++) {
+
+			GLuint64 ns = 0;
+			glGetQueryObjectui64v(slot.queries[i], GL_QUERY_RESULT, &ns);
+
+			double ms = ns / 1000000.0;
+			double& time = times[slot.passes[i]];
+			time = time < 0.0 ? ms : time + ms;
+			total += ms;
+
+		}
+
+		for (size_t i = 0; i < times.size(); i++)
+			if (times[i] >= 0.0)
+				this->addSample(this->passes[i], times[i]);
+
+		this->addSample(this->frame, total);
+
+	}
+
+	void GPUProfiler::endPass() {
+
+		assert(this->timing);
+
+		glEndQuery(GL_TIME_ELAPSED);
+		this->timing = false;
+
+	}
+
+	unsigned int GPUProfiler::getDropped() {
+
+		return this->dropped;
+
+	}
+
+	std::vector<GPUProfiler::PassStats> GPUProfiler::getStats() {
+
+		std::vector<PassStats> stats;
+
+		for (size_t i = 0; i < this->passes.size(); i++)
+			stats.push_back(this->getStats(this->passes[i]));
+
+		stats.push_back(this->getStats(this->frame));
+
+		return stats;
+
+	}
+
+	GPUProfiler::PassStats GPUProfiler::getStats(const Pass& pass) {
+
+		PassStats stats;
+		stats.name = pass.name;
+		stats.samples = pass.samples.size();
+
+		if (pass.samples.empty())
+			return stats;
+
+		stats.last = pass.samples[(pass.next + this->history - 1) % this->history];
+
+		// Sort a copy, the ring has to keep its order.
+		std::vector<double> sorted(pass.samples);
+		std::sort(sorted.begin(), sorted.end());
+
+		double sum = 0.0;
+		for (size_t i = 0; i < sorted.size(); i++)
+			sum += sorted[i];
+
+		stats.min = sorted.front();
+		stats.avg = sum / sorted.size();
+		stats.p99 = sorted[std::min(sorted.size() - 1, (size_t) (0.99 * sorted.size()))];
+
+		return stats;
+
+	}
+
+	void GPUProfiler::remove() {
+
+		for (size_t i = 0; i < this->slots.size(); i++) {
+
+			if (!this->slots[i].queries.empty())
+				glDeleteQueries((GLsizei) this->slots[i].queries.size(), this->slots[i].queries.data());
+
+			this->slots[i].queries.clear();
+			this->slots[i].passes.clear();
+			this->slots[i].pending = false;
+
+		}
+
+	}
+
+	void GPUProfiler::reset() {
+
+		for (size_t i = 0; i < this->passes.size(); i++) {
+
+			this->passes[i].samples.clear();
+			this->passes[i].next = 0;
+
+		}
+
+		this->frame.samples.clear();
+		this->frame.next = 0;
+		this->dropped = 0;
+
+		// The frames in flight belong to what came before, the current one included.
+		for (size_t i = 0; i < this->slots.size(); i++) {
+
+			this->slots[i].passes.clear();
+			this->slots[i].pending = false;
+
+		}
+
+	}
+
+	bool GPUProfiler::writeCSV(const std::string& filename) {
+
+		std::ofstream file(filename);
+		if (!file)
+			return false;
+
+		std::vector<PassStats> stats = this->getStats();
+
+		file << "pass,samples,last_ms,min_ms,avg_ms,p99_ms" << std::endl;
+
+		for (size_t i = 0; i < stats.size(); i++)
+			file << "\"" << stats[i].name << "\"," << stats[i].samples << "," << stats[i].last << "," << stats[i].min << "," << stats[i].avg << "," << stats[i].p99 << std::endl;
+
+		return (bool) file;
+
+	}
+
+	bool GPUProfiler::writeJSON(const std::string& filename) {
+
+		std::ofstream file(filename);
+		if (!file)
+			return false;
+
+		std::vector<PassStats> stats = this->getStats();
+
+		file << "{" << std::endl;
+		file << "  \"dropped_frames\": " << this->dropped << "," << std::endl;
+		file << "  \"passes\": [" << std::endl;
+
+		for (size_t i = 0; i < stats.size(); i++) {
+
+			// The frame is the last one, and it is not in passes.
+			const Pass& pass = i < this->passes.size() ? this->passes[i] : this->frame;
+
+			file << "    {\"name\": ";
+			JSON::writeString(file, stats[i].name);
+			file << ", \"samples\": " << stats[i].samples;
+			file << ", \"last_ms\": " << stats[i].last << ", \"min_ms\": " << stats[i].min;
+			file << ", \"avg_ms\": " << stats[i].avg << ", \"p99_ms\": " << stats[i].p99 << ", \"history_ms\": [";
+
+			// The samples go oldest first.
+			for (size_t j = 0; j < pass.samples.size(); j++) {
+
+				size_t k = pass.samples.size() < this->history ? j : (pass.next + j) % this->history;
+				file << (j > 0 ? ", " : "") << pass.samples[k];
+
+			}
+
+			file << "]}" << (i + 1 < stats.size() ? "," : "") << std::endl;
+
+		}
+
+		file << "  ]" << std::endl;
+		file << "}" << std::endl;
+
+		return (bool) file;
+
+	}
+
+}  // namespace bgq_opengl
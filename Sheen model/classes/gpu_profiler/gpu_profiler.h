@@ -0,0 +1,213 @@
+/**
+ * @file gpu_profiler.h
+ * @brief GPU profiler class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_GPU_PROFILER_H_
+#define BGQ_OPENGL_CLASS_GPU_PROFILER_H_
+
+#include <stddef.h>
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a GPU profiler.
+	 *
+	 * Implementation of a profiler that wraps the passes of a frame in
+	 * GL_TIME_ELAPSED queries. Every frame issues its queries in the next
+	 * slot of a ring, and a slot is only read back when it comes round
+	 * again, so the CPU never waits for the GPU. Results that are still not
+	 * there by then are dropped. The last samples of every pass are kept to
+	 * give its minimum, average and 99th percentile.
+	 *
+	 * Time elapsed queries cannot be nested, so the passes of a frame must
+	 * not overlap.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class GPUProfiler {
+
+	public:
+
+		/**
+		 * @brief Statistics of a pass.
+		 *
+		 * Statistics of the GPU time of a pass over the samples kept, in
+		 * milliseconds.
+		 */
+		struct PassStats {
+
+			std::string name;			/// Name of the pass.
+			size_t samples = 0;			/// Number of samples kept.
+			double last = 0.0;			/// Last sample.
+			double min = 0.0;			/// Shortest sample.
+			double avg = 0.0;			/// Mean of the samples.
+			double p99 = 0.0;			/// 99th percentile of the samples.
+
+		};
+
+		/**
+		 * @brief Constructs a GPU profiler.
+		 *
+		 * Constructs a GPU profiler. The queries are created as the passes
+		 * need them.
+		 *
+		 * @param ring_size Number of frames that can be in flight, at least 2.
+		 * @param history Number of samples kept for every pass.
+		 */
+		GPUProfiler(int ring_size, size_t history);
+
+		/**
+		 * @brief Starts a frame.
+		 *
+		 * Reads back the results of the slot the frame is going to use, if
+		 * they are there, and clears it for the new queries.
+		 */
+		void beginFrame();
+
+		/**
+		 * @brief Starts timing a pass.
+		 *
+		 * Starts timing a pass of the current frame. Passes with the same
+		 * name are added up within a frame.
+		 *
+		 * @param name The name of the pass.
+		 */
+		void beginPass(const std::string& name);
+
+		/**
+		 * @brief Stops timing the pass.
+		 *
+		 * Stops timing the pass started last.
+		 */
+		void endPass();
+
+		/**
+		 * @brief Get the number of frames dropped.
+		 *
+		 * Get the number of frames whose results were not there when their
+		 * slot was needed again.
+		 *
+		 * @returns The number of frames dropped.
+		 */
+		unsigned int getDropped();
+
+		/**
+		 * @brief Get the statistics of every pass.
+		 *
+		 * Get the statistics of every pass, in the order they were first
+		 * seen, followed by the whole frame.
+		 *
+		 * @returns The statistics.
+		 */
+		std::vector<PassStats> getStats();
+
+		/**
+		 * @brief Removes the profiler.
+		 *
+		 * Removes the queries from OpenGL.
+		 */
+		void remove();
+
+		/**
+		 * @brief Forgets the samples.
+		 *
+		 * Forgets the samples of every pass, so that the statistics only
+		 * cover what comes next. The queries in flight, and the ones the
+		 * current frame already issued, are dropped.
+		 */
+		void reset();
+
+		/**
+		 * @brief Writes the statistics as CSV.
+		 *
+		 * Writes the statistics of every pass as CSV, one row per pass.
+		 *
+		 * @param filename The file to write.
+		 *
+		 * @returns True if it was written.
+		 */
+		bool writeCSV(const std::string& filename);
+
+		/**
+		 * @brief Writes the statistics as JSON.
+		 *
+		 * Writes the statistics and the samples of every pass as JSON.
+		 *
+		 * @param filename The file to write.
+		 *
+		 * @returns True if it was written.
+		 */
+		bool writeJSON(const std::string& filename);
+
+	private:
+
+		/**
+		 * @brief A frame of the ring.
+		 *
+		 * The queries of a frame and the pass each one timed.
+		 */
+		struct Slot {
+
+			std::vector<GLuint> queries;	/// GL IDs of the queries, reused from frame to frame.
+			std::vector<int> passes;		/// Pass timed by each query issued.
+			bool pending = false;			/// Whether it holds results not read yet.
+
+		};
+
+		/**
+		 * @brief The samples of a pass.
+		 */
+		struct Pass {
+
+			std::string name;				/// Name of the pass.
+			std::vector<double> samples;	/// Last samples in milliseconds, as a ring.
+			size_t next = 0;				/// Where the next sample goes.
+
+		};
+
+		/**
+		 * Reads back the results of a slot if all of them are there.
+		 */
+		void collect(Slot& slot);
+
+		/**
+		 * Adds a sample to a pass.
+		 */
+		void addSample(Pass& pass, double ms);
+
+		/**
+		 * Gets the statistics of a pass.
+		 */
+		PassStats getStats(const Pass& pass);
+
+		std::vector<Slot> slots;				/// The ring of frames.
+		std::vector<Pass> passes;				/// Every pass seen.
+		std::map<std::string, int> indices;		/// Index of every pass by name.
+		Pass frame;								/// The whole frame, as the sum of its passes.
+		size_t history;							/// Number of samples kept for every pass.
+		int current = -1;						/// Slot of the current frame.
+		bool timing = false;					/// Whether a pass is being timed.
+		unsigned int dropped = 0;				/// Frames whose results were not there in time.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_GPU_PROFILER_H_
@@ -0,0 +1,54 @@
+/**
+ * @file hash.cpp
+ * @brief Hash class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "hash.h"
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+namespace bgq_opengl {
+
+	namespace {
+
+		const uint64_t FNV_OFFSET = 14695981039346656037ULL;	// 64-bit FNV offset basis.
+		const uint64_t FNV_PRIME = 1099511628211ULL;			// 64-bit FNV prime.
+
+	}  // namespace
+
+	uint64_t Hash::fnv1a(const unsigned char* data, size_t size) {
+
+		uint64_t hash = FNV_OFFSET;
+		size_t i = 0;
+
+		// Mix whole words first, which is much faster than a byte at a time on large files.
+		for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+
+			uint64_t word;
+			memcpy(&word, data + i, sizeof(word));
+
+			hash = (hash ^ word) * FNV_PRIME;
+
+		}
+
+		// Then the bytes left.
+		for (; i < size; i++)
+			hash = (hash ^ data[i]) * FNV_PRIME;
+
+		return hash;
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,53 @@
+/**
+ * @file hash.h
+ * @brief Hash class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_HASH_H_
+#define BGQ_OPENGL_CLASS_HASH_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Hash shared by the binary caches.
+	 *
+	 * Hash the mesh and program caches key their files with, and check
+	 * their contents against. It is not cryptographic, it only tells a
+	 * stale or corrupted cache.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class Hash {
+
+	public:
+
+		/**
+		 * @brief Hashes some bytes.
+		 *
+		 * Hashes some bytes with 64-bit FNV-1a, a word at a time.
+		 *
+		 * @param data The bytes.
+		 * @param size Number of bytes.
+		 *
+		 * @returns The hash.
+		 */
+		static uint64_t fnv1a(const unsigned char* data, size_t size);
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_HASH_H_
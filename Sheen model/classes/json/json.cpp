@@ -0,0 +1,56 @@
+/**
+ * @file json.cpp
+ * @brief JSON class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "json.h"
+
+#include <stdio.h>
+
+#include <ostream>
+#include <string>
+
+namespace bgq_opengl {
+
+	void JSON::writeString(std::ostream& out, const std::string& str) {
+
+		out << '"';
+
+		for (size_t i = 0; i < str.size(); i++) {
+
+			unsigned char c = (unsigned char) str[i];
+
+			if (c == '"' || c == '\\') {
+
+				out << '\\' << str[i];
+
+			} else if (c < 0x20) {
+
+				// Control characters are not allowed raw in a string.
+				char escaped[7];
+				snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+				out << escaped;
+
+			} else {
+
+				out << str[i];
+
+			}
+
+		}
+
+		out << '"';
+
+	}
+
+}  // namespace bgq_opengl
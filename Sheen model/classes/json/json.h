@@ -0,0 +1,52 @@
+/**
+ * @file json.h
+ * @brief JSON class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_JSON_H_
+#define BGQ_OPENGL_CLASS_JSON_H_
+
+#include <ostream>
+#include <string>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Helpers to write JSON.
+	 *
+	 * Helpers shared by the profilers and the bench to write the parts of
+	 * their JSON output that come from outside, such as file names and
+	 * driver strings.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class JSON {
+
+	public:
+
+		/**
+		 * @brief Writes a string.
+		 *
+		 * Writes a string in quotes, escaping the quotes, the backslashes
+		 * and the control characters in it.
+		 *
+		 * @param out The stream to write to.
+		 * @param str The string.
+		 */
+		static void writeString(std::ostream& out, const std::string& str);
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_JSON_H_
@@ -28,7 +28,12 @@ namespace bgq_opengl {
 
 	}
 
-    inline void Loader::loadModel() {}
+	void Loader::loadModel() {
+
+		this->importModel();
+		this->uploadModel();
+
+	}
 
 	std::string Loader::readFileContents(const char* filename) {
 
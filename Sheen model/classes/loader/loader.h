@@ -51,19 +51,36 @@ namespace bgq_opengl {
 			/**
 			 * @brief Get the geometries from the loaded model.
 			 *
-			 * Get the geometries from the loaded model.
+			 * Get the geometries from the loaded model. They are moved out, not
+			 * copied, so the loader does not have them anymore.
 			 *
 			 * @param geoms Outputs the geometries returned.
 			 * @param matrices Outputs the transformation matrices.
 			 */
 			virtual void getGeometries(std::vector<Geometry> *geoms, std::vector<glm::mat4> *matrices) = 0;
 
+			/**
+			 * @brief Imports the data from the file.
+			 *
+			 * Reads the file and converts it to what the geometries are built
+			 * from. It does not touch OpenGL, so it can run on any thread.
+			 */
+			virtual void importModel() = 0;
+
 			/**
 			 * @brief Loads the data from the file.
 			 * 
-			 * Loads the data from the file.
+			 * Loads the data from the file: imports it and uploads it.
+			 */
+			virtual void loadModel();
+
+			/**
+			 * @brief Uploads the imported data.
+			 *
+			 * Builds the geometries from the imported data. It has to run on
+			 * the thread that owns the OpenGL context, after importModel.
 			 */
-			virtual void loadModel() = 0;
+			virtual void uploadModel() = 0;
 
 			/**
 			 * @brief Gets the content of a file as a string.
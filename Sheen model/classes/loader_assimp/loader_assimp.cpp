@@ -18,6 +18,7 @@
 
 #include <vector>
 #include <iostream>
+#include <utility>
 
 #include "glm/glm.hpp"
 #include "glm/gtc/type_ptr.hpp"
@@ -25,16 +26,35 @@
 #include "assimp/scene.h"
 #include "assimp/postprocess.h"
 
+#include "classes/cpu_profiler/cpu_profiler.h"
+#include "classes/mesh_cache/mesh_cache.h"
+#include "classes/mesh_converter/mesh_converter.h"
+#include "structs/mesh_data/mesh_data.h"
+#include "structs/packed_vertex/packed_vertex.h"
 #include "structs/vertex/vertex.h"
 
 namespace bgq_opengl {
 
-	LoaderAssimp::LoaderAssimp(const char* filename) : Loader(filename) {}
+    namespace {
 
-	void LoaderAssimp::loadModel() {
+        const unsigned int IMPORT_FLAGS = aiProcess_Triangulate | aiProcess_PreTransformVertices;   // Post-processing every model is imported with.
+
+    }  // namespace
+
+	LoaderAssimp::LoaderAssimp(const char* filename, VertexFormat format, bool keep_vertices, bool upload) : Loader(filename), format(format), keep_vertices(keep_vertices), upload(upload) {}
+
+	void LoaderAssimp::importModel() {
+
+        PROFILE_ZONE("LoaderAssimp::importModel");
+        
+        // Use the mesh cache if there is one for this same file and flags, and skip the import altogether.
+        this->cache.reset(new MeshCache(filename, IMPORT_FLAGS));
+        
+        if (this->cache->isValid())
+            return;
         
         // Import the scene from the file.
-        const aiScene* scene = aiImportFile(filename, aiProcess_Triangulate | aiProcess_PreTransformVertices);
+        const aiScene* scene = aiImportFile(filename, IMPORT_FLAGS);
 
         // Check if the scene was not read correctly.
         if (!scene) {
@@ -44,13 +64,13 @@ namespace bgq_opengl {
             
         }
 
-        // Print info from the scene.
-        std::cerr << "  " << filename << std::endl;
-        std::cerr << "  " << scene->mNumMaterials << " materials" << std::endl;
-        std::cerr << "  " << scene->mNumMeshes << " meshes" << std::endl;
-        std::cerr << "  " << scene->mNumTextures << " textures" << std::endl;
+        // Keep the info from the scene, it is printed when uploading.
+        this->scene_materials = scene->mNumMaterials;
+        this->scene_textures = scene->mNumTextures;
         
         // Loop through the different meshes in the scene.
+        this->meshes.reserve(scene->mNumMeshes);
+        
         for (unsigned int i = 0; i < scene->mNumMeshes; i++) {
             
             // Get the mesh itself.
@@ -62,97 +82,56 @@ namespace bgq_opengl {
         }
 
         aiReleaseImport(scene);
+        
+        // Write the cache, so the next run does not import it again.
+        this->cache->write(this->meshes);
+        this->cache->remove();
 
 	}
 
-	void LoaderAssimp::loadGeometry(const aiScene* scene, const aiMesh* mesh) {
-        
-        // Init the ds.
-        std::vector<bgq_opengl::Vertex> vertices(0);
-        std::vector<GLuint> indices(0);
-        
-        // If has materials, pass them.
-        aiMaterial *mat = scene->mMaterials[mesh->mMaterialIndex];
-        aiColor3D color;
-        mat->Get(AI_MATKEY_COLOR_DIFFUSE, color);
-        float shine = 0.0;
-        mat->Get(AI_MATKEY_SHININESS, shine);
+	void LoaderAssimp::uploadModel() {
+
+        PROFILE_ZONE("LoaderAssimp::uploadModel");
         
-        // Iterate through the vertices in the mesh.
-        for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
+        // Build the geometries straight from the mapped cache.
+        if (this->cache->isValid()) {
             
-            // Build an empty vertex.
-            bgq_opengl::Vertex vertex{
-                glm::vec3(0.0f, 0.0f, 0.0f),    // Position.
-                glm::vec3(1.0f, 1.0f, 1.0f),    // Normal.
-                glm::vec3(0.0f, 0.0f, 1.0f),    // Color.
-                glm::vec2(0.0f, 0.0f),          // UV coords.
-                glm::vec3(0.0f, 1.0f, 0.0f),    // Tangente.
-                glm::vec3(1.0f, 0.0f, 0.0f)     // Bitangente.
-            };
+            this->cache->getGeometries(&this->geometries, this->format, this->keep_vertices, this->upload);
+            this->cache->remove();
             
-            // If it has a position, subtitute it in the vertex.
-            if (mesh->HasPositions()) {
-                
-                const aiVector3D* vp = &(mesh->mVertices[i]);
-                vertex.position = glm::vec3(vp->x, vp->y, vp->z);
-                
-            }
+            std::cerr << "  " << filename << " (mesh cache)" << std::endl;
+            std::cerr << "  " << this->geometries.size() << " meshes" << std::endl;
             
-            vertex.color = glm::vec3(color.r, color.g, color.b);
+            return;
             
-            // If it has a normal, subtitute it in the vertex.
-            if (mesh->HasNormals()) {
-                
-                const aiVector3D* vn = &(mesh->mNormals[i]);
-                vertex.normal = glm::vec3(vn->x, vn->y, vn->z);
-                
-            }
-            
-            // If it has UV textures, subtitute it in the vertex.
-            if (mesh->HasTextureCoords(0)) {
-                                
-                const aiVector3D* vt = &(mesh->mTextureCoords[0][i]);
-                vertex.uv = glm::vec2(-vt->y, vt->x);
-                
-            }
+        }
+        
+        // Print info from the scene.
+        std::cerr << "  " << filename << std::endl;
+        std::cerr << "  " << this->scene_materials << " materials" << std::endl;
+        std::cerr << "  " << this->meshes.size() << " meshes" << std::endl;
+        std::cerr << "  " << this->scene_textures << " textures" << std::endl;
+        
+        // Create a Geometry object for each mesh, and let go of the imported copies.
+        for (size_t i = 0; i < this->meshes.size(); i++) {
             
-            // Check if it has tangents.
-            if (mesh->HasTangentsAndBitangents()) {
-                
-                const aiVector3D* tangent = &(mesh->mTangents[i]);
-                vertex.tangent = glm::vec3(tangent->x, tangent->y, tangent->z);
-                
-                const aiVector3D* bitangent = &(mesh->mBitangents[i]);
-                vertex.bitangent = glm::vec3(bitangent->x, bitangent->y, bitangent->z);
-                
-                std::cerr << "YESE" << std::endl;
-                                
-            } else {
-                
-                std::cerr << "NOSE" << std::endl;
-                
-            }
+            const MeshData& mesh = this->meshes[i];
+            this->geometries.push_back(bgq_opengl::Geometry(mesh.vertices.data(), mesh.vertices.size(), mesh.indices.data(), mesh.indices.size(), getTextures(), mesh.shininess, mesh.bounding_box, this->format, this->keep_vertices, this->upload));
             
-            // Add that to vertices.
-            vertices.push_back(vertex);
-
         }
         
-        // Lets store all the indices or faces.
-        for (unsigned int j = 0; j < mesh->mNumFaces; j++) {
-            
-            indices.push_back(mesh->mFaces[j].mIndices[0]);
-            indices.push_back(mesh->mFaces[j].mIndices[1]);
-            indices.push_back(mesh->mFaces[j].mIndices[2]);
+        this->meshes.clear();
+        this->meshes.shrink_to_fit();
         
-        }
+	}
 
-		// Obtain the textures.
-		std::vector<bgq_opengl::Texture> textures = getTextures();
+	void LoaderAssimp::loadGeometry(const aiScene* scene, const aiMesh* mesh) {
+        
+        // Convert the whole mesh at once, it is kept until it is uploaded.
+        MeshData data;
+        MeshConverter::convert(scene, mesh, &data);
 
-		// Create a Geometry object that contains all this data.
-		this->geometries.push_back(bgq_opengl::Geometry(vertices, indices, textures, shine));
+		this->meshes.push_back(std::move(data));
 
 	}
 
@@ -177,8 +156,12 @@ namespace bgq_opengl {
 
 	void LoaderAssimp::getGeometries(std::vector<Geometry> *geoms, std::vector<glm::mat4> *matrices) {
 
-		(*geoms) = this->geometries;
-		(*matrices) = this->transform_matrixes;
+		// Hand them over instead of copying the vertices.
+		geoms->swap(this->geometries);
+		matrices->swap(this->transform_matrixes);
+
+		this->geometries.clear();
+		this->transform_matrixes.clear();
 
 	}
 
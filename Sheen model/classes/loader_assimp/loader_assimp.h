@@ -18,6 +18,7 @@
 
 #include "classes/loader/loader.h"
 
+#include <memory>
 #include <vector>
 
 #include "glm/glm.hpp"
@@ -25,6 +26,10 @@
 #include "assimp/scene.h"
 #include "assimp/postprocess.h"
 
+#include "classes/mesh_cache/mesh_cache.h"
+#include "structs/mesh_data/mesh_data.h"
+#include "structs/packed_vertex/packed_vertex.h"
+
 namespace bgq_opengl {
 
 	/**
@@ -42,13 +47,19 @@ namespace bgq_opengl {
 			 * @brief Build a loader instance.
 			 *
 			 * Build a loader instance.
+			 *
+			 * @param filename The model file.
+			 * @param format Layout the vertices are uploaded in.
+			 * @param keep_vertices Whether the geometries keep a CPU copy of their vertices.
+			 * @param upload Whether the geometries are uploaded, else they only keep the CPU copy.
 			 */
-			LoaderAssimp(const char* filename);
+			LoaderAssimp(const char* filename, VertexFormat format = VERTEX_FORMAT_FULL, bool keep_vertices = true, bool upload = true);
 
 			/**
 			 * @brief Get the geometries from the loaded model.
 			 * 
-			 * Get the geometries from the loaded model.
+			 * Get the geometries from the loaded model. They are moved out, not
+			 * copied, so the loader does not have them anymore.
 			 * 
 			 * @param geoms Outputs the geometries returned.
 			 * @param matrices Outputs the transformation matrices.
@@ -56,20 +67,31 @@ namespace bgq_opengl {
 			void getGeometries(std::vector<Geometry> *geoms, std::vector<glm::mat4> *matrices);
 
 			/**
-			 * @brief Loads the data from the file.
+			 * @brief Imports the data from the file.
 		 	 *
-			 * Loads the data from the file.
+			 * Maps the mesh cache of the file or, if there is none for it,
+			 * imports it with Assimp and writes the cache. It does not touch
+			 * OpenGL, so it can run on any thread.
 			 */
-			void loadModel();
+			void importModel();
+
+			/**
+			 * @brief Uploads the imported data.
+			 *
+			 * Builds the geometries from the cache or the imported meshes, on
+			 * the thread that owns the OpenGL context if they are uploaded.
+			 */
+			void uploadModel();
 
 		private:
 
 			/**
-			 * @brief Loads a mesh by its index.
+			 * @brief Imports a mesh.
 			 *
-			 * Loads a mesh by its index.
+			 * Converts an Assimp mesh and keeps it until it is uploaded.
 			 *
-			 * @param mesh the assimp  mesh.
+			 * @param scene The assimp scene.
+			 * @param mesh The assimp mesh.
 			 */
 			void loadGeometry(const aiScene* scene, const aiMesh* mesh);
         
@@ -79,6 +101,14 @@ namespace bgq_opengl {
              * Load the textures for this model.
              */
             std::vector<bgq_opengl::Texture> getTextures();
+        
+            std::unique_ptr<MeshCache> cache;       /// Mesh cache of the file.
+            std::vector<MeshData> meshes;           /// Meshes imported and not uploaded yet.
+            unsigned int scene_materials = 0;       /// Materials in the imported scene.
+            unsigned int scene_textures = 0;        /// Textures in the imported scene.
+            VertexFormat format;                    /// Layout the vertices are uploaded in.
+            bool keep_vertices;                     /// Whether the geometries keep a CPU copy of their vertices.
+            bool upload;                            /// Whether the geometries are uploaded.
 
 	};
 
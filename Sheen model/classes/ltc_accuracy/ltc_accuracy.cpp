@@ -0,0 +1,188 @@
+/**
+ * @file ltc_accuracy.cpp
+ * @brief LTC accuracy class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "ltc_accuracy.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+
+#include "classes/ltc_matrix/ltc_matrix.h"
+#include "classes/ltc_reference/ltc_reference.h"
+#include "structs/light_block/light_block.h"
+#include "structs/ltc_table/ltc_table.h"
+#include "structs/material_block/material_block.h"
+#include "structs/shading_batch/shading_batch.h"
+
+namespace bgq_opengl {
+
+    namespace {
+
+        const int POINTS = 4096;        // Points spread over the sphere.
+        const float RADIUS = 0.5f;      // Radius of the sphere, about the size of the scenes.
+
+        /**
+         * Gets the 8-bit value a channel would be written as, still as a float.
+         * Tables that make the matrix singular give NaN, which is written as 0.
+         */
+        float toByte(float value) {
+
+            if (isnan(value))
+                return 0.0f;
+
+            return roundf(std::min(std::max(value, 0.0f), 1.0f) * 255.0f);
+
+        }
+
+    }  // namespace
+
+    LTCAccuracy::LTCAccuracy(const LTCTable& ltc_1, const LTCTable& ltc_2, const LTCTable& sheen, const LightBlock& light, const glm::vec3& camera_position) {
+
+        this->ltc_1 = ltc_1;
+        this->ltc_2 = ltc_2;
+        this->sheen = sheen;
+        this->light = light;
+        this->camera_position = camera_position;
+
+        // Spread the points evenly over a sphere, so every angle to the light and the camera shows up.
+        this->points.resize(POINTS);
+
+        for (int i = 0; i < POINTS; i++) {
+
+            float y = 1.0f - 2.0f * (i + 0.5f) / POINTS;
+            float ring = sqrtf(1.0f - y * y);
+            float angle = i * 2.39996323f;
+
+            glm::vec3 normal(cosf(angle) * ring, y, sinf(angle) * ring);
+
+            this->points.px[i] = normal.x * RADIUS;
+            this->points.py[i] = normal.y * RADIUS;
+            this->points.pz[i] = normal.z * RADIUS;
+            this->points.nx[i] = normal.x;
+            this->points.ny[i] = normal.y;
+            this->points.nz[i] = normal.z;
+
+        }
+
+        // Sweep the parameters the tables are looked up with, for both sheen models.
+        const float roughnesses[] = {0.01f, 0.2f, 0.4f, 0.6f, 0.8f, 1.0f};
+        const float alphas[] = {0.1f, 0.3f, 0.5f, 0.7f, 0.9f};
+
+        for (int type = 1; type <= 2; type++) {
+
+            for (float roughness : roughnesses) {
+
+                for (float alpha : alphas) {
+
+                    MaterialBlock material;
+                    material.use_alt = true;
+                    material.alt_diffuse = glm::vec3(0.3f);
+                    material.alt_normal = glm::vec3(0.0f, 0.0f, 1.0f);
+                    material.alt_specular = glm::vec3(0.5f);
+                    material.roughness = roughness;
+                    material.alpha = alpha;
+                    material.beta = 0.5f;
+                    material.csheen = 0.5f;
+                    material.sheen_type = type;
+
+                    this->materials.push_back(material);
+
+                }
+
+            }
+
+        }
+
+        // Shade everything with the 32-bit tables once.
+        this->shadeAll(ltc_1, ltc_2, sheen, &this->reference);
+
+    }
+
+    LTCAccuracy::Result LTCAccuracy::measure(GLenum format_1, GLenum format_2, GLenum format_sheen) {
+
+        // Round the tables as the texture units would store them.
+        std::vector<float> texels_1, texels_2, texels_sheen;
+        LTCMatrix::quantize(this->ltc_1, format_1, &texels_1);
+        LTCMatrix::quantize(this->ltc_2, format_2, &texels_2);
+        LTCMatrix::quantize(this->sheen, format_sheen, &texels_sheen);
+
+        LTCTable ltc_1 = this->ltc_1;
+        LTCTable ltc_2 = this->ltc_2;
+        LTCTable sheen = this->sheen;
+        ltc_1.data = texels_1.data();
+        ltc_2.data = texels_2.data();
+        sheen.data = texels_sheen.data();
+
+        std::vector<float> colors;
+        this->shadeAll(ltc_1, ltc_2, sheen, &colors);
+
+        // Compare every channel and every point to the 32-bit colors.
+        Result result;
+        double total = 0.0;
+        size_t changed = 0;
+
+        for (size_t i = 0; i < colors.size(); i += 3) {
+
+            bool differs = false;
+
+            for (int c = 0; c < 3; c++) {
+
+                float error = fabsf(colors[i + c] - this->reference[i + c]);
+                result.max_error = std::max(result.max_error, error);
+                total += error;
+                differs = differs || error > 0.0f;
+
+            }
+
+            if (differs)
+                changed++;
+
+        }
+
+        result.mean_error = (float) (total / colors.size());
+        result.changed = (float) changed / (colors.size() / 3);
+        result.bytes = LTCMatrix::getBytesPerTexel(format_1) + LTCMatrix::getBytesPerTexel(format_2) + LTCMatrix::getBytesPerTexel(format_sheen);
+
+        return result;
+
+    }
+
+    void LTCAccuracy::shadeAll(const LTCTable& ltc_1, const LTCTable& ltc_2, const LTCTable& sheen, std::vector<float>* colors) {
+
+        LTCReference reference(ltc_1, ltc_2, sheen);
+        colors->clear();
+        colors->reserve(this->materials.size() * POINTS * 3);
+
+        for (size_t m = 0; m < this->materials.size(); m++) {
+
+            reference.shade(this->light, this->materials[m], this->camera_position, &this->points);
+
+            for (int i = 0; i < POINTS; i++) {
+
+                colors->push_back(toByte(this->points.r[i]));
+                colors->push_back(toByte(this->points.g[i]));
+                colors->push_back(toByte(this->points.b[i]));
+
+            }
+
+        }
+
+    }
+
+}  // namespace bgq_opengl
@@ -0,0 +1,117 @@
+/**
+ * @file ltc_accuracy.h
+ * @brief LTC accuracy class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_LTC_ACCURACY_H_
+#define BGQ_OPENGL_CLASSES_LTC_ACCURACY_H_
+
+#include <vector>
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+
+#include "structs/light_block/light_block.h"
+#include "structs/ltc_table/ltc_table.h"
+#include "structs/material_block/material_block.h"
+#include "structs/shading_batch/shading_batch.h"
+
+namespace bgq_opengl {
+
+    /**
+     * @brief Measures how storing the LTC tables in a format changes the image.
+     *
+     * Shades a fixed set of points with LTCReference, once with the 32-bit
+     * tables and then with the tables rounded as a set of texture formats
+     * would store them, and compares the 8-bit colors the shader would write.
+     * The points cover every direction of a sphere lit by the area light,
+     * and the materials sweep the roughness, the sheen roughness and both
+     * sheen models.
+     *
+     * @author Borja García Quiroga <garcaqub@tcd.ie>
+     */
+    class LTCAccuracy {
+
+        public:
+
+            /**
+             * @brief Result of a measurement.
+             *
+             * Differences to the 32-bit tables, in steps of the 8-bit output.
+             */
+            struct Result {
+
+                float max_error = 0.0f;     /// Largest difference in any channel.
+                float mean_error = 0.0f;    /// Mean difference over every channel.
+                float changed = 0.0f;       /// Fraction of the points whose 8-bit color changed.
+                int bytes = 0;              /// Bytes of the three texels a fragment fetches.
+
+            };
+
+            /**
+             * @brief Constructs the measurement.
+             *
+             * Constructs the measurement and shades the points with the
+             * 32-bit tables. The tables are not copied.
+             *
+             * @param ltc_1 The inverse M table (LTC1).
+             * @param ltc_2 The norm, Fresnel and horizon clipping table (LTC2).
+             * @param sheen The sheen coefficients table (SHEENCOEFFS).
+             * @param light The area light.
+             * @param camera_position Position of the camera.
+             */
+            LTCAccuracy(const LTCTable& ltc_1, const LTCTable& ltc_2, const LTCTable& sheen, const LightBlock& light, const glm::vec3& camera_position);
+
+            /**
+             * @brief Measures a set of formats.
+             *
+             * Shades the points with the tables stored in the given formats
+             * and compares them to the 32-bit tables.
+             *
+             * @param format_1 Internal format of LTC1.
+             * @param format_2 Internal format of LTC2.
+             * @param format_sheen Internal format of SHEENCOEFFS.
+             *
+             * @returns The differences.
+             */
+            Result measure(GLenum format_1, GLenum format_2, GLenum format_sheen);
+
+        private:
+
+            /**
+             * @brief Shades every point with every material.
+             *
+             * Shades every point with every material and stores the 8-bit
+             * colors, one material after another.
+             *
+             * @param ltc_1 The inverse M table.
+             * @param ltc_2 The norm, Fresnel and horizon clipping table.
+             * @param sheen The sheen coefficients table.
+             * @param colors Output colors, three floats per point in [0, 255].
+             */
+            void shadeAll(const LTCTable& ltc_1, const LTCTable& ltc_2, const LTCTable& sheen, std::vector<float>* colors);
+
+            LTCTable ltc_1;                         /// The 32-bit inverse M table.
+            LTCTable ltc_2;                         /// The 32-bit norm, Fresnel and horizon clipping table.
+            LTCTable sheen;                         /// The 32-bit sheen coefficients table.
+            LightBlock light;                       /// The area light.
+            glm::vec3 camera_position;              /// Position of the camera.
+            std::vector<MaterialBlock> materials;   /// Materials every point is shaded with.
+            ShadingBatch points;                    /// The points.
+            std::vector<float> reference;           /// Colors with the 32-bit tables.
+
+    };
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_LTC_ACCURACY_H_
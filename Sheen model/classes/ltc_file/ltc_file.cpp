@@ -0,0 +1,98 @@
+/**
+ * @file ltc_file.cpp
+ * @brief LTC file class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "ltc_file.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace bgq_opengl {
+
+    LTCFile::LTCFile(const char* filename) {
+
+        this->filename = std::string(filename);
+
+        // Map the whole file.
+        this->file = MappedFile(filename);
+
+        if (!this->file.isOpen()) {
+
+            std::cerr << "LTC file error: " << filename << " could not be opened." << std::endl;
+            exit(1);
+
+        }
+
+        if (this->file.getSize() < sizeof(LTCFileHeader)) {
+
+            std::cerr << "LTC file error: " << filename << " is too small to be a table." << std::endl;
+            exit(1);
+
+        }
+
+        // Check that the header is one this build understands.
+        memcpy(&this->header, this->file.getData(), sizeof(LTCFileHeader));
+
+        if (memcmp(this->header.magic, LTC_FILE_MAGIC, 4) != 0 || this->header.version != LTC_FILE_VERSION) {
+
+            std::cerr << "LTC file error: " << filename << " is not a version " << LTC_FILE_VERSION << " table." << std::endl;
+            exit(1);
+
+        }
+
+        if (this->header.precision != LTC_PRECISION_FLOAT32) {
+
+            std::cerr << "LTC file error: " << filename << " has an unknown precision (" << this->header.precision << ")." << std::endl;
+            exit(1);
+
+        }
+
+        // The texels have to be where the header says, and as many as it says.
+        size_t expected = (size_t) this->header.width * this->header.height * this->header.channels * sizeof(float);
+
+        if (this->header.data_size != expected || this->header.data_offset % LTC_FILE_ALIGNMENT != 0 || (size_t) this->header.data_offset + this->header.data_size > this->file.getSize()) {
+
+            std::cerr << "LTC file error: " << filename << " is truncated or its header is corrupt." << std::endl;
+            exit(1);
+
+        }
+
+    }
+
+    const LTCFileHeader& LTCFile::getHeader() const {
+
+        return this->header;
+
+    }
+
+    LTCTable LTCFile::getTable() const {
+
+        LTCTable table;
+        table.data = (const float*) (this->file.getData() + this->header.data_offset);
+        table.width = (int) this->header.width;
+        table.height = (int) this->header.height;
+        table.channels = (int) this->header.channels;
+
+        return table;
+
+    }
+
+    void LTCFile::remove() {
+
+        // Unmap the file.
+        this->file.remove();
+
+    }
+
+}  // namespace bgq_opengl
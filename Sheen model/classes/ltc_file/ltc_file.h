@@ -0,0 +1,84 @@
+/**
+ * @file ltc_file.h
+ * @brief LTC file class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_LTC_FILE_H_
+#define BGQ_OPENGL_CLASSES_LTC_FILE_H_
+
+#include <string>
+
+#include "classes/mapped_file/mapped_file.h"
+#include "structs/ltc_file_header/ltc_file_header.h"
+#include "structs/ltc_table/ltc_table.h"
+
+namespace bgq_opengl {
+
+    /**
+     * @brief Implements a memory-mapped LTC table file.
+     *
+     * Implements a binary LTC table file, as written by the ltc_converter
+     * tool. The file is mapped read-only and its header checked, and the
+     * texels are used straight from the mapping until it is removed.
+     *
+     * @author Borja García Quiroga <garcaqub@tcd.ie>
+     */
+    class LTCFile {
+
+        public:
+
+            /**
+             * @brief Maps a table file.
+             *
+             * Maps a table file into memory and checks its header.
+             *
+             * @param filename The .ltc file.
+             */
+            LTCFile(const char* filename);
+
+            /**
+             * @brief Get the header of the file.
+             *
+             * Get the header of the file.
+             *
+             * @returns The header.
+             */
+            const LTCFileHeader& getHeader() const;
+
+            /**
+             * @brief Get the table.
+             *
+             * Get the table, pointing into the mapping.
+             *
+             * @returns The table.
+             */
+            LTCTable getTable() const;
+
+            /**
+             * @brief Unmaps the file.
+             *
+             * Unmaps the file. The tables got from it are no longer valid.
+             */
+            void remove();
+
+        private:
+
+            std::string filename;   /// The mapped file.
+            MappedFile file;        /// The mapping.
+            LTCFileHeader header;   /// Header of the file.
+
+    };
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_LTC_FILE_H_
@@ -18,12 +18,20 @@
 #include "ltc_matrix.h"
 
 #include <assert.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <vector>
 
 #include "GL/glew.h"
+#include "glm/glm.hpp"
+#include "glm/gtc/packing.hpp"
+
+#include "classes/gl_state/gl_state.h"
 
 namespace bgq_opengl {
 
-    LTCMatrix::LTCMatrix(int mat, const char* name, GLuint slot) {
+    LTCMatrix::LTCMatrix(const LTCTable& table, const char* name, GLuint slot, GLenum internal_format) {
         
         // The slot has to be a positive number because OpenGL does weird stuff on macOS else.
         if (slot < 1) assert(false);
@@ -32,10 +40,10 @@ namespace bgq_opengl {
         glGenTextures(1, &this->ID);
         this->name = std::string(name);
         this->slot = slot;
+        this->internal_format = internal_format;
     
         // Set the slot for the texture.
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, this->ID);
+        GLState::bindTexture(GL_TEXTURE_2D, slot, this->ID);
         
         // Configure the magnifying algorithm, minifying algorithm and repetition.
         // This tells OpenGL how to apply intrpolation.
@@ -44,34 +52,85 @@ namespace bgq_opengl {
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
         
-        // Load the 'image' to OpenGL.
-        if (mat == 1)
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 64, 64, 0, GL_RGBA, GL_FLOAT, mat_ltc_1);
-        else if (mat == 2)
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 64, 64, 0, GL_RGBA, GL_FLOAT, mat_ltc_2);
-        else if (mat == 3)
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, 32, 32, 0, GL_RGB, GL_FLOAT, mat_ltc_sheen);
-        else
+        // Load the 'image' to OpenGL. 32-bit tables go straight from wherever they live.
+        if (table.channels != 3 && table.channels != 4)
             assert(false);
 
+        GLenum format = table.channels == 4 ? GL_RGBA : GL_RGB;
+
+        if (internal_format == GL_RGBA32F || internal_format == GL_RGB32F) {
+
+            glTexImage2D(GL_TEXTURE_2D, 0, internal_format, table.width, table.height, 0, format, GL_FLOAT, table.data);
+
+        } else {
+
+            std::vector<unsigned char> bytes;
+            GLenum type;
+            LTCMatrix::pack(table, internal_format, &bytes, &format, &type);
+
+            glTexImage2D(GL_TEXTURE_2D, 0, internal_format, table.width, table.height, 0, format, type, bytes.data());
+
+        }
+
         // Unbinds the OpenGL Texture.
-        glBindTexture(GL_TEXTURE_2D, 0);
+        GLState::bindTexture(GL_TEXTURE_2D, slot, 0);
 
     }
 
-    GLuint LTCMatrix::getID() {
+    int LTCMatrix::getBytesPerTexel(GLenum internal_format) {
+
+        switch (internal_format) {
+
+            case GL_RGBA32F: return 16;
+            case GL_RGB32F: return 12;
+            case GL_RGBA16F: return 8;
+            case GL_RGB16F: return 6;
+            case GL_RGB10_A2: return 4;
+            case GL_RGBA8: return 4;
+
+        }
+
+        assert(false);
+        return 0;
+
+    }
+
+    const char* LTCMatrix::getFormatName(GLenum internal_format) {
+
+        switch (internal_format) {
+
+            case GL_RGBA32F: return "RGBA32F";
+            case GL_RGB32F: return "RGB32F";
+            case GL_RGBA16F: return "RGBA16F";
+            case GL_RGB16F: return "RGB16F";
+            case GL_RGB10_A2: return "RGB10_A2";
+            case GL_RGBA8: return "RGBA8";
+
+        }
+
+        return "unknown";
+
+    }
+
+    GLuint LTCMatrix::getID() const {
 
         return this->ID;
 
     }
 
-    GLuint LTCMatrix::getSlot() {
+    GLenum LTCMatrix::getInternalFormat() const {
+
+        return this->internal_format;
+
+    }
+
+    GLuint LTCMatrix::getSlot() const {
 
         return this->slot;
 
     }
 
-    std::string LTCMatrix::getName() {
+    std::string LTCMatrix::getName() const {
 
         return this->name;
 
@@ -80,20 +139,106 @@ namespace bgq_opengl {
     void LTCMatrix::bind() {
 
         // Activate the texture and bind it.
-        glActiveTexture(GL_TEXTURE0 + this->slot);
-        glBindTexture(GL_TEXTURE_2D, this->ID);
+        GLState::bindTexture(GL_TEXTURE_2D, this->slot, this->ID);
+
+    }
+
+    void LTCMatrix::pack(const LTCTable& table, GLenum internal_format, std::vector<unsigned char>* bytes, GLenum* format, GLenum* type) {
+
+        size_t texels = (size_t) table.width * table.height;
+        size_t values = texels * table.channels;
+
+        if (internal_format == GL_RGBA16F || internal_format == GL_RGB16F) {
+
+            // Halves keep the channels of the table, the GPU fills the missing alpha with 1.
+            std::vector<uint16_t> halves(values);
+
+            for (size_t i = 0; i < values; i++)
+                halves[i] = glm::packHalf1x16(table.data[i]);
+
+            bytes->resize(values * sizeof(uint16_t));
+            memcpy(bytes->data(), halves.data(), bytes->size());
+
+            *format = table.channels == 4 ? GL_RGBA : GL_RGB;
+            *type = GL_HALF_FLOAT;
+
+        } else if (internal_format == GL_RGB10_A2 || internal_format == GL_RGBA8) {
+
+            // Normalized formats clamp to [0, 1], and always take four channels.
+            std::vector<uint32_t> words(texels);
+
+            for (size_t i = 0; i < texels; i++) {
+
+                const float* texel = table.data + i * table.channels;
+                glm::vec4 value(texel[0], texel[1], texel[2], table.channels == 4 ? texel[3] : 1.0f);
+
+                words[i] = internal_format == GL_RGB10_A2 ? glm::packUnorm3x10_1x2(value) : glm::packUnorm4x8(value);
+
+            }
+
+            bytes->resize(texels * sizeof(uint32_t));
+            memcpy(bytes->data(), words.data(), bytes->size());
+
+            *format = GL_RGBA;
+            *type = internal_format == GL_RGB10_A2 ? GL_UNSIGNED_INT_2_10_10_10_REV : GL_UNSIGNED_BYTE;
+
+        } else {
+
+            assert(false);
+
+        }
+
+    }
+
+    void LTCMatrix::quantize(const LTCTable& table, GLenum internal_format, std::vector<float>* texels) {
+
+        size_t count = (size_t) table.width * table.height;
+        texels->assign(table.data, table.data + count * table.channels);
+
+        // 32-bit floats are stored as they are.
+        if (internal_format == GL_RGBA32F || internal_format == GL_RGB32F)
+            return;
+
+        for (size_t i = 0; i < count; i++) {
+
+            float* texel = texels->data() + i * table.channels;
+
+            // Round trip every texel through the packed representation.
+            if (internal_format == GL_RGBA16F || internal_format == GL_RGB16F) {
+
+                for (int c = 0; c < table.channels; c++)
+                    texel[c] = glm::unpackHalf1x16(glm::packHalf1x16(texel[c]));
+
+                continue;
+
+            }
+
+            glm::vec4 value(texel[0], texel[1], texel[2], table.channels == 4 ? texel[3] : 1.0f);
+
+            if (internal_format == GL_RGB10_A2)
+                value = glm::unpackUnorm3x10_1x2(glm::packUnorm3x10_1x2(value));
+            else if (internal_format == GL_RGBA8)
+                value = glm::unpackUnorm4x8(glm::packUnorm4x8(value));
+            else
+                assert(false);
+
+            for (int c = 0; c < table.channels; c++)
+                texel[c] = value[c];
+
+        }
 
     }
 
     void LTCMatrix::remove() {
 
+        GLState::forgetTexture(this->ID);
         glDeleteTextures(1, &this->ID);
 
     }
 
     void LTCMatrix::unbind() {
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        GLState::bindTexture(GL_TEXTURE_2D, this->slot, 0);
 
     }
 
@@ -18,12 +18,13 @@
 #ifndef BGQ_OPENGL_CLASSES_LTC_H_
 #define BGQ_OPENGL_CLASSES_LTC_H_
 
-#include "ltc_matrix_data.h"
-
 #include <string>
+#include <vector>
 
 #include "GL/glew.h"
 
+#include "structs/ltc_table/ltc_table.h"
+
 namespace bgq_opengl {
 
     /**
@@ -38,15 +39,50 @@ namespace bgq_opengl {
         public:
 
             /**
-             * @brief Creates a texture from an image.
+             * @brief Creates a texture from a table.
              *
-             * Creates a textures and passes it to OpenGL.
+             * Creates a textures and passes it to OpenGL. The table is only
+             * read during the call, so its file can be unmapped afterwards.
+             * 32-bit tables are uploaded as they are, and the rest are packed
+             * on the CPU first, so the driver does not pick the precision.
              *
-             * @param mat The data to be loaded.
+             * @param table The table to be loaded, with 3 or 4 channels.
              * @param name Texture name in the shader.
              * @param slot Texture slot.
+             * @param internal_format GL_RGBA32F, GL_RGB32F, GL_RGBA16F, GL_RGB16F, GL_RGB10_A2 or GL_RGBA8.
+             */
+            LTCMatrix(const LTCTable& table, const char* name, GLuint slot, GLenum internal_format);
+
+            /**
+             * @brief Get the size of a texel.
+             *
+             * Get the size of a texel in a given format.
+             *
+             * @param internal_format The sized internal format.
+             *
+             * @returns The size in bytes.
              */
-            LTCMatrix(int mat, const char* name, GLuint slot);
+            static int getBytesPerTexel(GLenum internal_format);
+
+            /**
+             * @brief Get the name of a format.
+             *
+             * Get the name of a format, as GL spells it without the prefix.
+             *
+             * @param internal_format The sized internal format.
+             *
+             * @returns The name, for instance "RGBA16F".
+             */
+            static const char* getFormatName(GLenum internal_format);
+
+            /**
+             * @brief Get the internal format of the texture.
+             *
+             * Get the sized internal format the table was uploaded with.
+             *
+             * @returns The internal format.
+             */
+            GLenum getInternalFormat() const;
 
             /**
              * @brief Get the ID of the texture.
@@ -55,7 +91,7 @@ namespace bgq_opengl {
              *
              * @returns The ID of the texture.
              */
-            GLuint getID();
+            GLuint getID() const;
 
             /**
              * @brief Get the slot of the texture.
@@ -64,7 +100,7 @@ namespace bgq_opengl {
              *
              * @returns The slot of the texture.
              */
-            GLuint getSlot();
+            GLuint getSlot() const;
         
             /**
              * @brief Gets the texture name.
@@ -73,7 +109,7 @@ namespace bgq_opengl {
              *
              * @returns A char string containing the name name of the texture.
              */
-            std::string getName();
+            std::string getName() const;
 
             /**
              * @brief Binds the texture.
@@ -82,6 +118,19 @@ namespace bgq_opengl {
              */
             void bind();
 
+            /**
+             * @brief Quantizes a table.
+             *
+             * Rounds the texels of a table as they would be stored in a given
+             * format and turns them back into floats, so the CPU can evaluate
+             * what the shaders would read. The table keeps its channels.
+             *
+             * @param table The table.
+             * @param internal_format The sized internal format.
+             * @param texels Output texels, laid out as the table.
+             */
+            static void quantize(const LTCTable& table, GLenum internal_format, std::vector<float>* texels);
+
             /**
              * @brief Removes the texture from OpenGL.
              *
@@ -98,9 +147,23 @@ namespace bgq_opengl {
 
         private:
 
-            GLuint ID;          /// Texture OpenGL ID.
-            GLuint slot;        /// Stores the texture slot number.
-            std::string name;   /// Texture name.
+            /**
+             * @brief Packs a table for uploading.
+             *
+             * Packs the texels of a table as they are stored in a given format.
+             *
+             * @param table The table.
+             * @param internal_format The sized internal format.
+             * @param bytes Output packed texels.
+             * @param format Output format of the packed texels, as glTexImage2D takes it.
+             * @param type Output type of the packed texels, as glTexImage2D takes it.
+             */
+            static void pack(const LTCTable& table, GLenum internal_format, std::vector<unsigned char>* bytes, GLenum* format, GLenum* type);
+
+            GLuint ID;                  /// Texture OpenGL ID.
+            GLuint slot;                /// Stores the texture slot number.
+            std::string name;           /// Texture name.
+            GLenum internal_format;     /// Format the table is stored in.
 
     };
 
@@ -0,0 +1,170 @@
+/**
+ * @file ltc_lanes.h
+ * @brief SIMD lane types used by the LTC reference.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_LTC_LANES_H_
+#define BGQ_OPENGL_CLASSES_LTC_LANES_H_
+
+#include <math.h>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define BGQ_OPENGL_LANES_SSE2
+#endif
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define BGQ_OPENGL_LANES_AVX2
+#endif
+
+namespace bgq_opengl {
+
+    /**
+     * @brief Lane types for the LTC kernels.
+     *
+     * Every type holds one float per lane and has the same operators and
+     * functions, so a kernel written once as a template runs on one point
+     * (Float1), four (Float4, SSE2) or eight (Float8, AVX2). Comparisons
+     * return a mask of the same type. Indices passed to gather are floats
+     * holding whole numbers.
+     */
+    namespace lanes {
+
+        // One lane, plain C++.
+
+        struct Float1 {
+
+            static const int WIDTH = 1;
+            float v;
+
+            Float1() {}
+            Float1(float x) : v(x) {}
+
+        };
+
+        struct Mask1 {
+
+            bool v;
+
+        };
+
+        inline Float1 operator+(Float1 a, Float1 b) { return a.v + b.v; }
+        inline Float1 operator-(Float1 a, Float1 b) { return a.v - b.v; }
+        inline Float1 operator*(Float1 a, Float1 b) { return a.v * b.v; }
+        inline Float1 operator/(Float1 a, Float1 b) { return a.v / b.v; }
+        inline Float1 operator-(Float1 a) { return -a.v; }
+        inline Mask1 operator<(Float1 a, Float1 b) { return {a.v < b.v}; }
+        inline Mask1 operator>(Float1 a, Float1 b) { return {a.v > b.v}; }
+        inline Float1 select(Mask1 m, Float1 a, Float1 b) { return m.v ? a : b; }
+        inline Float1 min(Float1 a, Float1 b) { return a.v < b.v ? a : b; }
+        inline Float1 max(Float1 a, Float1 b) { return a.v > b.v ? a : b; }
+        inline Float1 abs(Float1 a) { return fabsf(a.v); }
+        inline Float1 sqrt(Float1 a) { return sqrtf(a.v); }
+        inline Float1 floor(Float1 a) { return floorf(a.v); }
+        inline Float1 load(const float* p, Float1) { return *p; }
+        inline void store(float* p, Float1 a) { *p = a.v; }
+        inline Float1 gather(const float* base, Float1 index) { return base[(int) index.v]; }
+
+#ifdef BGQ_OPENGL_LANES_SSE2
+
+        // Four lanes, SSE2.
+
+        struct Float4 {
+
+            static const int WIDTH = 4;
+            __m128 v;
+
+            Float4() {}
+            Float4(float x) : v(_mm_set1_ps(x)) {}
+            Float4(__m128 x) : v(x) {}
+
+        };
+
+        typedef Float4 Mask4;
+
+        inline Float4 operator+(Float4 a, Float4 b) { return _mm_add_ps(a.v, b.v); }
+        inline Float4 operator-(Float4 a, Float4 b) { return _mm_sub_ps(a.v, b.v); }
+        inline Float4 operator*(Float4 a, Float4 b) { return _mm_mul_ps(a.v, b.v); }
+        inline Float4 operator/(Float4 a, Float4 b) { return _mm_div_ps(a.v, b.v); }
+        inline Float4 operator-(Float4 a) { return _mm_xor_ps(a.v, _mm_set1_ps(-0.0f)); }
+        inline Mask4 operator<(Float4 a, Float4 b) { return _mm_cmplt_ps(a.v, b.v); }
+        inline Mask4 operator>(Float4 a, Float4 b) { return _mm_cmpgt_ps(a.v, b.v); }
+        inline Float4 select(Mask4 m, Float4 a, Float4 b) { return _mm_or_ps(_mm_and_ps(m.v, a.v), _mm_andnot_ps(m.v, b.v)); }
+        inline Float4 min(Float4 a, Float4 b) { return _mm_min_ps(a.v, b.v); }
+        inline Float4 max(Float4 a, Float4 b) { return _mm_max_ps(a.v, b.v); }
+        inline Float4 abs(Float4 a) { return _mm_andnot_ps(_mm_set1_ps(-0.0f), a.v); }
+        inline Float4 sqrt(Float4 a) { return _mm_sqrt_ps(a.v); }
+        inline Float4 load(const float* p, Float4) { return _mm_loadu_ps(p); }
+        inline void store(float* p, Float4 a) { _mm_storeu_ps(p, a.v); }
+
+        inline Float4 floor(Float4 a) {
+
+            // Truncate, then step down the negative values that had a fraction.
+            __m128 t = _mm_cvtepi32_ps(_mm_cvttps_epi32(a.v));
+            return _mm_sub_ps(t, _mm_and_ps(_mm_cmpgt_ps(t, a.v), _mm_set1_ps(1.0f)));
+
+        }
+
+        inline Float4 gather(const float* base, Float4 index) {
+
+            // SSE2 has no gather, so go through memory.
+            alignas(16) int i[4];
+            _mm_store_si128((__m128i*) i, _mm_cvttps_epi32(index.v));
+            return _mm_setr_ps(base[i[0]], base[i[1]], base[i[2]], base[i[3]]);
+
+        }
+
+#endif
+
+#ifdef BGQ_OPENGL_LANES_AVX2
+
+        // Eight lanes, AVX2.
+
+        struct Float8 {
+
+            static const int WIDTH = 8;
+            __m256 v;
+
+            Float8() {}
+            Float8(float x) : v(_mm256_set1_ps(x)) {}
+            Float8(__m256 x) : v(x) {}
+
+        };
+
+        typedef Float8 Mask8;
+
+        inline Float8 operator+(Float8 a, Float8 b) { return _mm256_add_ps(a.v, b.v); }
+        inline Float8 operator-(Float8 a, Float8 b) { return _mm256_sub_ps(a.v, b.v); }
+        inline Float8 operator*(Float8 a, Float8 b) { return _mm256_mul_ps(a.v, b.v); }
+        inline Float8 operator/(Float8 a, Float8 b) { return _mm256_div_ps(a.v, b.v); }
+        inline Float8 operator-(Float8 a) { return _mm256_xor_ps(a.v, _mm256_set1_ps(-0.0f)); }
+        inline Mask8 operator<(Float8 a, Float8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ); }
+        inline Mask8 operator>(Float8 a, Float8 b) { return _mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ); }
+        inline Float8 select(Mask8 m, Float8 a, Float8 b) { return _mm256_blendv_ps(b.v, a.v, m.v); }
+        inline Float8 min(Float8 a, Float8 b) { return _mm256_min_ps(a.v, b.v); }
+        inline Float8 max(Float8 a, Float8 b) { return _mm256_max_ps(a.v, b.v); }
+        inline Float8 abs(Float8 a) { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), a.v); }
+        inline Float8 sqrt(Float8 a) { return _mm256_sqrt_ps(a.v); }
+        inline Float8 floor(Float8 a) { return _mm256_floor_ps(a.v); }
+        inline Float8 load(const float* p, Float8) { return _mm256_loadu_ps(p); }
+        inline void store(float* p, Float8 a) { _mm256_storeu_ps(p, a.v); }
+        inline Float8 gather(const float* base, Float8 index) { return _mm256_i32gather_ps(base, _mm256_cvttps_epi32(index.v), 4); }
+
+#endif
+
+    }  // namespace lanes
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_LTC_LANES_H_
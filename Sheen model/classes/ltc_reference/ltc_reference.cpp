@@ -0,0 +1,399 @@
+/**
+ * @file ltc_reference.cpp
+ * @brief LTC reference class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "ltc_reference.h"
+
+#include <math.h>
+
+#include "glm/glm.hpp"
+
+#include "classes/ltc_reference/ltc_lanes.h"
+#include "structs/light_block/light_block.h"
+#include "structs/ltc_table/ltc_table.h"
+#include "structs/material_block/material_block.h"
+#include "structs/shading_batch/shading_batch.h"
+
+namespace bgq_opengl {
+
+    namespace {
+
+        using namespace lanes;
+
+        // The widest lane type the compiler targets.
+#if defined(BGQ_OPENGL_LANES_AVX2)
+        typedef Float8 Wide;
+        const char* WIDE_NAME = "AVX2";
+#elif defined(BGQ_OPENGL_LANES_SSE2)
+        typedef Float4 Wide;
+        const char* WIDE_NAME = "SSE2";
+#else
+        typedef Float1 Wide;
+        const char* WIDE_NAME = "scalar";
+#endif
+
+        // The constants of ltc.frag.
+        const float LUT_SIZE = 64.0f;
+        const float LUT_SCALE = (LUT_SIZE - 1.0f) / LUT_SIZE;
+        const float LUT_BIAS = 0.5f / LUT_SIZE;
+        const float GAMMA = 2.2f;
+        const float PI = 3.1415926535897932384626433832795f;
+
+        // A vec3 with one point per lane.
+        template <class F>
+        struct V3 {
+
+            F x, y, z;
+
+        };
+
+        template <class F>
+        V3<F> operator+(const V3<F>& a, const V3<F>& b) { return {a.x + b.x, a.y + b.y, a.z + b.z}; }
+
+        template <class F>
+        V3<F> operator-(const V3<F>& a, const V3<F>& b) { return {a.x - b.x, a.y - b.y, a.z - b.z}; }
+
+        template <class F>
+        V3<F> operator*(const V3<F>& a, F s) { return {a.x * s, a.y * s, a.z * s}; }
+
+        template <class F>
+        F dot(const V3<F>& a, const V3<F>& b) { return a.x * b.x + a.y * b.y + a.z * b.z; }
+
+        template <class F>
+        V3<F> cross(const V3<F>& a, const V3<F>& b) { return {a.y * b.z - a.z * b.y, a.z * b.x - a.x * b.z, a.x * b.y - a.y * b.x}; }
+
+        template <class F>
+        F length(const V3<F>& a) { return sqrt(dot(a, a)); }
+
+        template <class F>
+        V3<F> normalize(const V3<F>& a) { return a * (F(1.0f) / length(a)); }
+
+        template <class F>
+        F clamp(F x, F lo, F hi) { return min(max(x, lo), hi); }
+
+        template <class F>
+        V3<F> broadcast(const glm::vec3& v) { return {F(v.x), F(v.y), F(v.z)}; }
+
+        template <class F>
+        V3<F> load(const std::vector<float>& x, const std::vector<float>& y, const std::vector<float>& z, size_t i) {
+
+            return {load(&x[i], F()), load(&y[i], F()), load(&z[i], F())};
+
+        }
+
+        // Apply a scalar function lane by lane, for the ones with no SIMD version.
+        template <class F>
+        F perLane(F a, float (*function)(float, float), float b) {
+
+            alignas(32) float values[F::WIDTH];
+            store(values, a);
+
+            for (int i = 0; i < F::WIDTH; i++)
+                values[i] = function(values[i], b);
+
+            return load(values, F());
+
+        }
+
+        float exponential(float x, float) {
+
+            return expf(x);
+
+        }
+
+        /**
+         * Bilinear sampling of a table, as a GL_LINEAR texture clamped to its
+         * edges. The texel indices and weights are computed once and shared
+         * by every channel that is fetched.
+         */
+        template <class F>
+        struct Bilinear {
+
+            const LTCTable* table;
+            F i00, i10, i01, i11;
+            F fx, fy;
+
+            Bilinear(const LTCTable& table, F u, F v) : table(&table) {
+
+                // Move to texel space, where the centers are on the integers.
+                F x = u * F((float) table.width) - F(0.5f);
+                F y = v * F((float) table.height) - F(0.5f);
+                F x0 = floor(x);
+                F y0 = floor(y);
+                this->fx = x - x0;
+                this->fy = y - y0;
+
+                // Clamp the four texels to the edges.
+                F max_x = F((float) (table.width - 1));
+                F max_y = F((float) (table.height - 1));
+                F x1 = clamp(x0 + F(1.0f), F(0.0f), max_x);
+                F y1 = clamp(y0 + F(1.0f), F(0.0f), max_y);
+                x0 = clamp(x0, F(0.0f), max_x);
+                y0 = clamp(y0, F(0.0f), max_y);
+
+                // Index of the first channel of every texel.
+                F row = F((float) table.width);
+                F channels = F((float) table.channels);
+                this->i00 = (y0 * row + x0) * channels;
+                this->i10 = (y0 * row + x1) * channels;
+                this->i01 = (y1 * row + x0) * channels;
+                this->i11 = (y1 * row + x1) * channels;
+
+            }
+
+            F fetch(int channel) const {
+
+                // Tables without alpha read it as 1, as OpenGL does.
+                if (channel >= this->table->channels)
+                    return F(1.0f);
+
+                const float* base = this->table->data + channel;
+                F bottom = gather(base, this->i00) + (gather(base, this->i10) - gather(base, this->i00)) * this->fx;
+                F top = gather(base, this->i01) + (gather(base, this->i11) - gather(base, this->i01)) * this->fx;
+
+                return bottom + (top - bottom) * this->fy;
+
+            }
+
+        };
+
+        // integrateEdge in ltc.frag.
+        template <class F>
+        V3<F> integrateEdge(const V3<F>& v1, const V3<F>& v2) {
+
+            F x = dot(v1, v2);
+            F y = abs(x);
+
+            // The rational fit of the authors, instead of acos.
+            F a = F(0.8543985f) + (F(0.4965155f) + F(0.0145206f) * y) * y;
+            F b = F(3.4175940f) + (F(4.1616724f) + y) * y;
+            F v = a / b;
+
+            F theta = select(x > F(0.0f), v, F(0.5f) / sqrt(max(F(1.0f) - x * x, F(1e-7f))) - v);
+
+            return cross(v1, v2) * theta;
+
+        }
+
+        // evaluateLTC in ltc.frag, with Minv = ((m.x, 0, m.y), (0, 1, 0), (m.z, 0, m.w)).
+        template <class F>
+        F evaluateLTC(const V3<F>& N, const V3<F>& V, const V3<F>& P, const F m[4], const V3<F> points[4], const LTCTable& ltc_2) {
+
+            // Build the orthonormal.
+            V3<F> t1 = normalize(V - N * dot(V, N));
+            V3<F> t2 = cross(N, t1);
+
+            // Transform the polygon to the frame, then by Minv, and normalise it.
+            V3<F> L[4];
+            for (int i = 0; i < 4; i++) {
+
+                V3<F> d = points[i] - P;
+                V3<F> w = {dot(t1, d), dot(t2, d), dot(N, d)};
+                L[i] = normalize(V3<F>{m[0] * w.x + m[2] * w.z, w.y, m[1] * w.x + m[3] * w.z});
+
+            }
+
+            // Apply the approx integration to these.
+            V3<F> vsum = integrateEdge(L[0], L[1]);
+            vsum = vsum + integrateEdge(L[1], L[2]);
+            vsum = vsum + integrateEdge(L[2], L[3]);
+            vsum = vsum + integrateEdge(L[3], L[0]);
+
+            // Form factor of the polygon in direction vsum.
+            F len = length(vsum);
+            F z = vsum.z / len;
+
+            // Fetch the form factor for horizon clipping.
+            Bilinear<F> lut(ltc_2, (z * F(0.5f) + F(0.5f)) * F(LUT_SCALE) + F(LUT_BIAS), len * F(LUT_SCALE) + F(LUT_BIAS));
+
+            return len * lut.fetch(3);
+
+        }
+
+        // sheenModel in ltc.frag.
+        template <class F>
+        F sheenModel(const V3<F>& P, const V3<F>& N, const V3<F>& camera, const V3<F>& light_center, float alpha, float csheen, const LTCTable& sheen) {
+
+            // Calculate the view direction and the light direction.
+            V3<F> wo = normalize(camera - P);
+            V3<F> wi = normalize(P - light_center);
+            F cos_theta_o = clamp(dot(N, wo), F(0.0f), F(1.0f));
+
+            // Rotate wi by -phi(wo) around z. atan(0, 0) is 0, so no rotation then.
+            F r = sqrt(wo.x * wo.x + wo.y * wo.y);
+            F c = select(r > F(0.0f), wo.x / r, F(1.0f));
+            F s = select(r > F(0.0f), wo.y / r, F(0.0f));
+            V3<F> wi_std = {wi.x * c + wi.y * s, wi.y * c - wi.x * s, wi.z};
+
+            // Fetch the coefficients of the distribution.
+            Bilinear<F> lut(sheen, cos_theta_o, F(fmaxf(0.0f, fminf(alpha, 1.0f))));
+            F a = lut.fetch(0);
+            F b = lut.fetch(1);
+            F R = lut.fetch(2);
+
+            // Evaluate the distribution in its default coordinate system.
+            V3<F> wi_org = {a * wi_std.x + b * wi_std.z, a * wi_std.y, wi_std.z};
+            F len = length(wi_org);
+            F jacobian = a * a / (len * len * len);
+            F value = clamp(dot(N, wi_org), F(0.0f), F(1.0f)) / F(PI) * jacobian;
+
+            return clamp(value * R * F(csheen), F(0.0f), F(1.0f));
+
+        }
+
+        // cosineSheen in ltc.frag.
+        template <class F>
+        F cosineSheen(const V3<F>& N, float beta) {
+
+            // The view is fixed to (0, 0, 1), so only the z of the normal counts.
+            F cos_theta_o = abs(N.z);
+            F scaled = (F(1.0f) - perLane(-cos_theta_o * F(beta), exponential, 0.0f)) / F(1.0f - expf(-beta));
+
+            return F(1.0f) - scaled;
+
+        }
+
+    }
+
+    LTCReference::LTCReference(const LTCTable& ltc_1, const LTCTable& ltc_2, const LTCTable& sheen) {
+
+        this->ltc_1 = ltc_1;
+        this->ltc_2 = ltc_2;
+        this->sheen = sheen;
+
+    }
+
+    const char* LTCReference::getInstructionSet() {
+
+        return WIDE_NAME;
+
+    }
+
+    int LTCReference::getWidth() {
+
+        return Wide::WIDTH;
+
+    }
+
+    void LTCReference::shade(const LightBlock& light, const MaterialBlock& material, const glm::vec3& camera_position, ShadingBatch* batch, bool simd) const {
+
+        size_t count = batch->size();
+
+        // Make sure there is room for the colors.
+        batch->r.resize(count);
+        batch->g.resize(count);
+        batch->b.resize(count);
+
+        // Shade the full groups with the widest lanes and the rest one by one.
+        size_t wide_end = simd ? count - count % Wide::WIDTH : 0;
+        this->shadeRange<Wide>(light, material, camera_position, batch, 0, wide_end);
+        this->shadeRange<Float1>(light, material, camera_position, batch, wide_end, count);
+
+    }
+
+    template <class F>
+    void LTCReference::shadeRange(const LightBlock& light, const MaterialBlock& material, const glm::vec3& camera_position, ShadingBatch* batch, size_t first, size_t last) const {
+
+        // Broadcast the uniforms, they are the same for every lane.
+        V3<F> points[4];
+        glm::vec3 center(0.0f);
+        for (int i = 0; i < 4; i++) {
+
+            points[i] = {F(light.points[i].x), F(light.points[i].y), F(light.points[i].z)};
+            center += glm::vec3(light.points[i]) / 4.0f;
+
+        }
+
+        V3<F> light_center = broadcast<F>(center);
+        V3<F> camera = broadcast<F>(camera_position);
+        V3<F> radiance = broadcast<F>(light.color * light.intensity);
+        F identity[4] = {F(1.0f), F(0.0f), F(0.0f), F(1.0f)};
+
+        // The alt specular is the same everywhere, so linearise it once.
+        glm::vec3 alt_specular(powf(material.alt_specular.x, GAMMA), powf(material.alt_specular.y, GAMMA), powf(material.alt_specular.z, GAMMA));
+
+        for (size_t i = first; i < last; i += F::WIDTH) {
+
+            // Selec the right elements for the materials.
+            V3<F> diffuse_val, specular_val;
+            if (material.use_alt) {
+
+                diffuse_val = broadcast<F>(material.alt_diffuse);
+                specular_val = broadcast<F>(alt_specular);
+
+            } else {
+
+                diffuse_val = load<F>(batch->dr, batch->dg, batch->db, i);
+                specular_val = load<F>(batch->sr, batch->sg, batch->sb, i);
+                specular_val = {perLane(specular_val.x, powf, GAMMA), perLane(specular_val.y, powf, GAMMA), perLane(specular_val.z, powf, GAMMA)};
+
+            }
+
+            V3<F> P = load<F>(batch->px, batch->py, batch->pz, i);
+            V3<F> world_normal = load<F>(batch->nx, batch->ny, batch->nz, i);
+            V3<F> N = normalize(world_normal);
+            V3<F> V = normalize(camera - P);
+            F dot_nv = clamp(dot(N, V), F(0.0f), F(1.0f));
+
+            // Use roughness and sqrt(1 - cos_theta) to sample the tables.
+            F u = F(material.roughness * LUT_SCALE + LUT_BIAS);
+            F v = sqrt(F(1.0f) - dot_nv) * F(LUT_SCALE) + F(LUT_BIAS);
+            Bilinear<F> lut_1(this->ltc_1, u, v);
+            Bilinear<F> lut_2(this->ltc_2, u, v);
+            F m[4] = {lut_1.fetch(0), lut_1.fetch(1), lut_1.fetch(2), lut_1.fetch(3)};
+            F fresnel = lut_2.fetch(0);
+            F shadowing = lut_2.fetch(1);
+
+            // Evaluate LTC shading.
+            F diffuse = evaluateLTC(N, V, P, identity, points, this->ltc_2);
+            F specular = evaluateLTC(N, V, P, m, points, this->ltc_2);
+
+            // GGX shadowing and Fresnel, per channel.
+            V3<F> result = {
+                radiance.x * (specular * (specular_val.x * fresnel + (F(1.0f) - specular_val.x) * shadowing) + diffuse_val.x * diffuse),
+                radiance.y * (specular * (specular_val.y * fresnel + (F(1.0f) - specular_val.y) * shadowing) + diffuse_val.y * diffuse),
+                radiance.z * (specular * (specular_val.z * fresnel + (F(1.0f) - specular_val.z) * shadowing) + diffuse_val.z * diffuse)
+            };
+            result = {perLane(result.x, powf, 1.0f / GAMMA), perLane(result.y, powf, 1.0f / GAMMA), perLane(result.z, powf, 1.0f / GAMMA)};
+
+            // Sheen layers, scaled by how up the normal is for dust.
+            F weight = F(0.0f);
+            if (material.use_alt)
+                weight = weight + F(1.0f);
+            if (material.dust)
+                weight = weight + clamp(-world_normal.y, F(0.0f), F(1.0f));
+
+            if ((material.use_alt || material.dust) && (material.sheen_type == 1 || material.sheen_type == 2)) {
+
+                F layer;
+                if (material.sheen_type == 1)
+                    layer = sheenModel(P, N, camera, light_center, material.alpha, material.csheen, this->sheen);
+                else
+                    layer = cosineSheen(N, material.beta) * F(material.csheen / 10.0f);
+
+                layer = layer * weight;
+                result = {result.x + layer, result.y + layer, result.z + layer};
+
+            }
+
+            // Write the colors.
+            store(&batch->r[i], result.x);
+            store(&batch->g[i], result.y);
+            store(&batch->b[i], result.z);
+
+        }
+
+    }
+
+}  // namespace bgq_opengl
@@ -0,0 +1,120 @@
+/**
+ * @file ltc_reference.h
+ * @brief LTC reference class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_LTC_REFERENCE_H_
+#define BGQ_OPENGL_CLASSES_LTC_REFERENCE_H_
+
+#include "glm/glm.hpp"
+
+#include "structs/light_block/light_block.h"
+#include "structs/ltc_table/ltc_table.h"
+#include "structs/material_block/material_block.h"
+#include "structs/shading_batch/shading_batch.h"
+
+namespace bgq_opengl {
+
+    /**
+     * @brief Implements the shading of ltc.frag on the CPU.
+     *
+     * Implements the same area light integration and sheen layers as the
+     * fragment shader in shaders/ltc.frag (integrateEdge, evaluateLTC,
+     * sheenModel, cosineSheen and main), so images can be checked and
+     * benchmarked on machines without a GPU. The lookup tables are sampled
+     * bilinearly with clamped edges, as the texture units do with the
+     * GL_LINEAR filter of LTCMatrix.
+     *
+     * Points are shaded in batches with SIMD kernels, eight points at a time
+     * with AVX2 and four with SSE2, depending on what the compiler targets.
+     * The scalar path runs the same kernel one point at a time and is the
+     * reference the SIMD paths are checked against. exp and pow have no SIMD
+     * version here, so they are evaluated lane by lane.
+     *
+     * @author Borja García Quiroga <garcaqub@tcd.ie>
+     */
+    class LTCReference {
+
+        public:
+
+            /**
+             * @brief Constructs the reference with the given tables.
+             *
+             * Constructs the reference with the given lookup tables. The data
+             * is not copied, so it has to outlive the reference.
+             *
+             * @param ltc_1 The inverse M table (LTC1), 4 channels.
+             * @param ltc_2 The norm, Fresnel and horizon clipping table (LTC2), 4 channels.
+             * @param sheen The sheen coefficients table (SHEENCOEFFS), at least 3 channels.
+             */
+            LTCReference(const LTCTable& ltc_1, const LTCTable& ltc_2, const LTCTable& sheen);
+
+            /**
+             * @brief Get the instruction set of the SIMD path.
+             *
+             * Get the name of the instruction set the SIMD path was built for.
+             *
+             * @returns "AVX2", "SSE2" or "scalar".
+             */
+            static const char* getInstructionSet();
+
+            /**
+             * @brief Get the width of the SIMD path.
+             *
+             * Get the number of points the SIMD path shades at once.
+             *
+             * @returns 8, 4 or 1.
+             */
+            static int getWidth();
+
+            /**
+             * @brief Shade a batch of points.
+             *
+             * Shade every point of a batch as the fragment shader would and
+             * write the colors to the batch.
+             *
+             * @param light The area light, as uploaded to the LightBlock.
+             * @param material The material, as uploaded to the MaterialBlock.
+             * @param camera_position The value of the cameraPosition uniform.
+             * @param batch The points, which receive the colors.
+             * @param simd Whether to use the SIMD path or the scalar one.
+             */
+            void shade(const LightBlock& light, const MaterialBlock& material, const glm::vec3& camera_position, ShadingBatch* batch, bool simd = true) const;
+
+        private:
+
+            /**
+             * @brief Shade a range of points with a kernel.
+             *
+             * Shade the points from first to last, which must be a multiple
+             * of the width of the lane type apart.
+             *
+             * @param light The area light.
+             * @param material The material.
+             * @param camera_position The value of the cameraPosition uniform.
+             * @param batch The points.
+             * @param first The first point.
+             * @param last One past the last point.
+             */
+            template <class F>
+            void shadeRange(const LightBlock& light, const MaterialBlock& material, const glm::vec3& camera_position, ShadingBatch* batch, size_t first, size_t last) const;
+
+            LTCTable ltc_1;    /// The inverse M table.
+            LTCTable ltc_2;    /// The norm, Fresnel and horizon clipping table.
+            LTCTable sheen;    /// The sheen coefficients table.
+
+    };
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_LTC_REFERENCE_H_
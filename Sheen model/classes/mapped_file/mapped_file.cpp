@@ -0,0 +1,101 @@
+/**
+ * @file mapped_file.cpp
+ * @brief Mapped file class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "mapped_file.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace bgq_opengl {
+
+    MappedFile::MappedFile() {}
+
+    MappedFile::MappedFile(const char* filename) {
+
+        // Open the file and get its size.
+        int fd = ::open(filename, O_RDONLY);
+
+        if (fd < 0)
+            return;
+
+        struct stat info;
+
+        if (fstat(fd, &info) != 0) {
+
+            close(fd);
+            return;
+
+        }
+
+        this->size = (size_t) info.st_size;
+
+        // Empty files cannot be mapped, but they are open all the same.
+        if (this->size == 0) {
+
+            close(fd);
+            this->is_open = true;
+            return;
+
+        }
+
+        // Map it read-only. The mapping stays valid after closing the file.
+        void* mapping = mmap(NULL, this->size, PROT_READ, MAP_PRIVATE, fd, 0);
+        close(fd);
+
+        if (mapping == MAP_FAILED) {
+
+            this->size = 0;
+            return;
+
+        }
+
+        this->mapping = mapping;
+        this->is_open = true;
+
+    }
+
+    const unsigned char* MappedFile::getData() const {
+
+        return (const unsigned char*) this->mapping;
+
+    }
+
+    size_t MappedFile::getSize() const {
+
+        return this->size;
+
+    }
+
+    bool MappedFile::isOpen() const {
+
+        return this->is_open;
+
+    }
+
+    void MappedFile::remove() {
+
+        // Unmap the file, only once.
+        if (this->mapping != NULL)
+            munmap(this->mapping, this->size);
+
+        this->mapping = NULL;
+        this->size = 0;
+        this->is_open = false;
+
+    }
+
+}  // namespace bgq_opengl
@@ -0,0 +1,96 @@
+/**
+ * @file mapped_file.h
+ * @brief Mapped file class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_MAPPED_FILE_H_
+#define BGQ_OPENGL_CLASSES_MAPPED_FILE_H_
+
+#include <stddef.h>
+
+namespace bgq_opengl {
+
+    /**
+     * @brief Implements a read-only memory-mapped file.
+     *
+     * Implements a file mapped read-only into memory, so its contents can be
+     * read or handed to OpenGL without copying them first.
+     *
+     * @author Borja García Quiroga <garcaqub@tcd.ie>
+     */
+    class MappedFile {
+
+        public:
+
+            /**
+             * @brief Constructs an empty mapping.
+             *
+             * Constructs a mapping of no file.
+             */
+            MappedFile();
+
+            /**
+             * @brief Maps a file.
+             *
+             * Maps a whole file into memory. If it cannot be opened or mapped
+             * the mapping is left empty, see isOpen.
+             *
+             * @param filename The file.
+             */
+            MappedFile(const char* filename);
+
+            /**
+             * @brief Get the contents.
+             *
+             * Get the start of the mapped contents.
+             *
+             * @returns The contents, or NULL if nothing is mapped.
+             */
+            const unsigned char* getData() const;
+
+            /**
+             * @brief Get the size.
+             *
+             * Get the size of the mapped contents.
+             *
+             * @returns The size in bytes.
+             */
+            size_t getSize() const;
+
+            /**
+             * @brief Whether the file is mapped.
+             *
+             * Whether the file could be opened and mapped.
+             *
+             * @returns True if it is mapped.
+             */
+            bool isOpen() const;
+
+            /**
+             * @brief Unmaps the file.
+             *
+             * Unmaps the file. The pointers got from it are no longer valid.
+             */
+            void remove();
+
+        private:
+
+            void* mapping = NULL;   /// Start of the mapping.
+            size_t size = 0;        /// Size of the mapping in bytes.
+            bool is_open = false;   /// Whether the file is mapped.
+
+    };
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_MAPPED_FILE_H_
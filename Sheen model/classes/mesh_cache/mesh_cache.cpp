@@ -0,0 +1,277 @@
+/**
+ * @file mesh_cache.cpp
+ * @brief Mesh cache class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "mesh_cache.h"
+
+#include <stdint.h>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+
+#include "classes/geometry/geometry.h"
+#include "classes/hash/hash.h"
+#include "classes/mapped_file/mapped_file.h"
+#include "structs/bounding_box/bounding_box.h"
+#include "structs/mesh_cache_entry/mesh_cache_entry.h"
+#include "structs/mesh_cache_header/mesh_cache_header.h"
+#include "structs/mesh_data/mesh_data.h"
+#include "structs/packed_vertex/packed_vertex.h"
+#include "structs/vertex/vertex.h"
+
+namespace bgq_opengl {
+
+	namespace {
+
+		/**
+		 * Rounds an offset up to the alignment of the cache.
+		 */
+		uint64_t align(uint64_t offset) {
+
+			return (offset + MESH_CACHE_ALIGNMENT - 1) / MESH_CACHE_ALIGNMENT * MESH_CACHE_ALIGNMENT;
+
+		}
+
+		/**
+		 * Writes zeros until the file is at the given offset.
+		 */
+		bool pad(FILE* file, uint64_t* written, uint64_t offset) {
+
+			static const unsigned char zeros[MESH_CACHE_ALIGNMENT] = {0};
+
+			size_t count = (size_t) (offset - *written);
+			*written = offset;
+
+			return fwrite(zeros, 1, count, file) == count;
+
+		}
+
+	}  // namespace
+
+	MeshCache::MeshCache(const char* filename, unsigned int import_flags) {
+
+		this->filename = std::string(filename);
+		this->cache_filename = this->filename + MESH_CACHE_EXTENSION;
+		this->import_flags = import_flags;
+
+		// Hash the model. If it cannot be read there is nothing to key the cache with.
+		MappedFile source(filename);
+
+		if (!source.isOpen())
+			return;
+
+		this->source_hash = Hash::fnv1a(source.getData(), source.getSize());
+		this->source_size = source.getSize();
+		this->hashed = true;
+		source.remove();
+
+		// Map the cache, if there is one, and check it is for this model.
+		this->file = MappedFile(this->cache_filename.c_str());
+
+		if (!this->file.isOpen())
+			return;
+
+		this->valid = this->check();
+
+		if (!this->valid)
+			this->file.remove();
+
+	}
+
+	void MeshCache::getGeometries(std::vector<Geometry>* geoms, VertexFormat format, bool keep_vertices, bool upload) const {
+
+		const unsigned char* data = this->file.getData();
+
+		MeshCacheHeader header;
+		memcpy(&header, data, sizeof(header));
+
+		for (uint32_t i = 0; i < header.geometry_count; i++) {
+
+			MeshCacheEntry entry;
+			memcpy(&entry, data + header.entry_offset + i * sizeof(MeshCacheEntry), sizeof(entry));
+
+			BoundingBox bb;
+			bb.min = glm::vec3(entry.min[0], entry.min[1], entry.min[2]);
+			bb.max = glm::vec3(entry.max[0], entry.max[1], entry.max[2]);
+
+			// The arrays are aligned in the file, so they are used where they are.
+			const Vertex* vertices = (const Vertex*) (data + entry.vertex_offset);
+			const GLuint* indices = (const GLuint*) (data + entry.index_offset);
+
+			geoms->push_back(Geometry(vertices, entry.vertex_count, indices, entry.index_count, std::vector<Texture>(), entry.shininess, bb, format, keep_vertices, upload));
+
+		}
+
+	}
+
+	bool MeshCache::isValid() const {
+
+		return this->valid;
+
+	}
+
+	void MeshCache::remove() {
+
+		// Unmap the cache.
+		this->file.remove();
+		this->valid = false;
+
+	}
+
+	bool MeshCache::write(const std::vector<MeshData>& meshes) const {
+
+		// Without the hash of the model the cache could not be checked later.
+		if (!this->hashed)
+			return false;
+
+		// Lay the entries out after the header, then the vertices and indices of every geometry.
+		MeshCacheHeader header;
+		memcpy(header.magic, MESH_CACHE_MAGIC, 4);
+		header.version = MESH_CACHE_VERSION;
+		header.vertex_size = sizeof(Vertex);
+		header.import_flags = this->import_flags;
+		header.source_hash = this->source_hash;
+		header.source_size = this->source_size;
+		header.geometry_count = (uint32_t) meshes.size();
+		header.entry_offset = (uint32_t) align(sizeof(header));
+
+		std::vector<MeshCacheEntry> entries(meshes.size());
+		uint64_t offset = align(header.entry_offset + entries.size() * sizeof(MeshCacheEntry));
+
+		for (size_t i = 0; i < meshes.size(); i++) {
+
+			MeshCacheEntry& entry = entries[i];
+			memset(&entry, 0, sizeof(entry));
+			entry.vertex_count = (uint32_t) meshes[i].vertices.size();
+			entry.index_count = (uint32_t) meshes[i].indices.size();
+			entry.shininess = meshes[i].shininess;
+			memcpy(entry.min, &meshes[i].bounding_box.min.x, sizeof(entry.min));
+			memcpy(entry.max, &meshes[i].bounding_box.max.x, sizeof(entry.max));
+
+			entry.vertex_offset = offset;
+			offset = align(offset + (uint64_t) entry.vertex_count * sizeof(Vertex));
+			entry.index_offset = offset;
+			offset = align(offset + (uint64_t) entry.index_count * sizeof(GLuint));
+
+		}
+
+		header.file_size = offset;
+
+		// Write a temporary file and move it over the old cache, so a run that stops halfway never leaves half a cache.
+		std::string temporary = this->cache_filename + ".tmp";
+		FILE* out = fopen(temporary.c_str(), "wb");
+
+		if (out == NULL) {
+
+			std::cerr << "Mesh cache error: could not open " << temporary << ", the model will be imported again next time." << std::endl;
+			return false;
+
+		}
+
+		uint64_t written = 0;
+		bool ok = fwrite(&header, sizeof(header), 1, out) == 1;
+		written += sizeof(header);
+		ok = ok && pad(out, &written, header.entry_offset);
+		ok = ok && fwrite(entries.data(), sizeof(MeshCacheEntry), entries.size(), out) == entries.size();
+		written += entries.size() * sizeof(MeshCacheEntry);
+
+		for (size_t i = 0; i < meshes.size() && ok; i++) {
+
+			const std::vector<Vertex>& vertices = meshes[i].vertices;
+			const std::vector<GLuint>& indices = meshes[i].indices;
+
+			ok = pad(out, &written, entries[i].vertex_offset);
+			ok = ok && fwrite(vertices.data(), sizeof(Vertex), vertices.size(), out) == vertices.size();
+			written += vertices.size() * sizeof(Vertex);
+
+			ok = ok && pad(out, &written, entries[i].index_offset);
+			ok = ok && fwrite(indices.data(), sizeof(GLuint), indices.size(), out) == indices.size();
+			written += indices.size() * sizeof(GLuint);
+
+		}
+
+		ok = ok && pad(out, &written, header.file_size);
+		ok = fclose(out) == 0 && ok;
+		ok = ok && rename(temporary.c_str(), this->cache_filename.c_str()) == 0;
+
+		if (!ok) {
+
+			std::cerr << "Mesh cache error: could not write " << this->cache_filename << ", the model will be imported again next time." << std::endl;
+			std::remove(temporary.c_str());
+
+		}
+
+		return ok;
+
+	}
+
+	bool MeshCache::check() const {
+
+		const unsigned char* data = this->file.getData();
+		size_t size = this->file.getSize();
+
+		if (size < sizeof(MeshCacheHeader))
+			return false;
+
+		MeshCacheHeader header;
+		memcpy(&header, data, sizeof(header));
+
+		// It has to be a cache of this same model, imported the same way, by a build with the same vertex.
+		if (memcmp(header.magic, MESH_CACHE_MAGIC, 4) != 0 || header.version != MESH_CACHE_VERSION || header.vertex_size != sizeof(Vertex))
+			return false;
+
+		if (header.import_flags != this->import_flags || header.source_hash != this->source_hash || header.source_size != this->source_size)
+			return false;
+
+		// And it has to be all there.
+		if (header.file_size != size || header.entry_offset % MESH_CACHE_ALIGNMENT != 0)
+			return false;
+
+		if ((uint64_t) header.entry_offset + (uint64_t) header.geometry_count * sizeof(MeshCacheEntry) > size)
+			return false;
+
+		for (uint32_t i = 0; i < header.geometry_count; i++) {
+
+			MeshCacheEntry entry;
+			memcpy(&entry, data + header.entry_offset + i * sizeof(MeshCacheEntry), sizeof(entry));
+
+			if (entry.vertex_offset % MESH_CACHE_ALIGNMENT != 0 || entry.index_offset % MESH_CACHE_ALIGNMENT != 0)
+				return false;
+
+			if (entry.vertex_offset + (uint64_t) entry.vertex_count * sizeof(Vertex) > size)
+				return false;
+
+			if (entry.index_offset + (uint64_t) entry.index_count * sizeof(GLuint) > size)
+				return false;
+
+			// The offsets do not tell a cache corrupted in place, and an index past the vertices would be read out of bounds by the draws.
+			const GLuint* indices = (const GLuint*) (data + entry.index_offset);
+
+			for (uint32_t j = 0; j < entry.index_count; j++)
+				if (indices[j] >= entry.vertex_count)
+					return false;
+
+		}
+
+		return true;
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,128 @@
+/**
+ * @file mesh_cache.h
+ * @brief Mesh cache class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_MESH_CACHE_H_
+#define BGQ_OPENGL_CLASSES_MESH_CACHE_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "classes/geometry/geometry.h"
+#include "classes/mapped_file/mapped_file.h"
+#include "structs/mesh_cache_header/mesh_cache_header.h"
+#include "structs/mesh_data/mesh_data.h"
+#include "structs/packed_vertex/packed_vertex.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implements a binary cache of imported models.
+	 *
+	 * Implements a cache of the geometries a model imports to, written next
+	 * to the model with MESH_CACHE_EXTENSION appended. It is keyed by the hash
+	 * of the model file and the import flags, and mapped read-only so the
+	 * vertices and indices go straight from the file to the buffers.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class MeshCache {
+
+		public:
+
+			/**
+			 * @brief Opens the cache of a model.
+			 *
+			 * Hashes the model file and maps its cache, if there is one that
+			 * was written from the same file with the same flags.
+			 *
+			 * @param filename The model file.
+			 * @param import_flags The flags the model is imported with.
+			 */
+			MeshCache(const char* filename, unsigned int import_flags);
+
+			/**
+			 * @brief Builds the geometries.
+			 *
+			 * Builds the cached geometries, uploading them from the mapping.
+			 * The cache has to be valid.
+			 *
+			 * @param geoms Outputs the geometries, added at the end.
+			 * @param format Layout the vertices are uploaded in.
+			 * @param keep_vertices Whether the geometries keep a CPU copy of their vertices.
+			 * @param upload Whether to upload them, else they only keep the CPU copy.
+			 */
+			void getGeometries(std::vector<Geometry>* geoms, VertexFormat format = VERTEX_FORMAT_FULL, bool keep_vertices = true, bool upload = true) const;
+
+			/**
+			 * @brief Whether the cache can be used.
+			 *
+			 * Whether there is a cache for the model and flags, and it is
+			 * complete.
+			 *
+			 * @returns True if it can be used.
+			 */
+			bool isValid() const;
+
+			/**
+			 * @brief Unmaps the cache.
+			 *
+			 * Unmaps the cache. It is no longer valid.
+			 */
+			void remove();
+
+			/**
+			 * @brief Writes the cache.
+			 *
+			 * Writes the cache of the model from its imported meshes,
+			 * replacing any stale one. Failing to write it is not an error,
+			 * the model is just imported again next time. It does not touch
+			 * OpenGL, so it can run on any thread.
+			 *
+			 * @param meshes The imported meshes.
+			 *
+			 * @returns True if it was written.
+			 */
+			bool write(const std::vector<MeshData>& meshes) const;
+
+		private:
+
+			/**
+			 * @brief Checks the mapped cache.
+			 *
+			 * Checks that the mapped cache is for this model and flags, that
+			 * every entry is inside the file and that every index points to a
+			 * vertex of its geometry.
+			 *
+			 * @returns True if it can be used.
+			 */
+			bool check() const;
+
+			std::string filename;			/// The model file.
+			std::string cache_filename;		/// The cache file.
+			unsigned int import_flags;		/// Flags the model is imported with.
+			uint64_t source_hash = 0;		/// Hash of the model file.
+			uint64_t source_size = 0;		/// Bytes of the model file.
+			bool hashed = false;			/// Whether the model file could be read.
+			MappedFile file;				/// The mapped cache.
+			bool valid = false;				/// Whether the cache can be used.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_MESH_CACHE_H_
@@ -0,0 +1,152 @@
+/**
+ * @file mesh_converter.cpp
+ * @brief Mesh converter class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "mesh_converter.h"
+
+#include <algorithm>
+#include <vector>
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+#include "assimp/scene.h"
+
+#include "classes/thread_pool/thread_pool.h"
+#include "structs/bounding_box/bounding_box.h"
+#include "structs/mesh_data/mesh_data.h"
+#include "structs/vertex/vertex.h"
+
+namespace bgq_opengl {
+
+	namespace {
+
+		const size_t VERTEX_BLOCK = 16384;		// Vertices converted per task.
+
+	}  // namespace
+
+	void MeshConverter::convert(const aiScene* scene, const aiMesh* mesh, MeshData* data, ThreadPool* pool) {
+
+		// Get the color and shininess from the material.
+		const aiMaterial* material = scene->mMaterials[mesh->mMaterialIndex];
+		aiColor3D color;
+		material->Get(AI_MATKEY_COLOR_DIFFUSE, color);
+		float shine = 0.0;
+		material->Get(AI_MATKEY_SHININESS, shine);
+
+		data->shininess = shine;
+
+		// Size both arrays once, the conversion only writes into them.
+		size_t count = mesh->mNumVertices;
+		data->vertices.resize(count);
+		data->indices.resize((size_t) mesh->mNumFaces * 3);
+
+		data->indices.resize(MeshConverter::convertFaces(mesh, data->indices.data()));
+
+		if (count == 0) {
+
+			data->bounding_box.min = glm::vec3(0.0f);
+			data->bounding_box.max = glm::vec3(0.0f);
+			return;
+
+		}
+
+		// Small meshes, or no threads, are converted here in one go.
+		size_t blocks = (count + VERTEX_BLOCK - 1) / VERTEX_BLOCK;
+		glm::vec3 vertex_color(color.r, color.g, color.b);
+		Vertex* vertices = data->vertices.data();
+
+		if (pool == NULL || blocks == 1) {
+
+			MeshConverter::convertVertices(mesh, vertex_color, 0, count, vertices, &data->bounding_box);
+			return;
+
+		}
+
+		// Else every block is converted by a thread, and their boxes merged.
+		std::vector<BoundingBox> boxes(blocks);
+
+		pool->run((int) blocks, [&](int block, int /*thread*/) {
+			size_t begin = block * VERTEX_BLOCK;
+			MeshConverter::convertVertices(mesh, vertex_color, begin, std::min(begin + VERTEX_BLOCK, count), vertices, &boxes[block]);
+		});
+
+		data->bounding_box = boxes[0];
+
+		for (size_t i = 1; i < blocks; i++) {
+
+			data->bounding_box.min = glm::min(data->bounding_box.min, boxes[i].min);
+			data->bounding_box.max = glm::max(data->bounding_box.max, boxes[i].max);
+
+		}
+
+	}
+
+	size_t MeshConverter::convertFaces(const aiMesh* mesh, GLuint* indices) {
+
+		size_t written = 0;
+
+		for (unsigned int j = 0; j < mesh->mNumFaces; j++) {
+
+			const aiFace& face = mesh->mFaces[j];
+
+			if (face.mNumIndices != 3)
+				continue;
+
+			indices[written] = face.mIndices[0];
+			indices[written + 1] = face.mIndices[1];
+			indices[written + 2] = face.mIndices[2];
+			written += 3;
+
+		}
+
+		return written;
+
+	}
+
+	void MeshConverter::convertVertices(const aiMesh* mesh, const glm::vec3& color, size_t begin, size_t end, Vertex* vertices, BoundingBox* bb) {
+
+		// Get the source arrays once. The ones the mesh does not have are NULL.
+		const aiVector3D* positions = mesh->HasPositions() ? mesh->mVertices : NULL;
+		const aiVector3D* normals = mesh->HasNormals() ? mesh->mNormals : NULL;
+		const aiVector3D* uvs = mesh->HasTextureCoords(0) ? mesh->mTextureCoords[0] : NULL;
+		const aiVector3D* tangents = mesh->HasTangentsAndBitangents() ? mesh->mTangents : NULL;
+		const aiVector3D* bitangents = mesh->HasTangentsAndBitangents() ? mesh->mBitangents : NULL;
+
+		glm::vec3 min(positions ? positions[begin].x : 0.0f, positions ? positions[begin].y : 0.0f, positions ? positions[begin].z : 0.0f);
+		glm::vec3 max = min;
+
+		// The branches do not change inside the loop, so they are always predicted.
+		for (size_t i = begin; i < end; i++) {
+
+			Vertex& vertex = vertices[i];
+
+			// Missing attributes get the same defaults the vertex always had.
+			vertex.position = positions ? glm::vec3(positions[i].x, positions[i].y, positions[i].z) : glm::vec3(0.0f, 0.0f, 0.0f);
+			vertex.normal = normals ? glm::vec3(normals[i].x, normals[i].y, normals[i].z) : glm::vec3(1.0f, 1.0f, 1.0f);
+			vertex.color = color;
+			vertex.uv = uvs ? glm::vec2(-uvs[i].y, uvs[i].x) : glm::vec2(0.0f, 0.0f);
+			vertex.tangent = tangents ? glm::vec3(tangents[i].x, tangents[i].y, tangents[i].z) : glm::vec3(0.0f, 1.0f, 0.0f);
+			vertex.bitangent = bitangents ? glm::vec3(bitangents[i].x, bitangents[i].y, bitangents[i].z) : glm::vec3(1.0f, 0.0f, 0.0f);
+
+			min = glm::min(min, vertex.position);
+			max = glm::max(max, vertex.position);
+
+		}
+
+		bb->min = min;
+		bb->max = max;
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,93 @@
+/**
+ * @file mesh_converter.h
+ * @brief Mesh converter class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_MESH_CONVERTER_H_
+#define BGQ_OPENGL_CLASSES_MESH_CONVERTER_H_
+
+#include <stddef.h>
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+#include "assimp/scene.h"
+
+#include "classes/thread_pool/thread_pool.h"
+#include "structs/bounding_box/bounding_box.h"
+#include "structs/mesh_data/mesh_data.h"
+#include "structs/vertex/vertex.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Converts Assimp meshes to the vertex layout of Geometry.
+	 *
+	 * Converts the separate arrays of an aiMesh into the interleaved Vertex
+	 * array and the index buffer in one pass, with one allocation each. It
+	 * does not touch OpenGL, so meshes can be converted on any thread, and a
+	 * large one can be split in vertex ranges over a ThreadPool.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class MeshConverter {
+
+		public:
+
+			/**
+			 * @brief Converts a mesh.
+			 *
+			 * Converts a mesh, with its material color and shininess, and
+			 * computes its bounding box on the way.
+			 *
+			 * @param scene The scene the mesh is in, for its material.
+			 * @param mesh The mesh.
+			 * @param data Outputs the converted mesh.
+			 * @param pool Threads to split the vertices over, NULL to convert them on this one.
+			 */
+			static void convert(const aiScene* scene, const aiMesh* mesh, MeshData* data, ThreadPool* pool = NULL);
+
+		private:
+
+			/**
+			 * @brief Converts the faces.
+			 *
+			 * Copies the indices of every triangle. Points and lines, which
+			 * triangulating leaves as they are, are skipped.
+			 *
+			 * @param mesh The mesh.
+			 * @param indices Outputs the indices, room for three per face.
+			 *
+			 * @returns Number of indices written.
+			 */
+			static size_t convertFaces(const aiMesh* mesh, GLuint* indices);
+
+			/**
+			 * @brief Converts a range of vertices.
+			 *
+			 * Interleaves the vertices in [begin, end), filling in the
+			 * attributes the mesh does not have, and gets their bounding box.
+			 *
+			 * @param mesh The mesh.
+			 * @param color Color of every vertex.
+			 * @param begin First vertex.
+			 * @param end One past the last vertex.
+			 * @param vertices Outputs the vertices, indexed as in the mesh.
+			 * @param bb Outputs the bounding box of the range, which must not be empty.
+			 */
+			static void convertVertices(const aiMesh* mesh, const glm::vec3& color, size_t begin, size_t end, Vertex* vertices, BoundingBox* bb);
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_MESH_CONVERTER_H_
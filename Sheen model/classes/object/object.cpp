@@ -17,9 +17,12 @@
 
 #include <cassert>
 #include <iostream>
+#include <utility>
 
+#include "classes/cpu_profiler/cpu_profiler.h"
 #include "classes/loader/loader.h"
 #include "classes/loader_assimp/loader_assimp.h"
+#include "classes/scene_graph/scene_graph.h"
 #include "structs/vertex/vertex.h"
 #include "structs/bounding_box/bounding_box.h"
 
@@ -48,15 +51,32 @@ namespace bgq_opengl {
 
 		(*model_loader).getGeometries(&this->geoms, &this->matrices_geoms);
 
+		this->buildGraph();
+		this->computeBoundingBox();
+
+	}
+
+	Object::Object(Loader* model_loader) {
+
+		// Upload what was imported and take the geometries.
+		model_loader->uploadModel();
+		model_loader->getGeometries(&this->geoms, &this->matrices_geoms);
+
+		this->buildGraph();
+		this->computeBoundingBox();
+
 	}
 
 	Object::Object(std::vector<Geometry> geometries) {
 
-		// Copy the geometries.
-		this->geoms = geometries;
+		// Take the geometries, they were already copied into the argument.
+		this->geoms = std::move(geometries);
 
 		// Get an identity matrix for each.
-		this->matrices_geoms = std::vector<glm::mat4>(geometries.size(), glm::mat4(1.0f));
+		this->matrices_geoms = std::vector<glm::mat4>(this->geoms.size(), glm::mat4(1.0f));
+
+		this->buildGraph();
+		this->computeBoundingBox();
 
 	}
 
@@ -80,62 +100,164 @@ namespace bgq_opengl {
     }
 
 	void Object::draw(bgq_opengl::Shader& shader, bgq_opengl::Camera& camera) {
+
+		PROFILE_ZONE("Object::draw");
         
-		// Go over all meshes and draw each one
+		// Only the matrices of what moved are computed, unless the camera did.
+		this->updateTransforms();
+		this->graph.updateViews(camera.getView());
+
+		// Get the transformed boxes. They are only transformed again if the geometry moved.
+		this->culler.resize(this->geoms.size());
+
+		for (size_t i = 0; i < this->geoms.size(); i++)
+			this->culler.setBox(i, this->geoms[i].getWorldBoundingBox());
+
+		// Test them all at once, before anything is bound.
+		size_t inside = this->culler.cull(camera.getFrustum(), &this->visible);
+
+		this->cull_stats.tested = (unsigned int) this->geoms.size();
+		this->cull_stats.culled = (unsigned int) (this->geoms.size() - inside);
+
+		// Go over the meshes inside and draw each one
 		for (unsigned int i = 0; i < this->geoms.size(); i++)
 		{
-			geoms[i].draw(shader, camera);
+			if (this->visible[i])
+				geoms[i].draw(shader, camera, this->graph.getModelView(i + 1), this->graph.getNormalMatrix(i + 1));
 		}
         
 	}
 
-	BoundingBox Object::getBoundingBox() {
+	void Object::drawInstanced(bgq_opengl::Shader& shader, bgq_opengl::Camera& camera) {
 
-		// Create the bb.
-		BoundingBox global_bb = this->geoms[0].getBoundingBox();
+		PROFILE_ZONE("Object::drawInstanced");
 
-		// Loop through the vertices and get tge min and max values.
-		for (int i = 1; i < this->geoms.size(); i++) {
+		this->updateTransforms();
+		this->graph.updateViews(camera.getView());
 
-			// Get the current bb.
-			BoundingBox bb = this->geoms[i].getBoundingBox();
+		// Each geometry is a single call, whatever the number of instances.
+		for (size_t i = 0; i < this->geoms.size(); i++)
+			geoms[i].draw(shader, camera, this->graph.getModelView((int) i + 1), this->graph.getNormalMatrix((int) i + 1), (GLsizei) this->instance_count);
 
-			if (global_bb.min.x > bb.min.x)
-				global_bb.min.x = bb.min.x;
+		this->cull_stats.tested = (unsigned int) this->geoms.size();
+		this->cull_stats.culled = 0;
 
-			if (global_bb.min.y > bb.min.y)
-				global_bb.min.y = bb.min.y;
+	}
+
+	size_t Object::getInstanceCount() {
 
-			if (global_bb.min.z > bb.min.z)
-				global_bb.min.z = bb.min.z;
+		return this->instance_count;
 
-			if (global_bb.max.x < bb.max.x)
-				global_bb.max.x = bb.max.x;
+	}
 
-			if (global_bb.max.y < bb.max.y)
-				global_bb.max.y = bb.max.y;
+	void Object::setInstances(const std::vector<InstanceData> &instances) {
 
-			if (global_bb.max.z < bb.max.z)
-				global_bb.max.z = bb.max.z;
+		this->instances.update(instances.data(), instances.size() * sizeof(InstanceData));
+		this->instances.unbind();
+		this->instance_count = instances.size();
+
+		// The VAOs keep pointing to the buffer when it is filled again.
+		if (!this->instances_linked) {
+
+			for (size_t i = 0; i < this->geoms.size(); i++)
+				this->geoms[i].linkInstances(this->instances);
+
+			this->instances_linked = true;
 
 		}
 
+	}
+
+	Object::CullStats Object::getCullStats() {
+
+		return this->cull_stats;
+
+	}
+
+	BoundingBox Object::getBoundingBox() {
+
+		return this->bounding_box;
+
+	}
+
+	BoundingBox Object::getWorldBoundingBox() {
+
+		if (this->geoms.empty())
+			return this->bounding_box;
+
+		this->updateTransforms();
+
+		// Each geometry keeps its own, so this is only a union unless they moved.
+		BoundingBox global_bb = this->geoms[0].getWorldBoundingBox();
+
+		for (size_t i = 1; i < this->geoms.size(); i++)
+			global_bb = get_union(global_bb, this->geoms[i].getWorldBoundingBox());
+
 		return global_bb;
 
 	}
 
-	std::vector<Geometry> Object::getGeometries() {
+	void Object::buildGraph() {
+
+		int root = this->graph.addNode();
+
+		for (size_t i = 0; i < this->geoms.size(); i++) {
+
+			int node = this->graph.addNode(root);
+			this->graph.setLocal(node, this->geoms[i].getTransformMat());
+
+		}
+
+	}
+
+	void Object::computeBoundingBox() {
+
+		// Objects with no geometries get an empty box.
+		if (this->geoms.empty()) {
+
+			this->bounding_box.min = glm::vec3(0.0f);
+			this->bounding_box.max = glm::vec3(0.0f);
+			return;
+
+		}
+
+		// Join the boxes of the geometries, which were computed when they were built.
+		this->bounding_box = this->geoms[0].getBoundingBox();
+
+		for (size_t i = 1; i < this->geoms.size(); i++)
+			this->bounding_box = get_union(this->bounding_box, this->geoms[i].getBoundingBox());
+
+	}
+
+	const std::vector<Geometry>& Object::getGeometries() {
+
+		this->updateTransforms();
 
 		return this->geoms;
 
 	}
 
-	std::vector<glm::mat4> Object::getGeometryMatrices() {
+	Geometry& Object::getGeometry(int num) {
+
+		this->updateTransforms();
+
+		return this->geoms[num];
+
+	}
+
+	const std::vector<glm::mat4>& Object::getGeometryMatrices() {
 
 		return this->matrices_geoms;
 
 	}
 
+	void Object::releaseVertices() {
+
+		for (size_t i = 0; i < this->geoms.size(); i++)
+			this->geoms[i].releaseVertices();
+
+	}
+
     void Object::setShininess(float shine) {
         
         for (int i = 0; i < this->geoms.size(); i++) {
@@ -146,13 +268,15 @@ namespace bgq_opengl {
 
     glm::mat4 Object::getTransformMat(int num) {
         
+        this->updateTransforms();
+        
         return this->geoms[num].getTransformMat();
         
     }
 
     void Object::setTransformMat(int num, glm::mat4 transform) {
         
-        this->geoms[num].setTransformMat(transform);
+        this->graph.setLocal(num + 1, transform);
         
     }
 
@@ -164,63 +288,75 @@ namespace bgq_opengl {
 
 	void Object::resetTransforms() {
 
-		// Do the same for the subobjects.
-		for (size_t i = 0; i < geoms.size(); i++) {
-
-			geoms[i].resetTransforms();
-
-		}
+		// Nothing is computed for the nodes that were already identities.
+		for (size_t node = 0; node < this->graph.getSize(); node++)
+			this->graph.setLocal((int) node, glm::mat4(1.0f));
 
 	}
 
 	void Object::rotate(float x, float y, float z, float angle) {
 
-		// Do the same for the subobjects.
-		for (size_t i = 0; i < geoms.size(); i++) {
-
-			geoms[i].rotate(x, y, z, angle);
-
-		}
+		// The geometries inherit it from the object node.
+		this->rotate(-1, x, y, z, angle);
 
 	}
 
 	void Object::rotate(int num, float x, float y, float z, float angle) {
 
-		geoms[num].rotate(x, y, z, angle);
+		// Create a rotation matrix.
+		glm::mat4 rotation_matrix = glm::rotate(glm::mat4(1.0f), glm::radians(angle), glm::vec3(x, y, z));
+
+		this->graph.setLocal(num + 1, this->graph.getLocal(num + 1) * rotation_matrix);
 
 	}
 
 	void Object::scale(float x, float y, float z) {
 
-		// Do the same for the subobjects.
-		for (size_t i = 0; i < geoms.size(); i++) {
-
-			geoms[i].scale(x, y, z);
-
-		}
+		// The geometries inherit it from the object node.
+		this->scale(-1, x, y, z);
 
 	}
 
 	void Object::scale(int num, float x, float y, float z) {
 
-		geoms[num].scale(x, y, z);
+		// Create the scale matrix.
+		glm::mat4 scale_matrix = glm::scale(glm::mat4(1.0f), glm::vec3(x, y, z));
+
+		this->graph.setLocal(num + 1, this->graph.getLocal(num + 1) * scale_matrix);
 
 	}
 
 	void Object::translate(float x, float y, float z) {
 
-		// Do the same for the subobjects.
-		for (size_t i = 0; i < geoms.size(); i++) {
+		// The geometries inherit it from the object node.
+		this->translate(-1, x, y, z);
 
-			geoms[i].translate(x, y, z);
+	}
 
-		}
+	void Object::translate(int num, float x, float y, float z) {
+
+		// Get the translation matrix.
+		glm::mat4 trans_matrix = glm::translate(glm::mat4(1.0f), glm::vec3(x, y, z));
+
+		this->graph.setLocal(num + 1, this->graph.getLocal(num + 1) * trans_matrix);
 
 	}
 
-	void Object::translate(int num, float x, float y, float z) {
+	void Object::updateTransforms() {
+
+		PROFILE_ZONE("Object::updateTransforms");
 
-		geoms[num].translate(x, y, z);
+		this->graph.updateWorlds(&this->changed_nodes);
+
+		// Geometries only transform their bounding boxes again when they get a new matrix.
+		for (size_t i = 0; i < this->changed_nodes.size(); i++) {
+
+			int node = this->changed_nodes[i];
+
+			if (node > 0)
+				this->geoms[node - 1].setTransformMat(this->graph.getWorld(node));
+
+		}
 
 	}
 
@@ -18,14 +18,33 @@
 
 #include <vector>
 
+#include "classes/camera/camera.h"
+#include "classes/frustum_culler/frustum_culler.h"
 #include "classes/geometry/geometry.h"
+#include "classes/loader/loader.h"
+#include "classes/scene_graph/scene_graph.h"
+#include "classes/vbo/vbo.h"
 #include "structs/bounding_box/bounding_box.h"
+#include "structs/instance_data/instance_data.h"
 
 namespace bgq_opengl {
 
 	class Object {
 	
 		public:
+
+			/**
+			 * @brief Counters of the frustum culling.
+			 *
+			 * Counters of the geometries tested against the view frustum and
+			 * the ones that were not drawn because they were outside.
+			 */
+			struct CullStats {
+
+				unsigned int tested = 0;	/// Geometries tested.
+				unsigned int culled = 0;	/// Geometries outside the frustum.
+
+			};
 			
 			/**
 			 * @brief Loads a model in the specified format.
@@ -45,6 +64,16 @@ namespace bgq_opengl {
 			 * @param geometries The geometries that will be part of the object.
 			 */
 			Object(std::vector<Geometry> geometries);
+
+			/**
+			 * @brief Builds the object from a loader.
+			 *
+			 * Builds the object from a loader whose model was already imported,
+			 * maybe on another thread, uploading it on this one.
+			 *
+			 * @param model_loader The loader, after importModel.
+			 */
+			Object(Loader* model_loader);
         
             /**
              * @brief Add a new texture to all geometries.
@@ -70,32 +99,105 @@ namespace bgq_opengl {
 			/**
 			 * @brief Draws this object.
 			 *
-			 * Draws this object.
+			 * Draws the geometries of this object that are inside the view
+			 * frustum of the camera. The rest are not bound at all. Their
+			 * matrices are only computed again if the transforms or the view
+			 * changed.
 			 */
 			void draw(Shader &shader, Camera &camera);
 
+			/**
+			 * @brief Draws all the instances of this object.
+			 *
+			 * Draws every geometry once for all the instances, in a single
+			 * call each, with the model matrix and material of every instance
+			 * on top of the transforms of the object. The instances are spread
+			 * out, so nothing is culled. The shader has to read the instance
+			 * attributes, as the INSTANCED permutations of the LTC shaders do.
+			 */
+			void drawInstanced(Shader &shader, Camera &camera);
+
+			/**
+			 * @brief Get the number of instances.
+			 *
+			 * Get the number of instances drawInstanced draws.
+			 *
+			 * @returns The number of instances.
+			 */
+			size_t getInstanceCount();
+
+			/**
+			 * @brief Set the instances.
+			 *
+			 * Uploads the instances drawInstanced draws, replacing the ones
+			 * there were.
+			 *
+			 * @param instances The model matrix and material of every instance.
+			 */
+			void setInstances(const std::vector<InstanceData> &instances);
+
+			/**
+			 * @brief Get the culling counters.
+			 *
+			 * Get the culling counters of the last draw.
+			 *
+			 * @returns The counters.
+			 */
+			CullStats getCullStats();
+
 			/**
 			 * @brief Gets the bounding box.
 			 *
-			 * Gets the bounding box of all the geometries.
+			 * Gets the bounding box of all the geometries, computed when the
+			 * object was built.
 			 *
 			 * @returns The bounding box struct.
 			 */
 			BoundingBox getBoundingBox();
 
+			/**
+			 * @brief Gets the transformed bounding box.
+			 *
+			 * Gets the bounding box of all the geometries after their
+			 * transforms. Only the geometries whose transforms changed are
+			 * transformed again.
+			 *
+			 * @returns The bounding box struct.
+			 */
+			BoundingBox getWorldBoundingBox();
+
 			/**
 			 * @brief Get the geometries of the object.
 			 * 
-			 * Get the geometries of the object.
+			 * Get the geometries of the object, without copying them.
 			 */
-			std::vector<Geometry> getGeometries();
+			const std::vector<Geometry>& getGeometries();
+
+			/**
+			 * @brief Get a geometry of the object.
+			 *
+			 * Get a geometry of the object, without copying it.
+			 *
+			 * @param num The geometry index.
+			 *
+			 * @returns The geometry.
+			 */
+			Geometry& getGeometry(int num);
 
 			/**
 			 * @brief Get the matrices of the geometries.
 			 * 
-			 * Get the matrices of the geometries.
+			 * Get the matrices of the geometries, without copying them.
 			 */
-			std::vector<glm::mat4> getGeometryMatrices();
+			const std::vector<glm::mat4>& getGeometryMatrices();
+
+			/**
+			 * @brief Release the CPU copies of the vertices.
+			 *
+			 * Release the CPU copies of the vertices of all the geometries.
+			 * They can still be drawn, but not by the software renderer.
+			 */
+			void releaseVertices();
         
             /**
              * @brief Set the object shininess.
@@ -107,7 +209,8 @@ namespace bgq_opengl {
             /**
              * @brief Get the current transform matrix.
              *
-             * Get the current transform matrix.
+             * Get the current transform matrix of a geometry, with the ones of
+             * the whole object applied.
              *
              * @param num The geometry index this will apply to.
              *
@@ -118,7 +221,8 @@ namespace bgq_opengl {
             /**
              * @brief Set the transform matrix.
              *
-             * Set the transform matrix.
+             * Set the transform matrix of a geometry, relative to the ones of
+             * the whole object.
              *
              * @param num The geometry index this will apply to.
              * @param transform The transform matrix.
@@ -214,9 +318,41 @@ namespace bgq_opengl {
 
 		private:
 
+			/**
+			 * @brief Builds the scene graph.
+			 *
+			 * Builds a node for the whole object and one for each geometry
+			 * under it, with the transforms the geometries came with.
+			 */
+			void buildGraph();
+
+			/**
+			 * @brief Computes the bounding box.
+			 *
+			 * Computes the bounding box of all the geometries and keeps it.
+			 */
+			void computeBoundingBox();
+
+			/**
+			 * @brief Applies the transforms.
+			 *
+			 * Computes the world matrices of the nodes whose transforms changed
+			 * and passes them to their geometries.
+			 */
+			void updateTransforms();
+
 			// All the geometries and transformations
 			std::vector<Geometry> geoms;
 			std::vector<glm::mat4> matrices_geoms;
+			SceneGraph graph;				/// Node 0 is the whole object, node i + 1 the geometry i.
+			std::vector<int> changed_nodes;	/// Nodes computed by the last updateTransforms.
+			VBO instances;					/// Model matrix and material of every instance.
+			size_t instance_count = 0;		/// Number of instances uploaded.
+			bool instances_linked = false;	/// Whether the geometries read the instances yet.
+			BoundingBox bounding_box;		/// Bounding box of all the geometries.
+			FrustumCuller culler;			/// Transformed bounding box of every geometry, to test them together.
+			std::vector<unsigned char> visible;	/// Whether every geometry was inside the frustum in the last draw.
+			CullStats cull_stats;			/// Culling counters of the last draw.
 
 	};
 
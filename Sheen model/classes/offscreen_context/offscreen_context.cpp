@@ -0,0 +1,173 @@
+/**
+ * @file offscreen_context.cpp
+ * @brief Offscreen context class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "offscreen_context.h"
+
+#include <iostream>
+
+#include "GL/glew.h"
+#include "GLFW/glfw3.h"
+
+#ifdef BGQ_OPENGL_EGL
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+#endif
+
+namespace bgq_opengl {
+
+	OffscreenContext::OffscreenContext() {
+
+		// Try without any surface first, then with a hidden window.
+		bool surfaceless = this->createSurfaceless();
+
+		if (!surfaceless)
+			this->createHiddenWindow();
+
+		// Initialize GLEW. Core contexts need the experimental flag on some drivers.
+		glewExperimental = GL_TRUE;
+
+#ifdef BGQ_OPENGL_EGL
+		// glewInit looks for a GLX display, which an EGL context does not have.
+		GLenum res = surfaceless ? glewContextInit() : glewInit();
+#else
+		GLenum res = glewInit();
+#endif
+
+		if (res != GLEW_OK) {
+
+			std::cerr << "Offscreen context error: GLEW could not be initialized: " << glewGetErrorString(res) << std::endl;
+			exit(1);
+
+		}
+
+		// GLEW can leave an error behind on core contexts.
+		glGetError();
+
+	}
+
+	bool OffscreenContext::isSurfaceless() {
+
+		return this->window == NULL;
+
+	}
+
+	void OffscreenContext::remove() {
+
+#ifdef BGQ_OPENGL_EGL
+		if (this->context != EGL_NO_CONTEXT) {
+
+			// Release and destroy the EGL context.
+			eglMakeCurrent(this->display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+			eglDestroyContext(this->display, this->context);
+			eglTerminate(this->display);
+			this->context = EGL_NO_CONTEXT;
+
+		}
+#endif
+
+		if (this->window != NULL) {
+
+			// Close the window and any other GLFW resources.
+			glfwDestroyWindow(this->window);
+			glfwTerminate();
+			this->window = NULL;
+
+		}
+
+	}
+
+	void OffscreenContext::createHiddenWindow() {
+
+		// Start GLFW.
+		if (!glfwInit()) {
+
+			std::cerr << "Offscreen context error: could not start GLFW3." << std::endl;
+			exit(1);
+
+		}
+
+		// Same context as the windowed mode, but never shown.
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+		glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 2);
+		glfwWindowHint(GLFW_OPENGL_FORWARD_COMPAT, GL_TRUE);
+		glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+		glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+
+		// The size does not matter, everything is rendered into framebuffers.
+		this->window = glfwCreateWindow(64, 64, "", NULL, NULL);
+		if (!this->window) {
+
+			std::cerr << "Offscreen context error: could not create the hidden window." << std::endl;
+			glfwTerminate();
+			exit(1);
+
+		}
+
+		glfwMakeContextCurrent(this->window);
+
+	}
+
+	bool OffscreenContext::createSurfaceless() {
+
+#ifdef BGQ_OPENGL_EGL
+		// Get a display on the surfaceless platform, which needs no display server.
+		PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay = (PFNEGLGETPLATFORMDISPLAYEXTPROC) eglGetProcAddress("eglGetPlatformDisplayEXT");
+		if (getPlatformDisplay == NULL)
+			return false;
+
+		this->display = getPlatformDisplay(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, NULL);
+		if (this->display == EGL_NO_DISPLAY || !eglInitialize(this->display, NULL, NULL))
+			return false;
+
+		// Create a desktop OpenGL core context. No config is needed without surfaces.
+		const EGLint attributes[] = {
+			EGL_CONTEXT_MAJOR_VERSION, 3,
+			EGL_CONTEXT_MINOR_VERSION, 2,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+
+		if (!eglBindAPI(EGL_OPENGL_API)) {
+
+			eglTerminate(this->display);
+			return false;
+
+		}
+
+		this->context = eglCreateContext(this->display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, attributes);
+		if (this->context == EGL_NO_CONTEXT) {
+
+			eglTerminate(this->display);
+			return false;
+
+		}
+
+		if (!eglMakeCurrent(this->display, EGL_NO_SURFACE, EGL_NO_SURFACE, this->context)) {
+
+			eglDestroyContext(this->display, this->context);
+			eglTerminate(this->display);
+			this->context = EGL_NO_CONTEXT;
+			return false;
+
+		}
+
+		return true;
+#else
+		return false;
+#endif
+
+	}
+
+}  // namespace bgq_opengl
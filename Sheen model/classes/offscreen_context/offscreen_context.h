@@ -0,0 +1,98 @@
+/**
+ * @file offscreen_context.h
+ * @brief Offscreen context class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_OFFSCREEN_CONTEXT_H_
+#define BGQ_OPENGL_CLASS_OFFSCREEN_CONTEXT_H_
+
+#include <stddef.h>
+
+#include "GL/glew.h"
+#include "GLFW/glfw3.h"
+
+#ifdef BGQ_OPENGL_EGL
+#include <EGL/egl.h>
+#endif
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of an OpenGL context without a display.
+	 *
+	 * Implementation of an OpenGL context to render offscreen. Builds defining
+	 * BGQ_OPENGL_EGL first try a surfaceless EGL context, which needs no
+	 * display server and works with software rasterizers such as llvmpipe.
+	 * Otherwise, or if that fails, a hidden GLFW window is used. The context
+	 * is made current and GLEW is initialized.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class OffscreenContext {
+
+	public:
+
+		/**
+		 * @brief Creates the context.
+		 *
+		 * Creates an OpenGL 3.2 core context without a visible surface.
+		 */
+		OffscreenContext();
+
+		/**
+		 * @brief Whether the context is surfaceless.
+		 *
+		 * Whether the context was created with EGL and no surface at all.
+		 *
+		 * @returns True for a surfaceless EGL context, false for a hidden window.
+		 */
+		bool isSurfaceless();
+
+		/**
+		 * @brief Destroys the context.
+		 *
+		 * Destroys the context and whatever was created along with it.
+		 */
+		void remove();
+
+	private:
+
+		/**
+		 * @brief Creates a hidden GLFW window.
+		 *
+		 * Creates a hidden GLFW window and makes its context current.
+		 */
+		void createHiddenWindow();
+
+		/**
+		 * @brief Creates a surfaceless EGL context.
+		 *
+		 * Creates an EGL context on the surfaceless platform and makes it
+		 * current without any surface.
+		 *
+		 * @returns True if the context was created.
+		 */
+		bool createSurfaceless();
+
+		GLFWwindow *window = NULL;				/// The hidden window, if any.
+
+#ifdef BGQ_OPENGL_EGL
+		EGLDisplay display = EGL_NO_DISPLAY;	/// The EGL display, if any.
+		EGLContext context = EGL_NO_CONTEXT;	/// The EGL context, if any.
+#endif
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_OFFSCREEN_CONTEXT_H_
@@ -0,0 +1,419 @@
+/**
+ * @file png_writer.cpp
+ * @brief PNG writer class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ *
+ * @see PNG format: https://www.w3.org/TR/png/
+ * @see Deflate format: https://www.rfc-editor.org/rfc/rfc1951
+ */
+
+#include "png_writer.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace bgq_opengl {
+
+    namespace {
+
+        // Base and extra bits of the deflate length codes 257 to 285.
+        const int LENGTH_BASE[29] = {3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31, 35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258};
+        const int LENGTH_EXTRA[29] = {0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0};
+
+        // Base and extra bits of the deflate distance codes.
+        const int DISTANCE_BASE[30] = {1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193, 257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577};
+        const int DISTANCE_EXTRA[30] = {0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6, 7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13};
+
+        const int WINDOW_SIZE = 32768;  // Furthest a match can point back.
+        const int HASH_BITS = 15;       // Bits of the hash of three bytes.
+        const int MAX_CHAIN = 32;       // Candidates tried for every match.
+        const int MIN_MATCH = 3;        // Shortest match deflate can encode.
+        const int MAX_MATCH = 258;      // Longest match deflate can encode.
+
+        /**
+         * @brief Writes bits in deflate order.
+         *
+         * Packs bits starting from the least significant one of every byte.
+         */
+        struct BitStream {
+
+            std::vector<unsigned char>* out;    // Where the bytes go.
+            unsigned int buffer = 0;            // Bits not written yet.
+            int count = 0;                      // Number of bits in the buffer.
+
+            // Write the lowest n bits of a value.
+            void put(unsigned int bits, int n) {
+
+                this->buffer |= bits << this->count;
+                this->count += n;
+
+                while (this->count >= 8) {
+
+                    this->out->push_back((unsigned char) (this->buffer & 0xFF));
+                    this->buffer >>= 8;
+                    this->count -= 8;
+
+                }
+
+            }
+
+            // Write a Huffman code, which goes most significant bit first.
+            void putCode(unsigned int code, int n) {
+
+                unsigned int reversed = 0;
+                for (int i = 0; i < n; i++)
+                    reversed |= ((code >> i) & 1) << (n - 1 - i);
+
+                this->put(reversed, n);
+
+            }
+
+            // Write a literal byte or the end of block with the fixed codes.
+            void putLiteral(int literal) {
+
+                if (literal <= 143)
+                    this->putCode(0x30 + literal, 8);
+                else if (literal <= 255)
+                    this->putCode(0x190 + literal - 144, 9);
+                else if (literal <= 279)
+                    this->putCode(literal - 256, 7);
+                else
+                    this->putCode(0xC0 + literal - 280, 8);
+
+            }
+
+            // Write a match with the fixed codes.
+            void putMatch(int length, int distance) {
+
+                int l = 28;
+                while (LENGTH_BASE[l] > length) l--;
+
+                this->putLiteral(257 + l);
+                this->put(length - LENGTH_BASE[l], LENGTH_EXTRA[l]);
+
+                int d = 29;
+                while (DISTANCE_BASE[d] > distance) d--;
+
+                this->putCode(d, 5);
+                this->put(distance - DISTANCE_BASE[d], DISTANCE_EXTRA[d]);
+
+            }
+
+            // Write the bits left, padding the last byte.
+            void flush() {
+
+                if (this->count > 0)
+                    this->out->push_back((unsigned char) (this->buffer & 0xFF));
+
+                this->buffer = 0;
+                this->count = 0;
+
+            }
+
+        };
+
+        // Append a 32-bit big endian integer.
+        void appendUInt(unsigned int value, std::vector<unsigned char>* out) {
+
+            out->push_back((unsigned char) (value >> 24));
+            out->push_back((unsigned char) (value >> 16));
+            out->push_back((unsigned char) (value >> 8));
+            out->push_back((unsigned char) value);
+
+        }
+
+        // Predict a byte from its left, up and upper left neighbours.
+        int paeth(int a, int b, int c) {
+
+            int p = a + b - c;
+            int pa = abs(p - a);
+            int pb = abs(p - b);
+            int pc = abs(p - c);
+
+            if (pa <= pb && pa <= pc) return a;
+            if (pb <= pc) return b;
+            return c;
+
+        }
+
+    }  // namespace
+
+    void PNGWriter::encode(int width, int height, int channels, const unsigned char* pixels, bool flip, std::vector<unsigned char>* png) {
+
+        // The signature.
+        const unsigned char signature[8] = {137, 80, 78, 71, 13, 10, 26, 10};
+        png->assign(signature, signature + 8);
+
+        // The header with the size and the color model.
+        std::vector<unsigned char> header;
+        appendUInt((unsigned int) width, &header);
+        appendUInt((unsigned int) height, &header);
+        header.push_back(8);
+        header.push_back(channels == 4 ? 6 : (channels == 3 ? 2 : 0));
+        header.push_back(0);
+        header.push_back(0);
+        header.push_back(0);
+        PNGWriter::appendChunk("IHDR", header, png);
+
+        // Filter and compress the pixels.
+        std::vector<unsigned char> filtered;
+        PNGWriter::filter(width, height, channels, pixels, flip, &filtered);
+
+        std::vector<unsigned char> compressed;
+        PNGWriter::compress(filtered, &compressed);
+        PNGWriter::appendChunk("IDAT", compressed, png);
+
+        // The end of the file.
+        PNGWriter::appendChunk("IEND", std::vector<unsigned char>(), png);
+
+    }
+
+    bool PNGWriter::write(const std::string& filename, int width, int height, int channels, const unsigned char* pixels, bool flip) {
+
+        // Encode the image.
+        std::vector<unsigned char> png;
+        PNGWriter::encode(width, height, channels, pixels, flip, &png);
+
+        // Dump it to the file.
+        std::ofstream file(filename, std::ios::binary);
+        if (!file)
+            return false;
+
+        file.write((const char*) png.data(), (std::streamsize) png.size());
+
+        return (bool) file;
+
+    }
+
+    void PNGWriter::appendChunk(const char* type, const std::vector<unsigned char>& data, std::vector<unsigned char>* png) {
+
+        // Length of the data.
+        appendUInt((unsigned int) data.size(), png);
+
+        // Type and data, which are covered by the CRC.
+        size_t start = png->size();
+        png->insert(png->end(), type, type + 4);
+        png->insert(png->end(), data.begin(), data.end());
+
+        appendUInt(PNGWriter::crc32(png->data() + start, png->size() - start, 0), png);
+
+    }
+
+    void PNGWriter::compress(const std::vector<unsigned char>& data, std::vector<unsigned char>* out) {
+
+        out->clear();
+        out->reserve(data.size() / 2 + 64);
+
+        // The zlib header: deflate with a 32K window and no dictionary.
+        out->push_back(0x78);
+        out->push_back(0x01);
+
+        // A single final block with the fixed codes.
+        BitStream bits;
+        bits.out = out;
+        bits.put(1, 1);
+        bits.put(1, 2);
+
+        // Most recent position of every hash and the previous one with the same hash.
+        const int n = (int) data.size();
+        std::vector<int> head(1 << HASH_BITS, -1);
+        std::vector<int> previous(WINDOW_SIZE, -1);
+
+        auto hash = [&data](int p) {
+            unsigned int key = (data[p] << 16) | (data[p + 1] << 8) | data[p + 2];
+            return (key * 2654435761u) >> (32 - HASH_BITS);
+        };
+
+        auto insert = [&](int p) {
+            if (p + MIN_MATCH > n) return;
+            unsigned int h = hash(p);
+            previous[p & (WINDOW_SIZE - 1)] = head[h];
+            head[h] = p;
+        };
+
+        int i = 0;
+        while (i < n) {
+
+            // Look for the longest match among the last positions with the same hash.
+            int best_length = 0;
+            int best_distance = 0;
+
+            if (i + MIN_MATCH <= n) {
+
+                int max_length = std::min(MAX_MATCH, n - i);
+                int candidate = head[hash(i)];
+
+                for (int chain = 0; candidate >= 0 && chain < MAX_CHAIN; chain++) {
+
+                    int distance = i - candidate;
+                    if (distance > WINDOW_SIZE)
+                        break;
+
+                    int length = 0;
+                    while (length < max_length && data[candidate + length] == data[i + length])
+                        length++;
+
+                    if (length > best_length) {
+
+                        best_length = length;
+                        best_distance = distance;
+
+                        if (length == max_length)
+                            break;
+
+                    }
+
+                    candidate = previous[candidate & (WINDOW_SIZE - 1)];
+
+                }
+
+            }
+
+            // Write the match, or the byte if there is none worth it.
+            if (best_length >= MIN_MATCH) {
+
+                bits.putMatch(best_length, best_distance);
+
+                for (int j = 0; j < best_length; j++)
+                    insert(i + j);
+
+                i += best_length;
+
+            } else {
+
+                bits.putLiteral(data[i]);
+                insert(i);
+                i++;
+
+            }
+
+        }
+
+        // End of block.
+        bits.putLiteral(256);
+        bits.flush();
+
+        // The Adler-32 of the uncompressed data.
+        unsigned int a = 1, b = 0;
+        size_t done = 0;
+
+        while (done < data.size()) {
+
+            // This many bytes can be added before the sums overflow.
+            size_t block = std::min<size_t>(5552, data.size() - done);
+
+            for (size_t j = 0; j < block; j++) {
+
+                a += data[done + j];
+                b += a;
+
+            }
+
+            a %= 65521;
+            b %= 65521;
+            done += block;
+
+        }
+
+        appendUInt((b << 16) | a, out);
+
+    }
+
+    unsigned int PNGWriter::crc32(const unsigned char* data, size_t length, unsigned int crc) {
+
+        // Build the table the first time.
+        static const std::vector<unsigned int> table = [] {
+
+            std::vector<unsigned int> t(256);
+
+            for (unsigned int i = 0; i < 256; i++) {
+
+                unsigned int c = i;
+                for (int k = 0; k < 8; k++)
+                    c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+
+                t[i] = c;
+
+            }
+
+            return t;
+
+        }();
+
+        crc = ~crc;
+        for (size_t i = 0; i < length; i++)
+            crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+
+        return ~crc;
+
+    }
+
+    void PNGWriter::filter(int width, int height, int channels, const unsigned char* pixels, bool flip, std::vector<unsigned char>* filtered) {
+
+        const size_t stride = (size_t) width * channels;
+
+        filtered->resize((stride + 1) * height);
+
+        // The first row has nothing above.
+        std::vector<unsigned char> zeros(stride, 0);
+        std::vector<unsigned char> candidate(stride);
+
+        for (int y = 0; y < height; y++) {
+
+            // Get the row and the one above it in the output order.
+            const unsigned char* row = pixels + stride * (flip ? height - 1 - y : y);
+            const unsigned char* up = y == 0 ? zeros.data() : pixels + stride * (flip ? height - y : y - 1);
+
+            unsigned char* out = filtered->data() + (stride + 1) * y;
+
+            // Try every filter and keep the one with the smallest sum.
+            long best_sum = -1;
+
+            for (int type = 0; type < 5; type++) {
+
+                long sum = 0;
+
+                for (size_t x = 0; x < stride; x++) {
+
+                    int left = x >= (size_t) channels ? row[x - channels] : 0;
+                    int upper_left = x >= (size_t) channels ? up[x - channels] : 0;
+                    int predicted = 0;
+
+                    if (type == 1) predicted = left;
+                    else if (type == 2) predicted = up[x];
+                    else if (type == 3) predicted = (left + up[x]) / 2;
+                    else if (type == 4) predicted = paeth(left, up[x], upper_left);
+
+                    candidate[x] = (unsigned char) (row[x] - predicted);
+                    sum += abs((signed char) candidate[x]);
+
+                }
+
+                if (best_sum < 0 || sum < best_sum) {
+
+                    best_sum = sum;
+                    out[0] = (unsigned char) type;
+                    std::copy(candidate.begin(), candidate.end(), out + 1);
+
+                }
+
+            }
+
+        }
+
+    }
+
+}  // namespace bgq_opengl
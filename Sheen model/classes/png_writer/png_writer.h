@@ -0,0 +1,124 @@
+/**
+ * @file png_writer.h
+ * @brief PNG writer class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_PNG_WRITER_H_
+#define BGQ_OPENGL_CLASSES_PNG_WRITER_H_
+
+#include <string>
+#include <vector>
+
+namespace bgq_opengl {
+
+    /**
+     * @brief Implements a PNG encoder.
+     *
+     * Implements a small PNG encoder for 8-bit gray, RGB and RGBA images. Rows
+     * are filtered with the PNG filter that suits each of them best and the
+     * result is compressed with a single fixed-Huffman deflate block. It keeps
+     * no state, so several threads can encode at the same time.
+     *
+     * @author Borja García Quiroga <garcaqub@tcd.ie>
+     */
+    class PNGWriter {
+
+    public:
+
+        /**
+         * @brief Encode an image as PNG.
+         *
+         * Encode an image as a PNG file in memory.
+         *
+         * @param width Width of the image in pixels.
+         * @param height Height of the image in pixels.
+         * @param channels Channels per pixel: 1, 3 or 4.
+         * @param pixels The pixels, row after row without padding.
+         * @param flip Whether the rows are stored bottom to top, as OpenGL reads them.
+         * @param png Output vector with the contents of the file.
+         */
+        static void encode(int width, int height, int channels, const unsigned char* pixels, bool flip, std::vector<unsigned char>* png);
+
+        /**
+         * @brief Write an image to a PNG file.
+         *
+         * Encode an image as PNG and write it to a file.
+         *
+         * @param filename Name of the file.
+         * @param width Width of the image in pixels.
+         * @param height Height of the image in pixels.
+         * @param channels Channels per pixel: 1, 3 or 4.
+         * @param pixels The pixels, row after row without padding.
+         * @param flip Whether the rows are stored bottom to top, as OpenGL reads them.
+         *
+         * @returns True if the file was written.
+         */
+        static bool write(const std::string& filename, int width, int height, int channels, const unsigned char* pixels, bool flip);
+
+    private:
+
+        /**
+         * @brief Append a chunk to the file.
+         *
+         * Append a chunk with its length and CRC to the file.
+         *
+         * @param type The four letters of the chunk type.
+         * @param data The data of the chunk.
+         * @param png The file the chunk is appended to.
+         */
+        static void appendChunk(const char* type, const std::vector<unsigned char>& data, std::vector<unsigned char>* png);
+
+        /**
+         * @brief Compress data in the zlib format.
+         *
+         * Compress data with LZ77 and the fixed Huffman codes of deflate and
+         * wrap it in a zlib stream.
+         *
+         * @param data The data to compress.
+         * @param out Output vector with the zlib stream.
+         */
+        static void compress(const std::vector<unsigned char>& data, std::vector<unsigned char>* out);
+
+        /**
+         * @brief Compute the CRC of a chunk.
+         *
+         * Compute the CRC-32 used by the PNG chunks.
+         *
+         * @param data The bytes to check.
+         * @param length Number of bytes.
+         * @param crc The CRC of the previous bytes, 0 for the first ones.
+         *
+         * @returns The CRC.
+         */
+        static unsigned int crc32(const unsigned char* data, size_t length, unsigned int crc);
+
+        /**
+         * @brief Filter the rows of the image.
+         *
+         * Filter every row of the image with the filter that leaves the
+         * smallest sum of absolute values, prefixing it with the filter type.
+         *
+         * @param width Width of the image in pixels.
+         * @param height Height of the image in pixels.
+         * @param channels Channels per pixel.
+         * @param pixels The pixels.
+         * @param flip Whether the rows are stored bottom to top.
+         * @param filtered Output vector with the filtered rows.
+         */
+        static void filter(int width, int height, int channels, const unsigned char* pixels, bool flip, std::vector<unsigned char>* filtered);
+
+    };
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_PNG_WRITER_H_
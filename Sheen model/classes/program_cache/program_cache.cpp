@@ -0,0 +1,232 @@
+/**
+ * @file program_cache.cpp
+ * @brief Program cache class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "program_cache.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <chrono>
+#include <cstdio>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+
+#include "classes/hash/hash.h"
+#include "classes/mapped_file/mapped_file.h"
+#include "structs/program_cache_header/program_cache_header.h"
+
+namespace bgq_opengl {
+
+	namespace {
+
+		bool enabled = true;				// Whether the cache is used at all.
+		int binary_formats = -1;			// Binary formats of the driver, -1 until asked.
+		ProgramCache::Stats stats;			// Programs built so far.
+
+		/**
+		 * Hashes some strings, each one ended by its terminator so they cannot run into each other.
+		 */
+		uint64_t hashStrings(const std::vector<std::string>& strings) {
+
+			std::string joined = "";
+
+			for (size_t i = 0; i < strings.size(); i++)
+				joined.append(strings[i].c_str(), strings[i].size() + 1);
+
+			return Hash::fnv1a((const unsigned char*) joined.data(), joined.size());
+
+		}
+
+		/**
+		 * Gets a string of the driver, empty if there is none.
+		 */
+		std::string getDriverString(GLenum name) {
+
+			const GLubyte* value = glGetString(name);
+
+			return value == NULL ? "" : std::string((const char*) value);
+
+		}
+
+	}  // namespace
+
+	ProgramCache::ProgramCache(const char* vertex_filename, const char* fragment_filename, const std::vector<std::string>& defines, const std::string& vertex_source, const std::string& fragment_source) {
+
+		// Every permutation of a pair of shaders has a file of its own, and a new version of them replaces it.
+		std::vector<std::string> name = {vertex_filename, fragment_filename};
+		name.insert(name.end(), defines.begin(), defines.end());
+
+		char key[17];
+		snprintf(key, sizeof(key), "%016llx", (unsigned long long) hashStrings(name));
+
+		this->cache_filename = std::string(fragment_filename) + "." + key + PROGRAM_CACHE_EXTENSION;
+
+		// A binary is only good for the sources and the driver it came from.
+		this->source_hash = hashStrings({vertex_source, fragment_source});
+		this->driver_hash = hashStrings({getDriverString(GL_VENDOR), getDriverString(GL_RENDERER), getDriverString(GL_VERSION)});
+
+	}
+
+	bool ProgramCache::isEnabled() {
+
+		if (!enabled)
+			return false;
+
+		// Some drivers have the extension but no format to give.
+		if (binary_formats < 0) {
+
+			binary_formats = 0;
+
+			if (GLEW_ARB_get_program_binary)
+				glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &binary_formats);
+
+		}
+
+		return binary_formats > 0;
+
+	}
+
+	void ProgramCache::setEnabled(bool enabled_cache) {
+
+		enabled = enabled_cache;
+
+	}
+
+	ProgramCache::Stats ProgramCache::getStats() {
+
+		return stats;
+
+	}
+
+	void ProgramCache::countCompiled(double ms) {
+
+		stats.compiled++;
+		stats.compile_ms += ms;
+
+	}
+
+	bool ProgramCache::load(GLuint program) {
+
+		if (!ProgramCache::isEnabled())
+			return false;
+
+		std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+		bool loaded = false;
+		MappedFile file(this->cache_filename.c_str());
+
+		if (file.isOpen() && file.getSize() >= sizeof(ProgramCacheHeader)) {
+
+			const unsigned char* data = file.getData();
+			size_t size = file.getSize();
+
+			ProgramCacheHeader header;
+			memcpy(&header, data, sizeof(header));
+
+			// It has to be from these same sources and driver, and all there.
+			bool valid = memcmp(header.magic, PROGRAM_CACHE_MAGIC, 4) == 0 && header.version == PROGRAM_CACHE_VERSION;
+			valid = valid && header.source_hash == this->source_hash && header.driver_hash == this->driver_hash;
+			valid = valid && header.file_size == size && sizeof(header) + (uint64_t) header.binary_size == size;
+			valid = valid && Hash::fnv1a(data + sizeof(header), header.binary_size) == header.binary_hash;
+
+			if (valid) {
+
+				// The driver may still refuse it, after an update that kept its version string.
+				glProgramBinary(program, (GLenum) header.binary_format, data + sizeof(header), (GLsizei) header.binary_size);
+
+				GLint status = GL_FALSE;
+				glGetProgramiv(program, GL_LINK_STATUS, &status);
+				loaded = status == GL_TRUE;
+
+				if (!loaded)
+					stats.rejected++;
+
+			}
+
+		}
+
+		file.remove();
+
+		if (loaded)
+			stats.loaded++;
+
+		stats.load_ms += std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+		return loaded;
+
+	}
+
+	bool ProgramCache::write(GLuint program) const {
+
+		if (!ProgramCache::isEnabled())
+			return false;
+
+		// Get the binary of the program.
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+
+		if (length <= 0)
+			return false;
+
+		std::vector<unsigned char> binary((size_t) length);
+		GLsizei binary_size = 0;
+		GLenum binary_format = 0;
+		glGetProgramBinary(program, length, &binary_size, &binary_format, binary.data());
+
+		if (binary_size <= 0)
+			return false;
+
+		ProgramCacheHeader header;
+		memcpy(header.magic, PROGRAM_CACHE_MAGIC, 4);
+		header.version = PROGRAM_CACHE_VERSION;
+		header.source_hash = this->source_hash;
+		header.driver_hash = this->driver_hash;
+		header.binary_format = (uint32_t) binary_format;
+		header.binary_size = (uint32_t) binary_size;
+		header.binary_hash = Hash::fnv1a(binary.data(), (size_t) binary_size);
+		header.file_size = sizeof(header) + (uint64_t) binary_size;
+
+		// Write a temporary file and move it over the old cache, so a run that stops halfway never leaves half a cache.
+		std::string temporary = this->cache_filename + ".tmp";
+		FILE* out = fopen(temporary.c_str(), "wb");
+
+		if (out == NULL) {
+
+			std::cerr << "Program cache error: could not open " << temporary << ", the program will be compiled again next time." << std::endl;
+			return false;
+
+		}
+
+		bool ok = fwrite(&header, sizeof(header), 1, out) == 1;
+		ok = ok && fwrite(binary.data(), 1, (size_t) binary_size, out) == (size_t) binary_size;
+		ok = fclose(out) == 0 && ok;
+		ok = ok && rename(temporary.c_str(), this->cache_filename.c_str()) == 0;
+
+		if (!ok) {
+
+			std::cerr << "Program cache error: could not write " << this->cache_filename << ", the program will be compiled again next time." << std::endl;
+			std::remove(temporary.c_str());
+
+		}
+
+		return ok;
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,145 @@
+/**
+ * @file program_cache.h
+ * @brief Program cache class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_PROGRAM_CACHE_H_
+#define BGQ_OPENGL_CLASS_PROGRAM_CACHE_H_
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "GL/glew.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a program binary cache.
+	 *
+	 * Implementation of a cache of the binary of a linked program, written
+	 * next to the fragment shader with a hash of the shader filenames and
+	 * the defines of the permutation, and PROGRAM_CACHE_EXTENSION, appended.
+	 * It is keyed by the hash of the sources and of the driver vendor,
+	 * renderer and version, so that a binary is only loaded into the driver
+	 * that made it. A binary the driver rejects is compiled from the sources
+	 * again and replaced.
+	 *
+	 * The cache needs a driver that gives at least one binary format, and it
+	 * can be turned off.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class ProgramCache {
+
+	public:
+
+		/**
+		 * @brief Counters of the programs built.
+		 *
+		 * Counters of the programs loaded from the cache and compiled from
+		 * their sources, and the time each took.
+		 */
+		struct Stats {
+
+			unsigned int loaded = 0;		/// Programs loaded from their binary.
+			unsigned int compiled = 0;		/// Programs compiled from their sources.
+			unsigned int rejected = 0;		/// Binaries the driver did not take, compiled again.
+			double load_ms = 0.0;			/// Time loading them, failed loads included.
+			double compile_ms = 0.0;		/// Time compiling and linking them.
+
+		};
+
+		/**
+		 * @brief Opens the cache of a program.
+		 *
+		 * Hashes the sources and the driver. It needs a GL context.
+		 *
+		 * @param vertex_filename Vertex shader filename.
+		 * @param fragment_filename Fragment shader filename.
+		 * @param defines Defines of the permutation.
+		 * @param vertex_source Vertex shader source, as compiled.
+		 * @param fragment_source Fragment shader source, as compiled.
+		 */
+		ProgramCache(const char* vertex_filename, const char* fragment_filename, const std::vector<std::string>& defines, const std::string& vertex_source, const std::string& fragment_source);
+
+		/**
+		 * @brief Whether the cache is used.
+		 *
+		 * Whether it is enabled and the driver can give binaries.
+		 *
+		 * @returns True if it is used.
+		 */
+		static bool isEnabled();
+
+		/**
+		 * @brief Turns the cache on or off.
+		 *
+		 * Turns the cache on or off. Off, every program is compiled from
+		 * its sources and nothing is written.
+		 *
+		 * @param enabled Whether to use the cache.
+		 */
+		static void setEnabled(bool enabled);
+
+		/**
+		 * @brief Get the counters.
+		 *
+		 * @returns The counters of every program built so far.
+		 */
+		static Stats getStats();
+
+		/**
+		 * @brief Counts a program compiled from its sources.
+		 *
+		 * @param ms Time compiling and linking it.
+		 */
+		static void countCompiled(double ms);
+
+		/**
+		 * @brief Loads the program.
+		 *
+		 * Loads the cached binary into a program, if there is one for these
+		 * sources and this driver and the driver takes it.
+		 *
+		 * @param program The program, not linked yet.
+		 *
+		 * @returns True if the program is linked from the binary.
+		 */
+		bool load(GLuint program);
+
+		/**
+		 * @brief Writes the cache.
+		 *
+		 * Writes the binary of a program, replacing any stale one. Failing
+		 * to write it is not an error, the program is just compiled again
+		 * next time.
+		 *
+		 * @param program The program, linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT.
+		 *
+		 * @returns True if it was written.
+		 */
+		bool write(GLuint program) const;
+
+	private:
+
+		std::string cache_filename;		/// The cache file.
+		uint64_t source_hash = 0;		/// Hash of both sources.
+		uint64_t driver_hash = 0;		/// Hash of the driver strings.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_PROGRAM_CACHE_H_
@@ -0,0 +1,293 @@
+/**
+ * @file scene_graph.cpp
+ * @brief Scene graph class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "scene_graph.h"
+
+#include <assert.h>
+
+#include <algorithm>
+#include <vector>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/type_ptr.hpp"
+
+#include "classes/ltc_reference/ltc_lanes.h"
+
+namespace bgq_opengl {
+
+    namespace {
+
+        using namespace lanes;
+
+        // The widest lane type the compiler targets.
+#if defined(BGQ_OPENGL_LANES_AVX2)
+        typedef Float8 Wide;
+        const char* WIDE_NAME = "AVX2";
+#elif defined(BGQ_OPENGL_LANES_SSE2)
+        typedef Float4 Wide;
+        const char* WIDE_NAME = "SSE2";
+#else
+        typedef Float1 Wide;
+        const char* WIDE_NAME = "scalar";
+#endif
+
+        /**
+         * Moves element arrays of one stride to another.
+         */
+        void restride(std::vector<float>* elements, int count, size_t old_stride, size_t new_stride) {
+
+            std::vector<float> moved(count * new_stride, 0.0f);
+
+            for (int e = 0; e < count; e++)
+                std::copy(elements->begin() + e * old_stride, elements->begin() + (e + 1) * old_stride, moved.begin() + e * new_stride);
+
+            elements->swap(moved);
+
+        }
+
+    }  // namespace
+
+    int SceneGraph::addNode(int parent) {
+
+        // Parents come first, so that one pass in order sees them before their children.
+        assert(parent < (int) this->parents.size());
+
+        int node = (int) this->parents.size();
+
+        this->parents.push_back(parent);
+        this->locals.push_back(glm::mat4(1.0f));
+        this->applied.push_back(glm::mat4(1.0f));
+        this->touched.push_back(0);
+        this->world_dirty.push_back(1);
+        this->view_dirty.push_back(1);
+
+        if (this->parents.size() > this->stride)
+            this->grow(std::max(this->stride * 2, (size_t) Wide::WIDTH));
+
+        return node;
+
+    }
+
+    const char* SceneGraph::getInstructionSet() {
+
+        return WIDE_NAME;
+
+    }
+
+    glm::mat4 SceneGraph::getLocal(int node) {
+
+        return this->locals[node];
+
+    }
+
+    glm::mat4 SceneGraph::getModelView(int node) {
+
+        glm::mat4 model_view;
+
+        for (int c = 0; c < 4; c++)
+            for (int r = 0; r < 4; r++)
+                model_view[c][r] = this->model_views[(c * 4 + r) * this->stride + node];
+
+        return model_view;
+
+    }
+
+    glm::mat4 SceneGraph::getNormalMatrix(int node) {
+
+        glm::mat4 normal_matrix(1.0f);
+
+        for (int c = 0; c < 3; c++)
+            for (int r = 0; r < 3; r++)
+                normal_matrix[c][r] = this->normals[(c * 3 + r) * this->stride + node];
+
+        return normal_matrix;
+
+    }
+
+    int SceneGraph::getParent(int node) {
+
+        return this->parents[node];
+
+    }
+
+    size_t SceneGraph::getSize() {
+
+        return this->parents.size();
+
+    }
+
+    glm::mat4 SceneGraph::getWorld(int node) {
+
+        glm::mat4 world;
+
+        for (int c = 0; c < 4; c++)
+            for (int r = 0; r < 4; r++)
+                world[c][r] = this->worlds[(c * 4 + r) * this->stride + node];
+
+        return world;
+
+    }
+
+    void SceneGraph::grow(size_t stride) {
+
+        restride(&this->worlds, 16, this->stride, stride);
+        restride(&this->model_views, 16, this->stride, stride);
+        restride(&this->normals, 9, this->stride, stride);
+
+        this->stride = stride;
+
+    }
+
+    void SceneGraph::setLocal(int node, const glm::mat4& local) {
+
+        // Only compared at the next update, so that rebuilding it op by op costs nothing if it ends up the same.
+        this->locals[node] = local;
+        this->touched[node] = 1;
+
+    }
+
+    size_t SceneGraph::updateViews(const glm::mat4& view) {
+
+        // A new view changes every model-view matrix.
+        bool view_changed = !this->has_view || view != this->view;
+
+        this->view = view;
+        this->has_view = true;
+
+        size_t count = 0;
+        size_t size = this->parents.size();
+
+        // Whole lanes are computed if any node in them changed, the rest come out the same.
+        for (size_t first = 0; first < size; first += Wide::WIDTH) {
+
+            size_t last = std::min(first + Wide::WIDTH, size);
+            bool dirty = view_changed;
+
+            for (size_t i = first; i < last && !dirty; i++)
+                dirty = this->view_dirty[i] != 0;
+
+            if (!dirty)
+                continue;
+
+            this->updateViewLanes<Wide>(glm::value_ptr(this->view), first);
+
+            for (size_t i = first; i < last; i++) {
+
+                if (view_changed || this->view_dirty[i])
+                    count++;
+
+                this->view_dirty[i] = 0;
+
+            }
+
+        }
+
+        return count;
+
+    }
+
+    template <class F>
+    void SceneGraph::updateViewLanes(const float* view, size_t first) {
+
+        const size_t s = this->stride;
+        F m[16];
+
+        // Each column of the model-view is the view times that column of the world.
+        for (int c = 0; c < 4; c++) {
+
+            F w0 = load(&this->worlds[(c * 4 + 0) * s + first], F());
+            F w1 = load(&this->worlds[(c * 4 + 1) * s + first], F());
+            F w2 = load(&this->worlds[(c * 4 + 2) * s + first], F());
+            F w3 = load(&this->worlds[(c * 4 + 3) * s + first], F());
+
+            for (int r = 0; r < 4; r++) {
+
+                m[c * 4 + r] = F(view[r]) * w0 + F(view[4 + r]) * w1 + F(view[8 + r]) * w2 + F(view[12 + r]) * w3;
+                store(&this->model_views[(c * 4 + r) * s + first], m[c * 4 + r]);
+
+            }
+
+        }
+
+        // The inverse transpose of the upper 3x3 has the cross products of its columns as columns.
+        F n[9];
+
+        n[0] = m[5] * m[10] - m[6] * m[9];
+        n[1] = m[6] * m[8] - m[4] * m[10];
+        n[2] = m[4] * m[9] - m[5] * m[8];
+        n[3] = m[9] * m[2] - m[10] * m[1];
+        n[4] = m[10] * m[0] - m[8] * m[2];
+        n[5] = m[8] * m[1] - m[9] * m[0];
+        n[6] = m[1] * m[6] - m[2] * m[5];
+        n[7] = m[2] * m[4] - m[0] * m[6];
+        n[8] = m[0] * m[5] - m[1] * m[4];
+
+        // Singular matrices, such as a zero scale or the padding, get a zero normal matrix.
+        F det = m[0] * n[0] + m[1] * n[1] + m[2] * n[2];
+        F inv_det = select(abs(det) > F(0.0f), F(1.0f) / det, F(0.0f));
+
+        for (int e = 0; e < 9; e++)
+            store(&this->normals[e * s + first], n[e] * inv_det);
+
+    }
+
+    size_t SceneGraph::updateWorlds(std::vector<int>* changed) {
+
+        if (changed != nullptr)
+            changed->clear();
+
+        size_t count = 0;
+        size_t size = this->parents.size();
+
+        for (size_t i = 0; i < size; i++) {
+
+            // Only the local transforms that really changed count.
+            if (this->touched[i] && this->locals[i] != this->applied[i])
+                this->world_dirty[i] = 1;
+
+            this->touched[i] = 0;
+
+            // The parent was already seen, so its flag says if it was computed again.
+            int parent = this->parents[i];
+
+            if (parent >= 0 && this->world_dirty[parent])
+                this->world_dirty[i] = 1;
+
+            if (!this->world_dirty[i])
+                continue;
+
+            glm::mat4 world = parent >= 0 ? this->getWorld(parent) * this->locals[i] : this->locals[i];
+
+            for (int c = 0; c < 4; c++)
+                for (int r = 0; r < 4; r++)
+                    this->worlds[(c * 4 + r) * this->stride + i] = world[c][r];
+
+            this->applied[i] = this->locals[i];
+            this->view_dirty[i] = 1;
+            count++;
+
+            if (changed != nullptr)
+                changed->push_back((int) i);
+
+        }
+
+        // The flags are kept until the end so that the children can see them.
+        std::fill(this->world_dirty.begin(), this->world_dirty.end(), 0);
+
+        return count;
+
+    }
+
+}  // namespace bgq_opengl
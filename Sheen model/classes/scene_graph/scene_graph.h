@@ -0,0 +1,209 @@
+/**
+ * @file scene_graph.h
+ * @brief Scene graph class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_SCENE_GRAPH_H_
+#define BGQ_OPENGL_CLASSES_SCENE_GRAPH_H_
+
+#include <stddef.h>
+
+#include <vector>
+
+#include "glm/glm.hpp"
+
+namespace bgq_opengl {
+
+    /**
+     * @brief Implements a hierarchy of transforms.
+     *
+     * Implements a tree of nodes, each with a local transform relative to its
+     * parent. The world, model-view and normal matrices of a node are only
+     * computed again when its local transform, one of its parents or the view
+     * changed. Parents are always added before their children, so a single
+     * pass in order updates the whole tree.
+     *
+     * The world, model-view and normal matrices are kept as one array per
+     * matrix element, so the model-views and normal matrices are computed for
+     * eight nodes at a time with AVX2 and four with SSE2, with the same lane
+     * types as LTCReference.
+     *
+     * @author Borja García Quiroga <garcaqub@tcd.ie>
+     */
+    class SceneGraph {
+
+        public:
+
+            /**
+             * @brief Adds a node.
+             *
+             * Adds a node with an identity local transform.
+             *
+             * @param parent The parent node, which must already exist, or -1 for a root.
+             *
+             * @returns The index of the new node.
+             */
+            int addNode(int parent = -1);
+
+            /**
+             * @brief Get the instruction set of the SIMD path.
+             *
+             * Get the name of the instruction set the matrices are computed with.
+             *
+             * @returns "AVX2", "SSE2" or "scalar".
+             */
+            static const char* getInstructionSet();
+
+            /**
+             * @brief Get the local transform of a node.
+             *
+             * Get the local transform of a node, relative to its parent.
+             *
+             * @param node The node.
+             *
+             * @returns The local transform.
+             */
+            glm::mat4 getLocal(int node);
+
+            /**
+             * @brief Get the model-view matrix of a node.
+             *
+             * Get the view times the world matrix of a node, as of the last
+             * updateViews.
+             *
+             * @param node The node.
+             *
+             * @returns The model-view matrix.
+             */
+            glm::mat4 getModelView(int node);
+
+            /**
+             * @brief Get the normal matrix of a node.
+             *
+             * Get the inverse transpose of the model-view matrix of a node, as of
+             * the last updateViews. Only its upper 3x3 is filled in, which is all
+             * the shaders read of it.
+             *
+             * @param node The node.
+             *
+             * @returns The normal matrix.
+             */
+            glm::mat4 getNormalMatrix(int node);
+
+            /**
+             * @brief Get the parent of a node.
+             *
+             * Get the parent of a node.
+             *
+             * @param node The node.
+             *
+             * @returns The parent, or -1 if it is a root.
+             */
+            int getParent(int node);
+
+            /**
+             * @brief Get the number of nodes.
+             *
+             * Get the number of nodes.
+             *
+             * @returns The number of nodes.
+             */
+            size_t getSize();
+
+            /**
+             * @brief Get the world matrix of a node.
+             *
+             * Get the world matrix of a node, as of the last updateWorlds.
+             *
+             * @param node The node.
+             *
+             * @returns The world matrix.
+             */
+            glm::mat4 getWorld(int node);
+
+            /**
+             * @brief Set the local transform of a node.
+             *
+             * Set the local transform of a node. Nothing is computed until the
+             * next update, and nothing at all if it ends up as it was.
+             *
+             * @param node The node.
+             * @param local The local transform.
+             */
+            void setLocal(int node, const glm::mat4& local);
+
+            /**
+             * @brief Updates the model-view and normal matrices.
+             *
+             * Computes the model-view and normal matrices of the nodes whose
+             * world matrix changed since the last call, or of all of them if the
+             * view did.
+             *
+             * @param view The view matrix.
+             *
+             * @returns The number of nodes computed.
+             */
+            size_t updateViews(const glm::mat4& view);
+
+            /**
+             * @brief Updates the world matrices.
+             *
+             * Computes the world matrices of the nodes whose local transform or
+             * a parent changed since the last call.
+             *
+             * @param changed If not null, outputs the nodes computed, in order.
+             *
+             * @returns The number of nodes computed.
+             */
+            size_t updateWorlds(std::vector<int>* changed = nullptr);
+
+        private:
+
+            /**
+             * @brief Makes room for more nodes.
+             *
+             * Makes the element arrays longer, moving what they held.
+             *
+             * @param stride The new length of every element array, a multiple of the widest lane.
+             */
+            void grow(size_t stride);
+
+            /**
+             * @brief Computes the model-view and normal matrices of some nodes.
+             *
+             * Computes the model-view and normal matrices of a lane of F nodes.
+             *
+             * @param view The view matrix, column by column.
+             * @param first The first node.
+             */
+            template <class F>
+            void updateViewLanes(const float* view, size_t first);
+
+            std::vector<int> parents;               /// Parent of every node, -1 for roots.
+            std::vector<glm::mat4> locals;          /// Local transform of every node.
+            std::vector<glm::mat4> applied;         /// Local transform every world matrix was computed with.
+            std::vector<unsigned char> touched;     /// Whether the local transform was set since the last updateWorlds.
+            std::vector<unsigned char> world_dirty; /// Whether the world matrix has to be computed again.
+            std::vector<unsigned char> view_dirty;  /// Whether the world matrix changed since the last updateViews.
+            std::vector<float> worlds;              /// World matrices, 16 arrays of stride floats.
+            std::vector<float> model_views;         /// Model-view matrices, 16 arrays of stride floats.
+            std::vector<float> normals;             /// Normal matrices, 9 arrays of stride floats.
+            size_t stride = 0;                      /// Length of every element array, padded to the widest lane.
+            glm::mat4 view = glm::mat4(1.0f);       /// View of the last updateViews.
+            bool has_view = false;                  /// Whether updateViews was ever called.
+
+    };
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_SCENE_GRAPH_H_
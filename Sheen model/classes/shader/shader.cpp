@@ -15,23 +15,61 @@
 
 #include "shader.h"
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <exception>
+#include <vector>
 
 #include "GL/glew.h"
 #include "glm/glm.hpp"
 #include "glm/gtc/type_ptr.hpp"
 
 #include "classes/camera/camera.h"
+#include "classes/cpu_profiler/cpu_profiler.h"
+#include "classes/gl_state/gl_state.h"
 #include "classes/light/light.h"
 #include "classes/texture/texture.h"
 #include "classes/ltc_matrix/ltc_matrix.h"
+#include "classes/program_cache/program_cache.h"
 
 namespace bgq_opengl {
 
+    namespace {
+
+        /**
+         * Whether a uniform type is a sampler, which is bound to a slot once instead of set on every pass.
+         */
+        bool isSampler(GLenum type) {
+
+            switch (type) {
+
+                case GL_SAMPLER_1D:
+                case GL_SAMPLER_2D:
+                case GL_SAMPLER_3D:
+                case GL_SAMPLER_CUBE:
+                case GL_SAMPLER_1D_SHADOW:
+                case GL_SAMPLER_2D_SHADOW:
+                case GL_SAMPLER_1D_ARRAY:
+                case GL_SAMPLER_2D_ARRAY:
+                case GL_SAMPLER_2D_RECT:
+                case GL_SAMPLER_BUFFER:
+                case GL_INT_SAMPLER_2D:
+                case GL_UNSIGNED_INT_SAMPLER_2D:
+                    return true;
+
+                default:
+                    return false;
+
+            }
+
+        }
+
+    }  // namespace
+
     Shader::Shader() {
     
         this->programID = NULL;
@@ -40,7 +78,13 @@ namespace bgq_opengl {
     
     }
     
-    Shader::Shader(const char* vertex_filename, const char* fragment_filename) {
+    Shader::Shader(const char* vertex_filename, const char* fragment_filename) : Shader(vertex_filename, fragment_filename, std::vector<std::string>()) {
+
+    }
+
+    Shader::Shader(const char* vertex_filename, const char* fragment_filename, const std::vector<std::string>& defines) {
+
+        PROFILE_ZONE("Shader::compile");
 
         this->light = new Light(glm::vec3(0.0f, 0.0f, 0.0f), glm::vec4(0.0f, 0.0f, 0.0f, 0.0f));
 
@@ -70,6 +114,27 @@ namespace bgq_opengl {
 
         }
 
+        // Select the features of this permutation.
+        if (!defines.empty()) {
+
+            Shader::injectDefines(defines, &vertex_source_code);
+            Shader::injectDefines(defines, &fragment_source_code);
+
+        }
+
+        // Use the binary of a previous run, if there is one and the driver takes it.
+        ProgramCache cache(vertex_filename, fragment_filename, defines, vertex_source_code, fragment_source_code);
+        this->programID = glCreateProgram();
+
+        if (cache.load(this->programID)) {
+
+            this->cacheUniformLocations();
+            return;
+
+        }
+
+        std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
         // Convert it to char.
         const char* vertex_code_char = vertex_source_code.c_str();
         const char* fragment_code_char = fragment_source_code.c_str();
@@ -102,11 +167,13 @@ namespace bgq_opengl {
 
         }
 
-        // Create the program and add the vertex and fragment shaders.
-        this->programID = glCreateProgram();
+        // Add the vertex and fragment shaders to the program, asking to keep its binary for the cache.
         glAttachShader(this->programID, vertex);
         glAttachShader(this->programID, fragment);
 
+        if (ProgramCache::isEnabled())
+            glProgramParameteri(this->programID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+
         // Link this program and check for program errors.
         glLinkProgram(this->programID);
         error_msg = "";
@@ -122,6 +189,14 @@ namespace bgq_opengl {
         glDeleteShader(vertex);
         glDeleteShader(fragment);
 
+        ProgramCache::countCompiled(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+
+        // Keep the binary for the next run.
+        cache.write(this->programID);
+
+        // Store where every uniform lives so the passes do not need to ask the driver.
+        this->cacheUniformLocations();
+
         /*
         // Validate the program.
         glValidateProgram(this->programID);
@@ -147,29 +222,76 @@ namespace bgq_opengl {
         if (this->programID == -1)
             throw std::runtime_error("Shader was not initialized.");
 
-        glUseProgram(this->programID);
+        GLState::useProgram(this->programID);
+
+    }
+
+    const Shader::Builtins& Shader::getBuiltins() {
+
+        return this->builtins;
+
+    }
+
+    unsigned int Shader::getUniformLookups() {
+
+        return this->uniform_lookups;
+
+    }
+
+    void Shader::resetUniformLookups() {
+
+        this->uniform_lookups = 0;
+
+    }
+
+    void Shader::bindSampler(const std::string& name, GLuint slot) {
+
+        // Nothing to do if the sampler already points there.
+        auto it = this->sampler_slots.find(name);
+        if (it != this->sampler_slots.end() && it->second == slot)
+            return;
+
+        this->sampler_slots[name] = slot;
+
+        // Samplers were resolved after linking, so binding them is not a lookup by name. Inactive ones have nothing to set.
+        auto location = this->sampler_locations.find(name);
+        if (location == this->sampler_locations.end())
+            return;
+
+        // Set the sampler once, it keeps its value while the program lives.
+        this->activate();
+        glUniform1i(location->second, (int) slot);
+
+    }
+
+    void Shader::bindUniformBlock(const std::string& name, GLuint binding) {
+
+        // Get the index of the block.
+        GLuint index = glGetUniformBlockIndex(this->programID, name.c_str());
+
+        // The block is not used by the program.
+        if (index == GL_INVALID_INDEX)
+            return;
+
+        glUniformBlockBinding(this->programID, index, binding);
 
     }
 
     void Shader::passBool(const std::string& name, bool value) {
 
-        glUniform1i(glGetUniformLocation(this->programID, name.c_str()), (int)value);
+        glUniform1i(this->getUniformLocation(name), (int)value);
 
     }
 
     void Shader::passCamera(Camera camera) {
 
-        // Pass the View matrix to the shader.
-        glm::mat4 view_matrix = camera.getView();
-        GLint location = glGetUniformLocation(this->programID, "View");
-        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(view_matrix));
+        PROFILE_ZONE("Shader::passCamera");
 
-        // Pass the Projection matrix to the shader.
+        // Get the View and Projection matrices.
+        glm::mat4 view_matrix = camera.getView();
         glm::mat4 projection_matrix = camera.getProjection();
-        location = glGetUniformLocation(this->programID, "Projection");
-        glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(projection_matrix));
 
-        // Get the camera info and pass it to the shader.
+        // Get the camera info.
         glm::vec4 color = (*this->light).getColor();
         glm::vec3 position = (*this->light).getPosition();
 
@@ -178,32 +300,62 @@ namespace bgq_opengl {
         
         glm::vec3 camPos = glm::vec3(view_matrix * glm::vec4(camera.getPosition(), 1.0f));
 
-        // Pass it to the shader.
-        glUniform4f(glGetUniformLocation(this->programID, "lightColor"), color.x, color.y, color.z, color.w);
-        glUniform3f(glGetUniformLocation(this->programID, "lightPos"), position.x, position.y, position.z);
-        glUniform3f(glGetUniformLocation(this->programID, "cameraPos"), camPos.x, camPos.y, camPos.z);
+        // Pass to the shader only what changed since the last pass.
+        CameraState& last = this->camera_state;
+        unsigned int uploads = 0;
 
-    }
+        if (!last.uploaded || last.view != view_matrix) {
 
-    void Shader::passCubemap(Cubemap cubemap) {
-        
-        // Gets the location of the uniform.
-        GLuint location = glGetUniformLocation(this->programID, cubemap.getName().c_str());
+            this->builtins.view.set(view_matrix);
+            last.view = view_matrix;
+            uploads++;
 
-        // Activate the shader.
-        this->activate();
-        
-        // Bind this texture.
-        cubemap.bind();
-        
-        // Get the slot.
-        int slot = cubemap.getSlot();
+        }
+
+        if (!last.uploaded || last.projection != projection_matrix) {
+
+            this->builtins.projection.set(projection_matrix);
+            last.projection = projection_matrix;
+            uploads++;
+
+        }
+
+        if (!last.uploaded || last.light_color != color) {
+
+            this->builtins.light_color.set(color);
+            last.light_color = color;
+            uploads++;
+
+        }
+
+        if (!last.uploaded || last.light_position != position) {
+
+            this->builtins.light_position.set(position);
+            last.light_position = position;
+            uploads++;
+
+        }
+
+        if (!last.uploaded || last.camera_position != camPos) {
+
+            this->builtins.camera_position.set(camPos);
+            last.camera_position = camPos;
+            uploads++;
+
+        }
+
+        last.uploaded = true;
+        GLState::countUniforms(uploads, 5 - uploads);
+
+    }
+
+    void Shader::passCubemap(const Cubemap& cubemap) {
         
-        // Activate this texture.
-        glActiveTexture(GL_TEXTURE0 + slot);
+        // Point the sampler to the slot, if it was not already.
+        this->bindSampler(cubemap.getName(), cubemap.getSlot());
 
-        // Sets the value of the texture uniform.
-        glUniform1i(location, slot);
+        // Make sure the slot holds the cubemap.
+        GLState::bindTexture(GL_TEXTURE_CUBE_MAP, cubemap.getSlot(), cubemap.getID());
         
     }
 
@@ -216,64 +368,34 @@ namespace bgq_opengl {
 
     void Shader::passInt(const std::string& name, int value) {
 
-        glUniform1i(glGetUniformLocation(this->programID, name.c_str()), value);
+        glUniform1i(this->getUniformLocation(name), value);
 
     }
 
     void Shader::passFloat(const std::string& name, float value) {
 
-        glUniform1f(glGetUniformLocation(this->programID, name.c_str()), value);
+        glUniform1f(this->getUniformLocation(name), value);
 
     }
 
-    void Shader::passTexture(Texture texture) {
+    void Shader::passTexture(const Texture& texture) {
 
-        // Gets the location of the uniform.
-        GLuint location = glGetUniformLocation(this->programID, texture.getName().c_str());
-
-        // Activate the shader.
-        this->activate();
-        
-        // Bind this texture.
-        texture.bind();
-        
-        // Get the slot.
-        int slot = texture.getSlot();
-        
-        // Activate this texture.
-        glActiveTexture(GL_TEXTURE0 + slot);
-
-        // Sets the value of the texture uniform.
-        glUniform1i(location, slot);
+        // The sampler already points to the slot, so just make sure it holds the texture.
+        GLState::bindTexture(GL_TEXTURE_2D, texture.getSlot(), texture.getID());
 
     }
 
-    void Shader::passLTC(LTCMatrix ltc) {
+    void Shader::passLTC(const LTCMatrix& ltc) {
 
-        // Gets the location of the uniform.
-        GLuint location = glGetUniformLocation(this->programID, ltc.getName().c_str());
-
-        // Activate the shader.
-        this->activate();
-        
-        // Bind this texture.
-        ltc.bind();
-        
-        // Get the slot.
-        int slot = ltc.getSlot();
-        
-        // Activate this texture.
-        glActiveTexture(GL_TEXTURE0 + slot);
-
-        // Sets the value of the texture uniform.
-        glUniform1i(location, slot);
+        // The sampler already points to the slot, so just make sure it holds the matrix.
+        GLState::bindTexture(GL_TEXTURE_2D, ltc.getSlot(), ltc.getID());
 
     }
 
     void Shader::passVec(const std::string& name, glm::vec2 value) {
         
         // Gets the location of the uniform.
-        GLuint location = glGetUniformLocation(this->programID, name.c_str());
+        GLint location = this->getUniformLocation(name);
 
         // Sets the value of the texture uniform.
         glUniform2f(location, value.x, value.y);
@@ -283,7 +405,7 @@ namespace bgq_opengl {
     void Shader::passVec(const std::string& name, glm::vec3 value) {
         
         // Gets the location of the uniform.
-        GLuint location = glGetUniformLocation(this->programID, name.c_str());
+        GLint location = this->getUniformLocation(name);
 
         // Sets the value of the texture uniform.
         glUniform3f(location, value.x, value.y, value.z);
@@ -293,7 +415,7 @@ namespace bgq_opengl {
     void Shader::passVec(const std::string& name, glm::vec4 value) {
         
         // Gets the location of the uniform.
-        GLuint location = glGetUniformLocation(this->programID, name.c_str());
+        GLint location = this->getUniformLocation(name);
 
         // Sets the value of the texture uniform.
         glUniform4f(location, value.x, value.y, value.z, value.w);
@@ -303,7 +425,7 @@ namespace bgq_opengl {
     void Shader::passMat(const std::string& name, glm::mat2 value) {
 
         // Gets the location of the uniform.
-        GLuint location = glGetUniformLocation(this->programID, name.c_str());
+        GLint location = this->getUniformLocation(name);
 
         glUniformMatrix2fv(location, 1, GL_FALSE, glm::value_ptr(value));
 
@@ -312,7 +434,7 @@ namespace bgq_opengl {
     void Shader::passMat(const std::string& name, glm::mat3 value) {
 
         // Gets the location of the uniform.
-        GLuint location = glGetUniformLocation(this->programID, name.c_str());
+        GLint location = this->getUniformLocation(name);
 
         glUniformMatrix3fv(location, 1, GL_FALSE, glm::value_ptr(value));
 
@@ -321,7 +443,7 @@ namespace bgq_opengl {
     void Shader::passMat(const std::string& name, glm::mat4 value) {
 
         // Gets the location of the uniform.
-        GLuint location = glGetUniformLocation(this->programID, name.c_str());
+        GLint location = this->getUniformLocation(name);
 
         glUniformMatrix4fv(location, 1, GL_FALSE, glm::value_ptr(value));
 
@@ -329,10 +451,75 @@ namespace bgq_opengl {
 
     void Shader::remove() {
 
+        GLState::forgetProgram(this->programID);
         glDeleteProgram(this->programID);
 
     }
 
+    void Shader::cacheUniformLocations() {
+
+        // Get how many uniforms are active and how long their names can be.
+        GLint num_uniforms = 0;
+        GLint max_length = 0;
+        glGetProgramiv(this->programID, GL_ACTIVE_UNIFORMS, &num_uniforms);
+        glGetProgramiv(this->programID, GL_ACTIVE_UNIFORM_MAX_LENGTH, &max_length);
+
+        std::vector<char> name_buffer(max_length + 1, '\0');
+
+        for (GLint i = 0; i < num_uniforms; i++) {
+
+            // Get the name and size of this uniform.
+            GLsizei length = 0;
+            GLint size = 0;
+            GLenum type = 0;
+            glGetActiveUniform(this->programID, (GLuint) i, max_length, &length, &size, &type, name_buffer.data());
+            std::string name(name_buffer.data(), length);
+
+            // Uniforms inside blocks have no location of their own.
+            GLint location = glGetUniformLocation(this->programID, name.c_str());
+            if (location < 0)
+                continue;
+
+            this->uniform_locations[name] = location;
+
+            if (isSampler(type))
+                this->sampler_locations[name] = location;
+
+            // Arrays are reported once as "name[0]", so store the rest of the elements too.
+            const std::string suffix = "[0]";
+            if (size > 1 && name.size() > suffix.size() &&
+                name.compare(name.size() - suffix.size(), suffix.size(), suffix) == 0) {
+
+                std::string base = name.substr(0, name.size() - suffix.size());
+                this->uniform_locations[base] = location;
+
+                for (GLint j = 1; j < size; j++) {
+
+                    std::string element = base + "[" + std::to_string(j) + "]";
+                    this->uniform_locations[element] = glGetUniformLocation(this->programID, element.c_str());
+
+                }
+
+            }
+
+        }
+
+        // Resolve the uniforms that are passed on every draw.
+        this->builtins.model = Uniform<glm::mat4>(this->getUniformLocation("Model"));
+        this->builtins.view = Uniform<glm::mat4>(this->getUniformLocation("View"));
+        this->builtins.projection = Uniform<glm::mat4>(this->getUniformLocation("Projection"));
+        this->builtins.model_view = Uniform<glm::mat4>(this->getUniformLocation("modelView"));
+        this->builtins.normal_matrix = Uniform<glm::mat4>(this->getUniformLocation("normalMatrix"));
+        this->builtins.shininess = Uniform<float>(this->getUniformLocation("materialShininess"));
+        this->builtins.packed_vertices = Uniform<bool>(this->getUniformLocation("packedVertices"));
+        this->builtins.light_color = Uniform<glm::vec4>(this->getUniformLocation("lightColor"));
+        this->builtins.light_position = Uniform<glm::vec3>(this->getUniformLocation("lightPos"));
+        this->builtins.camera_position = Uniform<glm::vec3>(this->getUniformLocation("cameraPos"));
+
+        this->uniform_lookups = 0;
+
+    }
+
     bool Shader::checkShader(unsigned int shader, std::string type, std::string* log_str) {
 
         // Create the variables to check the status and the message.
@@ -369,6 +556,31 @@ namespace bgq_opengl {
 
     }
 
+    void Shader::injectDefines(const std::vector<std::string>& defines, std::string* source) {
+
+        // The #version line has to stay the first one, so they go right after it.
+        size_t position = 0;
+        size_t version = source->find("#version");
+
+        if (version != std::string::npos) {
+
+            position = source->find('\n', version);
+            position = position == std::string::npos ? source->size() : position + 1;
+
+        }
+
+        std::string block = "";
+
+        for (size_t i = 0; i < defines.size(); i++)
+            block += "#define " + defines[i] + "\n";
+
+        // Number the lines after the block as they are in the file.
+        block += "#line " + std::to_string(std::count(source->begin(), source->begin() + position, '\n') + 1) + "\n";
+
+        source->insert(position, block);
+
+    }
+
     void Shader::readFileContents(const char* filename, std::string *file_contents) {
 
         try {
@@ -403,4 +615,17 @@ namespace bgq_opengl {
 
     }
 
+    GLint Shader::getUniformLocation(const std::string& name) {
+
+        this->uniform_lookups++;
+
+        // Every active uniform was cached after linking, so anything else is not used by the program.
+        auto it = this->uniform_locations.find(name);
+        if (it == this->uniform_locations.end())
+            return -1;
+
+        return it->second;
+
+    }
+
 }  // namespace bgq_opengl
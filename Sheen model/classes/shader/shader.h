@@ -17,6 +17,8 @@
 #define BGQ_OPENGL_SHADER_H_
 
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 #include "glm/glm.hpp"
 
@@ -25,6 +27,7 @@
 #include "classes/light/light.h"
 #include "classes/texture/texture.h"
 #include "classes/ltc_matrix/ltc_matrix.h"
+#include "classes/uniform/uniform.h"
 
 namespace bgq_opengl {
     
@@ -40,6 +43,27 @@ namespace bgq_opengl {
 
     public:
 
+        /**
+         * @brief Handles to the uniforms the classes pass on every draw.
+         *
+         * Handles to the uniforms that the Shader, Geometry and Camera pass on
+         * every draw, resolved once when the program is linked.
+         */
+        struct Builtins {
+
+            Uniform<glm::mat4> model;           /// Model matrix.
+            Uniform<glm::mat4> view;            /// View matrix.
+            Uniform<glm::mat4> projection;      /// Projection matrix.
+            Uniform<glm::mat4> model_view;      /// Model matrix already multiplied by the view.
+            Uniform<glm::mat4> normal_matrix;   /// Normal matrix.
+            Uniform<float> shininess;           /// Shininess of the material.
+            Uniform<bool> packed_vertices;      /// Whether the vertices are packed.
+            Uniform<glm::vec4> light_color;     /// Color of the point light.
+            Uniform<glm::vec3> light_position;  /// Position of the point light.
+            Uniform<glm::vec3> camera_position; /// Position of the camera.
+
+        };
+
         /**
          * @brief Construct the shader instance.
          *
@@ -57,6 +81,20 @@ namespace bgq_opengl {
          */
         Shader(const char* vertex_filename, const char* fragment_filename);
 
+        /**
+         * @brief Construct a permutation of the shader.
+         *
+         * Construct the shader instance by passing the shaders' files and the
+         * macros to define in both of them, right after their #version line,
+         * so that the features a permutation does not use are compiled out.
+         * The program is loaded from the ProgramCache when it has it.
+         *
+         * @param vertex_filename Vertex shader filename.
+         * @param fragment_filename Fragment shader filename.
+         * @param defines Names of the macros to define.
+         */
+        Shader(const char* vertex_filename, const char* fragment_filename, const std::vector<std::string>& defines);
+
         /**
          *@brief Returns the program ID.
          *
@@ -73,6 +111,73 @@ namespace bgq_opengl {
          */
         void activate();
 
+        /**
+         * @brief Get the handles to the built-in uniforms.
+         *
+         * Get the handles to the uniforms passed on every draw.
+         *
+         * @returns The built-in uniform handles.
+         */
+        const Builtins& getBuiltins();
+
+        /**
+         * @brief Get a handle to a uniform.
+         *
+         * Get a typed handle to a uniform so it can be set without looking its
+         * name up on every pass. Meant to be called once after loading.
+         *
+         * @param name The name of the variable within the shaders.
+         *
+         * @returns The uniform handle, inactive if the program does not use it.
+         */
+        template <typename T>
+        Uniform<T> getUniform(const std::string& name) {
+
+            return Uniform<T>(this->getUniformLocation(name));
+
+        }
+
+        /**
+         * @brief Get the number of uniform lookups by name.
+         *
+         * Get the number of uniform lookups by name since the counter was last
+         * reset. Handles do not count, so a frame that only uses them reports 0.
+         *
+         * @returns The number of lookups.
+         */
+        unsigned int getUniformLookups();
+
+        /**
+         * @brief Reset the uniform lookup counter.
+         *
+         * Reset the uniform lookup counter, usually at the start of a frame.
+         */
+        void resetUniformLookups();
+
+        /**
+         * @brief Bind a sampler to a texture slot.
+         *
+         * Point a sampler of the program to a texture slot. Samplers keep their
+         * slot for the life of the program, so this is called once at startup
+         * for every texture and LTC matrix that will be passed. Their locations
+         * are resolved after linking, so it does not count as a lookup.
+         *
+         * @param name The name of the sampler within the shaders.
+         * @param slot The texture slot.
+         */
+        void bindSampler(const std::string& name, GLuint slot);
+
+        /**
+         * @brief Bind a uniform block to a binding point.
+         *
+         * Bind a uniform block of the program to a binding point, so it reads
+         * from whichever UBO is attached there. Meant to be called once.
+         *
+         * @param name The name of the block within the shaders.
+         * @param binding The binding point.
+         */
+        void bindUniformBlock(const std::string& name, GLuint binding);
+
         /**
          * @brief Pass a given bool to the shaders.
          * 
@@ -86,7 +191,8 @@ namespace bgq_opengl {
         /**
          * @brief Pass the camera matrix and camera position to the shader.
          *
-         * Pass the camera matrix and camera position to the shader.
+         * Pass the camera matrix and camera position to the shader. Values
+         * the program already holds from the previous pass are not uploaded.
          *
          * @param camera The camera.
          */
@@ -95,11 +201,12 @@ namespace bgq_opengl {
         /**
          * @brief Pass a cubemap to the shader.
          *
-         * Pass a cubemap texture to the shader.
+         * Pass a cubemap texture to the shader, binding it unless its slot
+         * already holds it.
          *
          * @param cubemap The cubemap that will be passed.
          */
-        void passCubemap(Cubemap cubemap);
+        void passCubemap(const Cubemap& cubemap);
 
         /**
          * @brief Pass a light to the shader.
@@ -133,20 +240,22 @@ namespace bgq_opengl {
         /**
          * @brief Pass a texture to the shader.
          * 
-         * Pass a texture to the shader.
+         * Pass a texture to the shader by binding it to its slot, unless the
+         * slot already holds it. Its sampler has to be bound with bindSampler.
          * 
          * @param texture The texture itself.
          */
-        void passTexture(Texture texture);
+        void passTexture(const Texture& texture);
         
         /**
          * @brief Pass a linearly transformed cosines.
          *
-         * Pass a linearly transformed cosines.
+         * Pass a linearly transformed cosines by binding it to its slot, unless
+         * the slot already holds it. Its sampler has to be bound with bindSampler.
          *
          * @param ltc The LTC itself.
          */
-        void passLTC(LTCMatrix ltc);
+        void passLTC(const LTCMatrix& ltc);
         
         /**
          * @brief Pass a vector of size 2 to the shader.
@@ -217,6 +326,31 @@ namespace bgq_opengl {
 
     private:
 
+        /**
+         * @brief Values of the camera uniforms last uploaded.
+         *
+         * Values of the uniforms passCamera uploaded last, to skip the ones
+         * that did not change between draws.
+         */
+        struct CameraState {
+
+            bool uploaded = false;      /// Whether the values were uploaded at least once.
+            glm::mat4 view;             /// View matrix.
+            glm::mat4 projection;       /// Projection matrix.
+            glm::vec4 light_color;      /// Color of the point light.
+            glm::vec3 light_position;   /// Position of the point light in view space.
+            glm::vec3 camera_position;  /// Position of the camera in view space.
+
+        };
+
+        /**
+         * @brief Cache the uniform locations of the program.
+         *
+         * Introspects the linked program and stores the location of every
+         * active uniform, including each element of the arrays.
+         */
+        void cacheUniformLocations();
+
         /**
          * @brief Check for errors in the program or shader.
          * 
@@ -230,6 +364,18 @@ namespace bgq_opengl {
          */
         static bool checkShader(unsigned int shader, std::string type, std::string* log_str);
 
+        /**
+         * @brief Defines macros in a shader source.
+         *
+         * Inserts a #define for every macro after the #version line, or at
+         * the start if there is none, and resets the line numbers so the
+         * compiler errors still point to the file.
+         *
+         * @param defines Names of the macros to define.
+         * @param source The source code, modified in place.
+         */
+        static void injectDefines(const std::vector<std::string>& defines, std::string* source);
+
         /**
          * @brief Gets the content of a file as a string.
          *
@@ -242,8 +388,26 @@ namespace bgq_opengl {
          */
         static void readFileContents(const char* filename, std::string *file_contents);
 
+        /**
+         * @brief Gets the location of a uniform.
+         *
+         * Gets the location of a uniform from the cache and counts the lookup.
+         * Names that are not active in the program resolve to -1.
+         *
+         * @param name The name of the variable within the shaders.
+         *
+         * @returns The location of the uniform.
+         */
+        GLint getUniformLocation(const std::string& name);
+
         Light* light; /// The light that will be used in the shader.
         unsigned int programID = -1; /// OpenGL ID for this shader program.
+        Builtins builtins; /// Handles to the uniforms passed on every draw.
+        std::unordered_map<std::string, GLint> uniform_locations; /// Uniform locations by name.
+        unsigned int uniform_lookups = 0; /// Lookups by name since the last reset.
+        std::unordered_map<std::string, GLint> sampler_locations; /// Location of each active sampler.
+        std::unordered_map<std::string, GLuint> sampler_slots; /// Texture slot of each sampler.
+        CameraState camera_state; /// Camera uniforms last uploaded.
 
     };
 
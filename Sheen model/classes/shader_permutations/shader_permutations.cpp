@@ -0,0 +1,118 @@
+/**
+ * @file shader_permutations.cpp
+ * @brief Shader permutations class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "shader_permutations.h"
+
+#include <stddef.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GL/glew.h"
+
+#include "classes/shader/shader.h"
+
+namespace bgq_opengl {
+
+	ShaderPermutations::ShaderPermutations(const char* vertex_filename, const char* fragment_filename, const std::vector<std::string>& features) {
+
+		this->vertex_filename = vertex_filename;
+		this->fragment_filename = fragment_filename;
+		this->features = features;
+
+	}
+
+	void ShaderPermutations::bindSampler(const std::string& name, GLuint slot) {
+
+		this->samplers.push_back(std::make_pair(name, slot));
+
+		for (std::map<unsigned int, Shader>::iterator it = this->shaders.begin(); it != this->shaders.end(); it++)
+			it->second.bindSampler(name, slot);
+
+	}
+
+	void ShaderPermutations::bindUniformBlock(const std::string& name, GLuint binding) {
+
+		this->blocks.push_back(std::make_pair(name, binding));
+
+		for (std::map<unsigned int, Shader>::iterator it = this->shaders.begin(); it != this->shaders.end(); it++)
+			it->second.bindUniformBlock(name, binding);
+
+	}
+
+	Shader& ShaderPermutations::get(unsigned int bits) {
+
+		std::map<unsigned int, Shader>::iterator it = this->shaders.find(bits);
+
+		if (it != this->shaders.end())
+			return it->second;
+
+		// Define the macro of every bit set.
+		std::vector<std::string> defines;
+
+		for (size_t i = 0; i < this->features.size(); i++)
+			if (bits & (1u << i))
+				defines.push_back(this->features[i]);
+
+		// The map does not move its elements, so the shader can be handed out for good.
+		Shader& shader = this->shaders.emplace(bits, Shader(this->vertex_filename.c_str(), this->fragment_filename.c_str(), defines)).first->second;
+
+		// Bind what the others already have.
+		for (size_t i = 0; i < this->samplers.size(); i++)
+			shader.bindSampler(this->samplers[i].first, this->samplers[i].second);
+
+		for (size_t i = 0; i < this->blocks.size(); i++)
+			shader.bindUniformBlock(this->blocks[i].first, this->blocks[i].second);
+
+		return shader;
+
+	}
+
+	size_t ShaderPermutations::getCount() {
+
+		return this->shaders.size();
+
+	}
+
+	unsigned int ShaderPermutations::getUniformLookups() {
+
+		unsigned int lookups = 0;
+
+		for (std::map<unsigned int, Shader>::iterator it = this->shaders.begin(); it != this->shaders.end(); it++)
+			lookups += it->second.getUniformLookups();
+
+		return lookups;
+
+	}
+
+	void ShaderPermutations::resetUniformLookups() {
+
+		for (std::map<unsigned int, Shader>::iterator it = this->shaders.begin(); it != this->shaders.end(); it++)
+			it->second.resetUniformLookups();
+
+	}
+
+	void ShaderPermutations::remove() {
+
+		for (std::map<unsigned int, Shader>::iterator it = this->shaders.begin(); it != this->shaders.end(); it++)
+			it->second.remove();
+
+		this->shaders.clear();
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,139 @@
+/**
+ * @file shader_permutations.h
+ * @brief Shader permutations class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_SHADER_PERMUTATIONS_H_
+#define BGQ_OPENGL_CLASS_SHADER_PERMUTATIONS_H_
+
+#include <stddef.h>
+
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "GL/glew.h"
+
+#include "classes/shader/shader.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a set of shader permutations.
+	 *
+	 * Implementation of the permutations of a pair of shader files. Every
+	 * feature is a macro, and every bit of a permutation says whether its
+	 * feature is defined, so the shaders can compile out what a permutation
+	 * does not use. The permutations are compiled the first time they are
+	 * asked for and kept by their bits. The one with no bits set is the
+	 * shaders as they are in the files.
+	 *
+	 * The samplers and uniform blocks are bound on every permutation, the
+	 * ones compiled later included.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class ShaderPermutations {
+
+	public:
+
+		/**
+		 * @brief Constructs the permutations.
+		 *
+		 * Constructs the permutations of a pair of shader files. None is
+		 * compiled yet.
+		 *
+		 * @param vertex_filename Vertex shader filename.
+		 * @param fragment_filename Fragment shader filename.
+		 * @param features Macro of each bit, the first one for the lowest.
+		 */
+		ShaderPermutations(const char* vertex_filename, const char* fragment_filename, const std::vector<std::string>& features);
+
+		/**
+		 * @brief Bind a sampler to a texture slot.
+		 *
+		 * Bind a sampler to a texture slot in every permutation.
+		 *
+		 * @param name The name of the sampler within the shaders.
+		 * @param slot The texture slot.
+		 */
+		void bindSampler(const std::string& name, GLuint slot);
+
+		/**
+		 * @brief Bind a uniform block to a binding point.
+		 *
+		 * Bind a uniform block to a binding point in every permutation.
+		 *
+		 * @param name The name of the block within the shaders.
+		 * @param binding The binding point.
+		 */
+		void bindUniformBlock(const std::string& name, GLuint binding);
+
+		/**
+		 * @brief Get a permutation.
+		 *
+		 * Get the permutation with the features of the bits set, compiling
+		 * it if it is the first time. It stays valid until they are removed.
+		 *
+		 * @param bits The features of the permutation.
+		 *
+		 * @returns The shader of the permutation.
+		 */
+		Shader& get(unsigned int bits);
+
+		/**
+		 * @brief Get the number of permutations compiled.
+		 *
+		 * @returns The number of permutations.
+		 */
+		size_t getCount();
+
+		/**
+		 * @brief Get the number of uniform lookups by name.
+		 *
+		 * Get the number of uniform lookups by name of every permutation
+		 * since the counters were last reset.
+		 *
+		 * @returns The number of lookups.
+		 */
+		unsigned int getUniformLookups();
+
+		/**
+		 * @brief Reset the uniform lookup counters.
+		 *
+		 * Reset the uniform lookup counters of every permutation.
+		 */
+		void resetUniformLookups();
+
+		/**
+		 * @brief Remove the permutations.
+		 *
+		 * Remove every permutation compiled from OpenGL.
+		 */
+		void remove();
+
+	private:
+
+		std::string vertex_filename;								/// Vertex shader filename.
+		std::string fragment_filename;								/// Fragment shader filename.
+		std::vector<std::string> features;							/// Macro of each bit.
+		std::map<unsigned int, Shader> shaders;						/// Permutations compiled, by their bits.
+		std::vector<std::pair<std::string, GLuint>> samplers;		/// Slot of every sampler bound.
+		std::vector<std::pair<std::string, GLuint>> blocks;			/// Binding point of every uniform block bound.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_SHADER_PERMUTATIONS_H_
@@ -23,6 +23,7 @@
 #include "glm/gtc/type_ptr.hpp"
 
 #include "classes/camera/camera.h"
+#include "classes/gl_state/gl_state.h"
 #include "classes/shader/shader.h"
 #include "classes/cubemap/cubemap.h"
 
@@ -65,7 +66,7 @@ namespace bgq_opengl {
         glGenBuffers(1, &this->ebo);
         
         // Bind them.
-        glBindVertexArray(this->vao);
+        GLState::bindVertexArray(this->vao);
         
         // Fill the VBo with the vertices.
         glBindBuffer(GL_ARRAY_BUFFER, this->vbo);
@@ -81,7 +82,7 @@ namespace bgq_opengl {
         // Unbind everything.
         glEnableVertexAttribArray(0);
         glBindBuffer(GL_ARRAY_BUFFER, 0);
-        glBindVertexArray(0);
+        GLState::bindVertexArray(0);
         glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
     }
@@ -116,11 +117,11 @@ namespace bgq_opengl {
 
         // Draws the cubemap as the last object so we can save a bit of performance by discarding all fragments
         // where an object is present (a depth of 1.0f will always fail against any object's depth value)
-        glBindVertexArray(this->vao);
-        glActiveTexture(GL_TEXTURE0);
-        glBindTexture(GL_TEXTURE_CUBE_MAP, cubemap.getID());
+        GLState::bindVertexArray(this->vao);
+        GLState::bindTexture(GL_TEXTURE_CUBE_MAP, 0, cubemap.getID());
         glDrawElements(GL_TRIANGLES, 36, GL_UNSIGNED_INT, 0);
-        glBindVertexArray(0);
+        GLState::countDraw(1);
+        GLState::bindVertexArray(0);
 
         // Switch back to the normal depth function
         glDepthFunc(GL_LESS);
@@ -0,0 +1,636 @@
+/**
+ * @file software_renderer.cpp
+ * @brief Software renderer class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "software_renderer.h"
+
+#include <math.h>
+#include <stdint.h>
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "classes/geometry/geometry.h"
+#include "classes/ltc_reference/ltc_reference.h"
+#include "classes/thread_pool/thread_pool.h"
+#include "structs/frame/frame.h"
+#include "structs/image/image.h"
+#include "structs/light_block/light_block.h"
+#include "structs/material_block/material_block.h"
+#include "structs/shading_batch/shading_batch.h"
+
+namespace bgq_opengl {
+
+	namespace {
+
+		const size_t VERTEX_BLOCK = 4096;		// Vertices transformed per task.
+		const size_t TRIANGLE_BLOCK = 2048;		// Triangles set up per task.
+		const float SUBPIXELS = 256.0f;			// Window coordinates are snapped to 1/256 of a pixel.
+		const uint32_t EMPTY = 0xFFFFFFFF;		// Chunk of the pixels no triangle covers.
+
+		/**
+		 * A range of vertices or triangles of a draw.
+		 */
+		struct Range {
+
+			int draw;
+			size_t first;
+			size_t last;
+
+		};
+
+		// Split the items of every draw in blocks.
+		template <class F>
+		std::vector<Range> split(size_t draws, size_t block, F count) {
+
+			std::vector<Range> ranges;
+
+			for (size_t i = 0; i < draws; i++)
+				for (size_t first = 0; first < count(i); first += block)
+					ranges.push_back({(int) i, first, std::min(first + block, count(i))});
+
+			return ranges;
+
+		}
+
+		// Normalise, leaving zero vectors as they are instead of making NaNs.
+		glm::vec3 normalizeSafe(const glm::vec3& v) {
+
+			float length = glm::length(v);
+			return length > 0.0f ? v / length : v;
+
+		}
+
+		// Sample a texture with GL_LINEAR and GL_REPEAT. Missing textures read as black.
+		glm::vec3 sampleImage(const Image* image, const glm::vec2& uv) {
+
+			if (image == NULL || image->pixels.empty())
+				return glm::vec3(0.0f);
+
+			// Move to texel space, where the centers are on the integers.
+			float x = uv.x * image->width - 0.5f;
+			float y = uv.y * image->height - 0.5f;
+			float x0 = floorf(x);
+			float y0 = floorf(y);
+			float fx = x - x0;
+			float fy = y - y0;
+
+			// Wrap the four texels around.
+			int i0 = ((int) x0 % image->width + image->width) % image->width;
+			int j0 = ((int) y0 % image->height + image->height) % image->height;
+			int i1 = (i0 + 1) % image->width;
+			int j1 = (j0 + 1) % image->height;
+
+			glm::vec3 texels[4];
+			int columns[4] = {i0, i1, i0, i1};
+			int rows[4] = {j0, j0, j1, j1};
+
+			for (int k = 0; k < 4; k++) {
+
+				const unsigned char* texel = &image->pixels[((size_t) rows[k] * image->width + columns[k]) * image->channels];
+
+				// Single channel textures are uploaded as GL_RED.
+				if (image->channels >= 3)
+					texels[k] = glm::vec3(texel[0], texel[1], texel[2]) / 255.0f;
+				else
+					texels[k] = glm::vec3(texel[0] / 255.0f, 0.0f, 0.0f);
+
+			}
+
+			glm::vec3 bottom = texels[0] + (texels[1] - texels[0]) * fx;
+			glm::vec3 top = texels[2] + (texels[3] - texels[2]) * fx;
+
+			return bottom + (top - bottom) * fy;
+
+		}
+
+		// Convert a color to 8 bits as the framebuffer does.
+		unsigned char toByte(float value) {
+
+			// Also catches NaN.
+			if (!(value > 0.0f))
+				return 0;
+
+			return (unsigned char) (std::min(value, 1.0f) * 255.0f + 0.5f);
+
+		}
+
+	}
+
+	SoftwareRenderer::SoftwareRenderer(int width, int height, int tile_size, int threads, const LTCReference& ltc) : ltc(ltc) {
+
+		this->width = width;
+		this->height = height;
+		this->tile_size = std::max(1, tile_size);
+		this->tiles_x = (width + this->tile_size - 1) / this->tile_size;
+		this->tiles_y = (height + this->tile_size - 1) / this->tile_size;
+		this->clear_color = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+		this->color = std::vector<unsigned char>((size_t) width * height * 4, 0);
+
+		this->setThreads(threads);
+
+	}
+
+	void SoftwareRenderer::clear(const glm::vec4& color) {
+
+		this->clear_color = color;
+		this->draws.clear();
+
+	}
+
+	void SoftwareRenderer::draw(Geometry& geometry, const MaterialBlock& material, const Image* diffuse, const Image* normalmap, const Image* specular) {
+
+		// Only the GPU has the vertices of these.
+		if (!geometry.hasVertices())
+			return;
+
+		Draw draw;
+		draw.vertices = &geometry.getVertices();
+		draw.indices = &geometry.getIndices();
+		draw.model = geometry.getTransformMat();
+		draw.material = material;
+		draw.diffuse = diffuse;
+		draw.normalmap = normalmap;
+		draw.specular = specular;
+
+		this->draws.push_back(draw);
+
+	}
+
+	int SoftwareRenderer::getHeight() {
+
+		return this->height;
+
+	}
+
+	SoftwareRenderer::Stats SoftwareRenderer::getStats() {
+
+		return this->stats;
+
+	}
+
+	int SoftwareRenderer::getThreads() {
+
+		return this->pool->getThreads();
+
+	}
+
+	int SoftwareRenderer::getWidth() {
+
+		return this->width;
+
+	}
+
+	void SoftwareRenderer::read(Frame* frame) {
+
+		frame->width = this->width;
+		frame->height = this->height;
+		frame->pixels = this->color;
+
+	}
+
+	void SoftwareRenderer::render(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& camera_position, const LightBlock& light) {
+
+		this->stats = Stats();
+
+		// Run ltc.vert on every vertex.
+		this->shaded.resize(this->draws.size());
+
+		for (size_t i = 0; i < this->draws.size(); i++)
+			this->shaded[i].resize(this->draws[i].vertices->size());
+
+		std::vector<Range> vertex_ranges = split(this->draws.size(), VERTEX_BLOCK, [this](size_t i) { return this->draws[i].vertices->size(); });
+
+		this->pool->run((int) vertex_ranges.size(), [&](int task, int) {
+
+			const Range& range = vertex_ranges[task];
+			const Draw& draw = this->draws[range.draw];
+			glm::mat4 model_view_projection = projection * (view * draw.model);
+
+			for (size_t i = range.first; i < range.last; i++) {
+
+				const Vertex& in = (*draw.vertices)[i];
+				ShadedVertex& out = this->shaded[range.draw][i];
+
+				out.clip = model_view_projection * glm::vec4(in.position, 1.0f);
+				out.position = glm::vec3(draw.model * glm::vec4(in.position, 1.0f));
+				out.normal = glm::vec3(draw.model * glm::vec4(in.normal, 0.0f));
+				out.tangent = glm::vec3(draw.model * glm::vec4(in.tangent, 0.0f));
+				out.bitangent = glm::vec3(draw.model * glm::vec4(in.bitangent, 0.0f));
+
+				// The UVs are rotated by mat2(0.0, -1.0, 1.0, 0.0).
+				out.uv = glm::vec2(in.uv.y, -in.uv.x);
+
+			}
+
+		});
+
+		// Set the triangles up and bin them, every task into its own chunk so the order is kept.
+		std::vector<Range> triangle_ranges = split(this->draws.size(), TRIANGLE_BLOCK, [this](size_t i) { return this->draws[i].indices->size() / 3; });
+		this->chunks.resize(triangle_ranges.size());
+
+		this->pool->run((int) triangle_ranges.size(), [&](int task, int) {
+
+			const Range& range = triangle_ranges[task];
+			this->binTriangles(range.draw, range.first, range.last, &this->chunks[task]);
+
+		});
+
+		for (size_t i = 0; i < this->chunks.size(); i++)
+			this->stats.triangles += this->chunks[i].triangles.size();
+
+		// Rasterize and shade the tiles.
+		for (size_t i = 0; i < this->scratch.size(); i++)
+			this->scratch[i].fragments = 0;
+
+		this->pool->run(this->tiles_x * this->tiles_y, [&](int tile, int thread) {
+
+			this->renderTile(tile, &this->scratch[thread], camera_position, light);
+
+		});
+
+		this->stats.steals = this->pool->getSteals();
+
+		for (size_t i = 0; i < this->scratch.size(); i++)
+			this->stats.fragments += this->scratch[i].fragments;
+
+	}
+
+	void SoftwareRenderer::setThreads(int threads) {
+
+		if (threads <= 0)
+			threads = std::max(1, (int) std::thread::hardware_concurrency());
+
+		// Stop the old threads before starting the new ones.
+		this->pool.reset();
+		this->pool.reset(new ThreadPool(threads));
+		this->scratch.resize(threads);
+
+	}
+
+	void SoftwareRenderer::binTriangles(int draw, size_t first, size_t last, Chunk* chunk) {
+
+		// Empty the chunk, keeping its memory.
+		chunk->triangles.clear();
+		chunk->bins.resize(this->tiles_x * this->tiles_y);
+
+		for (size_t i = 0; i < chunk->bins.size(); i++)
+			chunk->bins[i].clear();
+
+		const std::vector<GLuint>& indices = *this->draws[draw].indices;
+		const std::vector<ShadedVertex>& vertices = this->shaded[draw];
+
+		for (size_t i = first; i < last; i++) {
+
+			ShadedVertex in[3] = {vertices[indices[i * 3]], vertices[indices[i * 3 + 1]], vertices[indices[i * 3 + 2]]};
+
+			// Drop the triangles that are fully outside one of the planes.
+			bool outside = false;
+			for (int axis = 0; axis < 3 && !outside; axis++) {
+
+				outside = (in[0].clip[axis] > in[0].clip.w && in[1].clip[axis] > in[1].clip.w && in[2].clip[axis] > in[2].clip.w) ||
+						  (in[0].clip[axis] < -in[0].clip.w && in[1].clip[axis] < -in[1].clip.w && in[2].clip[axis] < -in[2].clip.w);
+
+			}
+
+			if (outside)
+				continue;
+
+			// Distance of every vertex to the near plane (z = -w).
+			float distance[3];
+			int inside = 0;
+			for (int j = 0; j < 3; j++) {
+
+				distance[j] = in[j].clip.z + in[j].clip.w;
+				inside += distance[j] >= 0.0f;
+
+			}
+
+			if (inside == 3) {
+
+				this->setupTriangle(in, draw, chunk);
+				continue;
+
+			}
+
+			// Clip the polygon against the near plane, which leaves 3 or 4 vertices.
+			ShadedVertex out[4];
+			int count = 0;
+
+			for (int j = 0; j < 3; j++) {
+
+				const ShadedVertex& a = in[j];
+				const ShadedVertex& b = in[(j + 1) % 3];
+				float da = distance[j];
+				float db = distance[(j + 1) % 3];
+
+				if (da >= 0.0f)
+					out[count++] = a;
+
+				// Add the point where the edge crosses the plane. Every attribute is linear in clip space.
+				if ((da >= 0.0f) != (db >= 0.0f)) {
+
+					float t = da / (da - db);
+					ShadedVertex& v = out[count++];
+					v.clip = a.clip + (b.clip - a.clip) * t;
+					v.position = a.position + (b.position - a.position) * t;
+					v.normal = a.normal + (b.normal - a.normal) * t;
+					v.tangent = a.tangent + (b.tangent - a.tangent) * t;
+					v.bitangent = a.bitangent + (b.bitangent - a.bitangent) * t;
+					v.uv = a.uv + (b.uv - a.uv) * t;
+
+				}
+
+			}
+
+			// Fan the polygon out into triangles.
+			for (int j = 1; j + 1 < count; j++) {
+
+				ShadedVertex triangle[3] = {out[0], out[j], out[j + 1]};
+				this->setupTriangle(triangle, draw, chunk);
+
+			}
+
+		}
+
+	}
+
+	void SoftwareRenderer::renderTile(int tile, Scratch* scratch, const glm::vec3& camera_position, const LightBlock& light) {
+
+		// Pixels of the tile.
+		int x0 = (tile % this->tiles_x) * this->tile_size;
+		int y0 = (tile / this->tiles_x) * this->tile_size;
+		int x1 = std::min(x0 + this->tile_size, this->width);
+		int y1 = std::min(y0 + this->tile_size, this->height);
+		int tile_width = x1 - x0;
+		int pixels = tile_width * (y1 - y0);
+
+		// Clear the depth to 1, as glClear does.
+		scratch->depth.assign(pixels, 1.0f);
+		scratch->samples.assign(pixels, Sample{EMPTY, 0, 0.0f, 0.0f});
+
+		// Rasterize the triangles in the order they were drawn.
+		for (size_t c = 0; c < this->chunks.size(); c++) {
+
+			const Chunk& chunk = this->chunks[c];
+			const std::vector<uint32_t>& bin = chunk.bins[tile];
+
+			for (size_t k = 0; k < bin.size(); k++) {
+
+				const Triangle& t = chunk.triangles[bin[k]];
+
+				// Pixels of the tile whose center can be inside the triangle.
+				float left = std::max(-1.0f, std::min(t.x[0], std::min(t.x[1], t.x[2])) - 0.5f);
+				float right = std::min((float) this->width, std::max(t.x[0], std::max(t.x[1], t.x[2])) - 0.5f);
+				float bottom = std::max(-1.0f, std::min(t.y[0], std::min(t.y[1], t.y[2])) - 0.5f);
+				float top = std::min((float) this->height, std::max(t.y[0], std::max(t.y[1], t.y[2])) - 0.5f);
+				int start_x = std::max(x0, (int) ceilf(left));
+				int end_x = std::min(x1 - 1, (int) floorf(right));
+				int start_y = std::max(y0, (int) ceilf(bottom));
+				int end_y = std::min(y1 - 1, (int) floorf(top));
+
+				// Edge functions, oriented so the inside is positive. The coordinates are snapped,
+				// so in double they are exact and shared edges give every pixel to one triangle.
+				double orientation = t.area > 0.0f ? 1.0 : -1.0;
+				double a[3], b[3], c0[3];
+				bool top_left[3];
+
+				for (int e = 0; e < 3; e++) {
+
+					int from = (e + 1) % 3;
+					int to = (e + 2) % 3;
+					double dx = ((double) t.x[to] - t.x[from]) * orientation;
+					double dy = ((double) t.y[to] - t.y[from]) * orientation;
+
+					// w(px, py) = a * px + b * py + c0.
+					a[e] = -dy;
+					b[e] = dx;
+					c0[e] = dy * t.x[from] - dx * t.y[from];
+					top_left[e] = dy > 0.0 || (dy == 0.0 && dx < 0.0);
+
+				}
+
+				double inv_area = 1.0 / ((double) t.area * orientation);
+
+				for (int y = start_y; y <= end_y; y++) {
+
+					double py = y + 0.5;
+					double px = start_x + 0.5;
+					double w[3];
+
+					for (int e = 0; e < 3; e++)
+						w[e] = a[e] * px + b[e] * py + c0[e];
+
+					for (int x = start_x; x <= end_x; x++, w[0] += a[0], w[1] += a[1], w[2] += a[2]) {
+
+						// Inside, with the top-left rule on the edges.
+						if (!((w[0] > 0.0 || (w[0] == 0.0 && top_left[0])) &&
+							  (w[1] > 0.0 || (w[1] == 0.0 && top_left[1])) &&
+							  (w[2] > 0.0 || (w[2] == 0.0 && top_left[2]))))
+							continue;
+
+						// The depth is linear in window space.
+						float l0 = (float) (w[0] * inv_area);
+						float l1 = (float) (w[1] * inv_area);
+						float l2 = (float) (w[2] * inv_area);
+						float z = l0 * t.z[0] + l1 * t.z[1] + l2 * t.z[2];
+
+						int pixel = (y - y0) * tile_width + (x - x0);
+
+						// GL_LESS.
+						if (!(z < scratch->depth[pixel]))
+							continue;
+
+						scratch->depth[pixel] = z;
+
+						// The attributes are not, so weight them by 1 / w.
+						float q0 = l0 * t.inv_w[0];
+						float q1 = l1 * t.inv_w[1];
+						float q2 = l2 * t.inv_w[2];
+						float q = q0 + q1 + q2;
+
+						scratch->samples[pixel] = Sample{(uint32_t) c, bin[k], q1 / q, q2 / q};
+
+					}
+
+				}
+
+			}
+
+		}
+
+		// Group the covered pixels by draw, so each group is shaded with one material.
+		scratch->pixels.resize(this->draws.size());
+
+		for (size_t i = 0; i < scratch->pixels.size(); i++)
+			scratch->pixels[i].clear();
+
+		for (int i = 0; i < pixels; i++) {
+
+			const Sample& sample = scratch->samples[i];
+
+			if (sample.chunk != EMPTY) {
+
+				scratch->pixels[this->chunks[sample.chunk].triangles[sample.triangle].draw].push_back(i);
+
+			} else {
+
+				// Nothing covers it, so it keeps the clear color.
+				unsigned char* out = &this->color[(((size_t) (y0 + i / tile_width)) * this->width + x0 + i % tile_width) * 4];
+				out[0] = toByte(this->clear_color.x);
+				out[1] = toByte(this->clear_color.y);
+				out[2] = toByte(this->clear_color.z);
+				out[3] = toByte(this->clear_color.w);
+
+			}
+
+		}
+
+		for (size_t d = 0; d < scratch->pixels.size(); d++) {
+
+			const std::vector<int>& group = scratch->pixels[d];
+
+			if (group.empty())
+				continue;
+
+			const Draw& draw = this->draws[d];
+			const MaterialBlock& material = draw.material;
+			ShadingBatch& batch = scratch->batch;
+			batch.resize(group.size());
+
+			// Run the first half of ltc.frag, up to the normal it shades with.
+			for (size_t k = 0; k < group.size(); k++) {
+
+				const Sample& sample = scratch->samples[group[k]];
+				const Triangle& t = this->chunks[sample.chunk].triangles[sample.triangle];
+				const ShadedVertex* v = t.vertices;
+				float b0 = 1.0f - sample.b1 - sample.b2;
+
+				glm::vec3 position = v[0].position * b0 + v[1].position * sample.b1 + v[2].position * sample.b2;
+				glm::vec3 normal = v[0].normal * b0 + v[1].normal * sample.b1 + v[2].normal * sample.b2;
+				glm::vec3 tangent = v[0].tangent * b0 + v[1].tangent * sample.b1 + v[2].tangent * sample.b2;
+				glm::vec3 bitangent = v[0].bitangent * b0 + v[1].bitangent * sample.b1 + v[2].bitangent * sample.b2;
+				glm::vec2 uv = v[0].uv * b0 + v[1].uv * sample.b1 + v[2].uv * sample.b2;
+
+				// Selec the right elements for the materials.
+				glm::vec3 diffuse_val = material.alt_diffuse;
+				glm::vec3 specular_val = material.alt_specular;
+				glm::vec3 normals_val = material.alt_normal;
+
+				if (!material.use_alt) {
+
+					diffuse_val = sampleImage(draw.diffuse, uv);
+					specular_val = sampleImage(draw.specular, uv) * material.specular_mult;
+					normals_val = sampleImage(draw.normalmap, uv);
+
+				}
+
+				// To world space through the tangent frame.
+				glm::vec3 world_normal = normalizeSafe(normalizeSafe(tangent) * normals_val.x + normalizeSafe(bitangent) * normals_val.y + normalizeSafe(normal) * normals_val.z);
+
+				if (material.dust)
+					world_normal = normalizeSafe(normal);
+
+				// Control those normals that are backwards.
+				if (t.front)
+					world_normal = -world_normal;
+
+				batch.px[k] = position.x;
+				batch.py[k] = position.y;
+				batch.pz[k] = position.z;
+				batch.nx[k] = world_normal.x;
+				batch.ny[k] = world_normal.y;
+				batch.nz[k] = world_normal.z;
+				batch.dr[k] = diffuse_val.x;
+				batch.dg[k] = diffuse_val.y;
+				batch.db[k] = diffuse_val.z;
+				batch.sr[k] = specular_val.x;
+				batch.sg[k] = specular_val.y;
+				batch.sb[k] = specular_val.z;
+
+			}
+
+			// And the rest of it, with the SIMD kernels.
+			this->ltc.shade(light, material, camera_position, &batch);
+
+			for (size_t k = 0; k < group.size(); k++) {
+
+				int i = group[k];
+				unsigned char* out = &this->color[(((size_t) (y0 + i / tile_width)) * this->width + x0 + i % tile_width) * 4];
+				out[0] = toByte(batch.r[k]);
+				out[1] = toByte(batch.g[k]);
+				out[2] = toByte(batch.b[k]);
+				out[3] = 255;
+
+			}
+
+			scratch->fragments += group.size();
+
+		}
+
+	}
+
+	void SoftwareRenderer::setupTriangle(const ShadedVertex vertices[3], int draw, Chunk* chunk) {
+
+		Triangle t;
+		t.draw = draw;
+
+		// Project to the window, snapping x and y to the subpixel grid.
+		for (int i = 0; i < 3; i++) {
+
+			const glm::vec4& clip = vertices[i].clip;
+			float inv_w = 1.0f / clip.w;
+
+			t.vertices[i] = vertices[i];
+			t.x[i] = roundf((clip.x * inv_w * 0.5f + 0.5f) * this->width * SUBPIXELS) / SUBPIXELS;
+			t.y[i] = roundf((clip.y * inv_w * 0.5f + 0.5f) * this->height * SUBPIXELS) / SUBPIXELS;
+			t.z[i] = clip.z * inv_w * 0.5f + 0.5f;
+			t.inv_w[i] = inv_w;
+
+		}
+
+		// Counter-clockwise triangles face the camera.
+		t.area = (t.x[1] - t.x[0]) * (t.y[2] - t.y[0]) - (t.x[2] - t.x[0]) * (t.y[1] - t.y[0]);
+		t.front = t.area > 0.0f;
+
+		if (!(t.area != 0.0f && isfinite(t.area)))
+			return;
+
+		// Pixels whose center can be inside it, clamped before converting so far away vertices do not overflow.
+		float left = std::max(-1.0f, std::min(t.x[0], std::min(t.x[1], t.x[2])) - 0.5f);
+		float right = std::min((float) this->width, std::max(t.x[0], std::max(t.x[1], t.x[2])) - 0.5f);
+		float bottom = std::max(-1.0f, std::min(t.y[0], std::min(t.y[1], t.y[2])) - 0.5f);
+		float top = std::min((float) this->height, std::max(t.y[0], std::max(t.y[1], t.y[2])) - 0.5f);
+		int min_x = std::max(0, (int) ceilf(left));
+		int max_x = std::min(this->width - 1, (int) floorf(right));
+		int min_y = std::max(0, (int) ceilf(bottom));
+		int max_y = std::min(this->height - 1, (int) floorf(top));
+
+		if (min_x > max_x || min_y > max_y)
+			return;
+
+		// Add it to every tile it touches.
+		uint32_t index = (uint32_t) chunk->triangles.size();
+		chunk->triangles.push_back(t);
+
+		for (int ty = min_y / this->tile_size; ty <= max_y / this->tile_size; ty++)
+			for (int tx = min_x / this->tile_size; tx <= max_x / this->tile_size; tx++)
+				chunk->bins[ty * this->tiles_x + tx].push_back(index);
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,319 @@
+/**
+ * @file software_renderer.h
+ * @brief Software renderer class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_SOFTWARE_RENDERER_H_
+#define BGQ_OPENGL_CLASS_SOFTWARE_RENDERER_H_
+
+#include <stdint.h>
+
+#include <memory>
+#include <vector>
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+
+#include "classes/geometry/geometry.h"
+#include "classes/ltc_reference/ltc_reference.h"
+#include "classes/thread_pool/thread_pool.h"
+#include "structs/frame/frame.h"
+#include "structs/image/image.h"
+#include "structs/light_block/light_block.h"
+#include "structs/material_block/material_block.h"
+#include "structs/shading_batch/shading_batch.h"
+#include "structs/vertex/vertex.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a tile-based software renderer.
+	 *
+	 * Implementation of a renderer that draws the geometries with ltc.vert
+	 * and ltc.frag on the CPU, so the scenes can be rendered on machines
+	 * without a GPU. A frame goes through three parallel stages:
+	 *
+	 * 1. The vertices of every draw are transformed as ltc.vert does.
+	 * 2. The triangles are clipped against the near plane and binned into
+	 *    the screen tiles they touch.
+	 * 3. Every tile is rasterized with a depth test, and only then are the
+	 *    visible pixels shaded, in batches of the same material, with the
+	 *    SIMD kernels of LTCReference.
+	 *
+	 * The tiles are spread over a work-stealing ThreadPool, so the tiles
+	 * with more geometry do not keep the rest of the cores waiting. The
+	 * textures are sampled bilinearly from their full-size level.
+	 *
+	 * Its images have not been compared with the ones of the GL path yet,
+	 * so how closely they match is unknown.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class SoftwareRenderer {
+
+	public:
+
+		/**
+		 * @brief Counters of the last frame.
+		 */
+		struct Stats {
+
+			size_t triangles = 0;		/// Triangles binned after clipping.
+			size_t fragments = 0;		/// Pixels that passed the depth test and were shaded.
+			unsigned int steals = 0;	/// Tiles run by a thread other than their owner.
+
+		};
+
+		/**
+		 * @brief Constructs the renderer.
+		 *
+		 * Constructs the renderer and starts its threads.
+		 *
+		 * @param width Width of the frames in pixels.
+		 * @param height Height of the frames in pixels.
+		 * @param tile_size Side of the tiles in pixels.
+		 * @param threads Number of threads, 0 to use every core.
+		 * @param ltc Shades the pixels. Its tables have to outlive the renderer.
+		 */
+		SoftwareRenderer(int width, int height, int tile_size, int threads, const LTCReference& ltc);
+
+		/**
+		 * @brief Clears the frame.
+		 *
+		 * Sets the color of the pixels no triangle covers, and drops the
+		 * draws queued since the last render.
+		 *
+		 * @param color The clear color.
+		 */
+		void clear(const glm::vec4& color);
+
+		/**
+		 * @brief Queues a geometry.
+		 *
+		 * Queues a geometry with its current transforms. The vertices,
+		 * indices and images are not copied, so they have to live until the
+		 * frame is rendered. Geometries that released their vertices are
+		 * skipped.
+		 *
+		 * @param geometry The geometry.
+		 * @param material The material, as uploaded to the MaterialBlock.
+		 * @param diffuse The diffuse texture, or NULL.
+		 * @param normalmap The normal map, or NULL.
+		 * @param specular The specular texture, or NULL.
+		 */
+		void draw(Geometry& geometry, const MaterialBlock& material, const Image* diffuse, const Image* normalmap, const Image* specular);
+
+		/**
+		 * @brief Get the height of the frames.
+		 *
+		 * Get the height of the frames in pixels.
+		 *
+		 * @returns The height.
+		 */
+		int getHeight();
+
+		/**
+		 * @brief Get the counters of the last frame.
+		 *
+		 * Get the counters of the last frame rendered.
+		 *
+		 * @returns The counters.
+		 */
+		Stats getStats();
+
+		/**
+		 * @brief Get the number of threads.
+		 *
+		 * Get the number of threads the frames are rendered with.
+		 *
+		 * @returns The number of threads.
+		 */
+		int getThreads();
+
+		/**
+		 * @brief Get the width of the frames.
+		 *
+		 * Get the width of the frames in pixels.
+		 *
+		 * @returns The width.
+		 */
+		int getWidth();
+
+		/**
+		 * @brief Reads the frame.
+		 *
+		 * Copies the last frame rendered, bottom row first as glReadPixels
+		 * returns it.
+		 *
+		 * @param frame Output frame. Its name is left as it is.
+		 */
+		void read(Frame* frame);
+
+		/**
+		 * @brief Renders the queued draws.
+		 *
+		 * Renders the draws queued since the last clear.
+		 *
+		 * @param view The view matrix.
+		 * @param projection The projection matrix.
+		 * @param camera_position The camera position, in world space.
+		 * @param light The area light, as uploaded to the LightBlock.
+		 */
+		void render(const glm::mat4& view, const glm::mat4& projection, const glm::vec3& camera_position, const LightBlock& light);
+
+		/**
+		 * @brief Sets the number of threads.
+		 *
+		 * Restarts the threads with a new count.
+		 *
+		 * @param threads Number of threads, 0 to use every core.
+		 */
+		void setThreads(int threads);
+
+	private:
+
+		/**
+		 * @brief A geometry queued for the frame.
+		 */
+		struct Draw {
+
+			const std::vector<Vertex> *vertices;	/// Its vertices.
+			const std::vector<GLuint> *indices;		/// Its triangles.
+			glm::mat4 model;						/// Model matrix.
+			MaterialBlock material;					/// Material.
+			const Image *diffuse;					/// Diffuse texture, or NULL.
+			const Image *normalmap;					/// Normal map, or NULL.
+			const Image *specular;					/// Specular texture, or NULL.
+
+		};
+
+		/**
+		 * @brief A vertex after ltc.vert.
+		 */
+		struct ShadedVertex {
+
+			glm::vec4 clip;			/// gl_Position.
+			glm::vec3 position;		/// vertexPosition.
+			glm::vec3 normal;		/// vertexNormal.
+			glm::vec3 tangent;		/// vertexTangent.
+			glm::vec3 bitangent;	/// vertexBitangent.
+			glm::vec2 uv;			/// vertexUV.
+
+		};
+
+		/**
+		 * @brief A triangle ready to be rasterized.
+		 */
+		struct Triangle {
+
+			ShadedVertex vertices[3];	/// The vertices, after clipping.
+			float x[3], y[3];			/// Window coordinates.
+			float z[3];					/// Depth, from 0 to 1.
+			float inv_w[3];				/// 1 / w, for the perspective correction.
+			float area;					/// Twice the signed area in window coordinates.
+			int draw;					/// Index of its draw.
+			bool front;					/// Whether it faces the camera (counter-clockwise).
+
+		};
+
+		/**
+		 * @brief The triangles set up by one task and their tile bins.
+		 */
+		struct Chunk {
+
+			std::vector<Triangle> triangles;			/// Triangles set up by the task.
+			std::vector<std::vector<uint32_t>> bins;	/// Triangles of the chunk that touch each tile.
+
+		};
+
+		/**
+		 * @brief The closest triangle of a pixel.
+		 */
+		struct Sample {
+
+			uint32_t chunk;		/// Chunk of the triangle.
+			uint32_t triangle;	/// Triangle within the chunk.
+			float b1, b2;		/// Perspective-correct barycentric weights of the second and third vertices.
+
+		};
+
+		/**
+		 * @brief Memory a thread reuses from tile to tile.
+		 */
+		struct Scratch {
+
+			std::vector<float> depth;					/// Depth buffer of the tile.
+			std::vector<Sample> samples;				/// Closest triangle of every pixel.
+			std::vector<std::vector<int>> pixels;		/// Covered pixels of the tile, by draw.
+			ShadingBatch batch;							/// Points being shaded.
+			size_t fragments = 0;						/// Pixels shaded in this frame.
+
+		};
+
+		/**
+		 * @brief Sets up and bins a range of triangles.
+		 *
+		 * Clips the triangles against the near plane, sets them up and adds
+		 * them to the bins of the tiles they touch.
+		 *
+		 * @param draw The draw.
+		 * @param first First triangle.
+		 * @param last One past the last triangle.
+		 * @param chunk Where the triangles go.
+		 */
+		void binTriangles(int draw, size_t first, size_t last, Chunk* chunk);
+
+		/**
+		 * @brief Rasterizes and shades a tile.
+		 *
+		 * Rasterizes the triangles binned into a tile, shades the pixels that
+		 * are visible and writes their colors.
+		 *
+		 * @param tile The tile.
+		 * @param scratch Memory of the thread.
+		 * @param camera_position The camera position.
+		 * @param light The area light.
+		 */
+		void renderTile(int tile, Scratch* scratch, const glm::vec3& camera_position, const LightBlock& light);
+
+		/**
+		 * @brief Sets a triangle up.
+		 *
+		 * Projects a clipped triangle to the window and bins it.
+		 *
+		 * @param vertices The vertices, in clip space.
+		 * @param draw The draw.
+		 * @param chunk Where the triangle goes.
+		 */
+		void setupTriangle(const ShadedVertex vertices[3], int draw, Chunk* chunk);
+
+		int width;									/// Width of the frames.
+		int height;									/// Height of the frames.
+		int tile_size;								/// Side of the tiles.
+		int tiles_x;								/// Tiles per row.
+		int tiles_y;								/// Rows of tiles.
+		glm::vec4 clear_color;						/// Color of the empty pixels.
+		std::vector<unsigned char> color;			/// The frame, RGBA, bottom row first.
+		std::vector<Draw> draws;					/// Draws queued for the frame.
+		std::vector<std::vector<ShadedVertex>> shaded;	/// Vertices of every draw after ltc.vert.
+		std::vector<Chunk> chunks;					/// Triangles of the frame.
+		std::vector<Scratch> scratch;				/// Memory of every thread.
+		std::unique_ptr<ThreadPool> pool;			/// The threads.
+		LTCReference ltc;							/// Shades the pixels.
+		Stats stats;								/// Counters of the last frame.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_SOFTWARE_RENDERER_H_
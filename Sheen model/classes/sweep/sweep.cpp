@@ -0,0 +1,212 @@
+/**
+ * @file sweep.cpp
+ * @brief Sweep class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "sweep.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "structs/sweep_point/sweep_point.h"
+
+namespace bgq_opengl {
+
+	Sweep::Sweep(const char* filename, const SweepPoint& defaults) {
+
+		std::ifstream file(filename);
+		if (!file) {
+
+			std::cerr << "Sweep error: sweep " << filename << " could not be loaded." << std::endl;
+			exit(1);
+
+		}
+
+		// Read the values of every parameter, in the order of the file.
+		std::vector<std::string> names;
+		std::vector<std::vector<float>> values;
+		std::string line;
+
+		while (std::getline(file, line)) {
+
+			// Split the line in tokens.
+			std::istringstream stream(line);
+			std::vector<std::string> tokens;
+			std::string token;
+
+			while (stream >> token)
+				tokens.push_back(token);
+
+			// Skip empty lines and comments.
+			if (tokens.empty() || tokens[0][0] == '#')
+				continue;
+
+			// The first token is the name and the rest are the values.
+			std::string name = tokens[0];
+			tokens.erase(tokens.begin());
+
+			std::vector<float> parameter_values;
+
+			if (!Sweep::parseValues(tokens, &parameter_values)) {
+
+				std::cerr << "Sweep error: could not parse the values in \"" << line << "\"." << std::endl;
+				exit(1);
+
+			}
+
+			// Check the name now rather than for every combination.
+			SweepPoint check;
+			Sweep::setParameter(name, parameter_values[0], &check);
+
+			names.push_back(name);
+			values.push_back(parameter_values);
+
+		}
+
+		// Walk every combination like nested loops, the first parameter being the outermost.
+		std::vector<size_t> index(names.size(), 0);
+
+		while (true) {
+
+			SweepPoint point = defaults;
+
+			for (size_t i = 0; i < names.size(); i++)
+				Sweep::setParameter(names[i], values[i][index[i]], &point);
+
+			// Only the parameters that change go in the name, after the sheen type.
+			const char* prefixes[3] = {"none", "zel", "cos"};
+			int sheen_type = point.sheen_type >= 0 && point.sheen_type <= 2 ? point.sheen_type : 0;
+			point.name = prefixes[sheen_type];
+			int position = 0;
+
+			for (size_t i = 0; i < names.size(); i++) {
+
+				if (values[i].size() > 1 && names[i] != "sheenType")
+					point.name += "-" + Sweep::formatValue(sheen_type, position++, values[i][index[i]]);
+
+			}
+			this->points.push_back(point);
+
+			// Advance the innermost parameter, carrying to the outer ones.
+			int i = (int) names.size() - 1;
+
+			while (i >= 0 && ++index[i] == values[i].size()) {
+
+				index[i] = 0;
+				i--;
+
+			}
+
+			if (i < 0)
+				break;
+
+		}
+
+	}
+
+	const std::vector<SweepPoint>& Sweep::getPoints() {
+
+		return this->points;
+
+	}
+
+	bool Sweep::parseValues(const std::vector<std::string>& tokens, std::vector<float>* values) {
+
+		for (size_t i = 0; i < tokens.size(); i++) {
+
+			const std::string& token = tokens[i];
+			size_t first = token.find(':');
+
+			// A single value.
+			if (first == std::string::npos) {
+
+				char* end;
+				float value = strtof(token.c_str(), &end);
+				if (*end != '\0')
+					return false;
+
+				values->push_back(value);
+				continue;
+
+			}
+
+			// A start:stop:step range, stop included.
+			size_t second = token.find(':', first + 1);
+			if (second == std::string::npos)
+				return false;
+
+			float start = strtof(token.substr(0, first).c_str(), NULL);
+			float stop = strtof(token.substr(first + 1, second - first - 1).c_str(), NULL);
+			float step = strtof(token.substr(second + 1).c_str(), NULL);
+
+			if (step <= 0.0f || stop < start)
+				return false;
+
+			// Count the steps first so rounding does not drop the last one.
+			int count = (int) floor((stop - start) / step + 1e-4) + 1;
+
+			for (int k = 0; k < count; k++)
+				values->push_back(start + k * step);
+
+		}
+
+		return !values->empty();
+
+	}
+
+	std::string Sweep::formatValue(int sheen_type, int position, float value) {
+
+		std::ostringstream stream;
+		stream << value;
+
+		// The first value of the grids in Results keeps a decimal when it is whole, zel-0.0-1 and cos-1.0-5, except for cos-0.
+		bool whole = value == floorf(value);
+		bool decimal = position == 0 && (sheen_type == 1 || (sheen_type == 2 && value != 0.0f));
+
+		if (whole && decimal)
+			stream << ".0";
+
+		return stream.str();
+
+	}
+
+	void Sweep::setParameter(const std::string& name, float value, SweepPoint* point) {
+
+		if (name == "alpha")
+			point->alpha = value;
+		else if (name == "beta")
+			point->beta = value;
+		else if (name == "csheen")
+			point->csheen = value;
+		else if (name == "sheenType")
+			point->sheen_type = (int) lround(value);
+		else if (name == "roughness")
+			point->roughness = value;
+		else if (name == "intensity")
+			point->intensity = value;
+		else {
+
+			std::cerr << "Sweep error: unknown parameter " << name << "." << std::endl;
+			exit(1);
+
+		}
+
+	}
+
+}  // namespace bgq_opengl
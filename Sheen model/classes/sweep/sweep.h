@@ -0,0 +1,114 @@
+/**
+ * @file sweep.h
+ * @brief Sweep class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_SWEEP_H_
+#define BGQ_OPENGL_CLASS_SWEEP_H_
+
+#include <string>
+#include <vector>
+
+#include "structs/sweep_point/sweep_point.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a parameter sweep.
+	 *
+	 * Implementation of a parameter sweep read from a spec file. Every line
+	 * of the file names a parameter (alpha, beta, csheen, sheenType,
+	 * roughness or intensity) followed by its values, either listed or as a
+	 * start:stop:step range, and lines starting with # are comments:
+	 *
+	 *     sheenType 1
+	 *     alpha 0:1:0.25
+	 *     csheen 0 1 10
+	 *
+	 * The sweep is every combination of the values, in the order of the file,
+	 * and the parameters that are not in the file keep their default value.
+	 * Images are named after the sheen type (none, zel or cos) followed by the
+	 * values of the parameters that take more than one, so the spec above
+	 * produces names like zel-0.25-1, as in Results/Zel.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class Sweep {
+
+	public:
+
+		/**
+		 * @brief Reads a sweep.
+		 *
+		 * Reads a sweep spec file and builds all the combinations.
+		 *
+		 * @param filename Name of the spec file.
+		 * @param defaults Values of the parameters that are not in the file.
+		 */
+		Sweep(const char* filename, const SweepPoint& defaults);
+
+		/**
+		 * @brief Get the combinations.
+		 *
+		 * Get every combination of parameters in the sweep.
+		 *
+		 * @returns The combinations.
+		 */
+		const std::vector<SweepPoint>& getPoints();
+
+	private:
+
+		/**
+		 * @brief Parses the values of a parameter.
+		 *
+		 * Parses the values of a parameter, listed or as ranges.
+		 *
+		 * @param tokens The tokens after the name of the parameter.
+		 * @param values Output vector with the values.
+		 *
+		 * @returns True if the values could be parsed.
+		 */
+		static bool parseValues(const std::vector<std::string>& tokens, std::vector<float>* values);
+
+		/**
+		 * @brief Formats a value for the name of an image.
+		 *
+		 * Formats a value as the existing grids in Results name it, so a
+		 * regenerated sweep replaces their images.
+		 *
+		 * @param sheen_type The sheen type of the image.
+		 * @param position Position of the value among the ones in the name.
+		 * @param value The value.
+		 *
+		 * @returns The formatted value.
+		 */
+		static std::string formatValue(int sheen_type, int position, float value);
+
+		/**
+		 * @brief Sets a parameter of a point.
+		 *
+		 * Sets the parameter with the given name in a point.
+		 *
+		 * @param name The name of the parameter.
+		 * @param value The value.
+		 * @param point The point to modify.
+		 */
+		static void setParameter(const std::string& name, float value, SweepPoint* point);
+
+		std::vector<SweepPoint> points;	/// Every combination of the sweep.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_SWEEP_H_
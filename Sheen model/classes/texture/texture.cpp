@@ -21,124 +21,59 @@
 
 #include "GL/glew.h"
 #include "stb/stb_image.h"
+
+#include "classes/cpu_profiler/cpu_profiler.h"
+#include "classes/gl_state/gl_state.h"
+#include "structs/image/image.h"
 
 namespace bgq_opengl {
 
-	Texture::Texture(const char* image, const char* name, GLuint slot) {
-        
-        // The slot has to be a positive number because OpenGL does weird stuff on macOS else.
-        if (slot < 1) assert(false);
-
-		// Generate a texture in OpenGL and store the parameters in the attributes.
-		glGenTextures(1, &this->ID);
-		this->name = std::string(name);
-		this->slot = slot;
-
-		// This function has to be used because OpenGL loads texture the opposite way
-		// than this library, so images appear upside down.
-		stbi_set_flip_vertically_on_load(true);
-
-		// Read the texture image and its information.
-		unsigned char* image_bytes = stbi_load(image, &this->texture_width,
-				&this->texture_height, &this->texture_channels, 0);
-
-		// Set the slot for the texture.
-		glActiveTexture(GL_TEXTURE0 + slot);
-		glBindTexture(GL_TEXTURE_2D, this->ID);
-
-		// Configure the magnifying algorithm, minifying algorithm and repetition.
-		// This tells OpenGL how to apply intrpolation.
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST_MIPMAP_LINEAR);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-		glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-		// Get the color model for the image.
-		GLenum color_model = GL_RGBA;
-
-		if (this->texture_channels == 4)
-			color_model = GL_RGBA;
-		else if (this->texture_channels == 3)
-			color_model = GL_RGB;
-		else if (this->texture_channels == 1)
-			color_model = GL_RED;
-		else
-			assert(false);
-
-		// Load the image to OpenGL.
-		glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->texture_width, this->texture_height,
-				0, color_model, GL_UNSIGNED_BYTE, image_bytes);
-		glGenerateMipmap(GL_TEXTURE_2D);
-
-		// Clean the memory.
-		stbi_image_free(image_bytes);
-
-		// Unbinds the OpenGL Texture.
-		glBindTexture(GL_TEXTURE_2D, 0);
-
-	}
+	Texture::Texture(const char* image, const char* name, GLuint slot) : Texture(image, name, slot, GL_NEAREST_MIPMAP_LINEAR, GL_NEAREST) {}
 
     Texture::Texture(const char* image, const char* name, GLuint slot, GLint param1, GLint param2) {
         
-        // The slot has to be a positive number because OpenGL does weird stuff on macOS else.
-        if (slot < 1) assert(false);
-
-        // Generate a texture in OpenGL and store the parameters in the attributes.
-        glGenTextures(1, &this->ID);
-        this->name = std::string(name);
-        this->slot = slot;
-
-        // This function has to be used because OpenGL loads texture the opposite way
-        // than this library, so images appear upside down.
-        stbi_set_flip_vertically_on_load(true);
-
         // Read the texture image and its information.
-        unsigned char* image_bytes = stbi_load(image, &this->texture_width,
-                &this->texture_height, &this->texture_channels, 0);
-
-        // Set the slot for the texture.
-        glActiveTexture(GL_TEXTURE0 + slot);
-        glBindTexture(GL_TEXTURE_2D, this->ID);
-
-        // Configure the magnifying algorithm, minifying algorithm and repetition.
-        // This tells OpenGL how to apply intrpolation.
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, param1);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, param2);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
-
-        // Get the color model for the image.
-        GLenum color_model = GL_RGBA;
-
-        if (this->texture_channels == 4)
-            color_model = GL_RGBA;
-        else if (this->texture_channels == 3)
-            color_model = GL_RGB;
-        else if (this->texture_channels == 1)
-            color_model = GL_RED;
-        else
-            assert(false);
-
-        // Load the image to OpenGL.
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->texture_width, this->texture_height,
-                0, color_model, GL_UNSIGNED_BYTE, image_bytes);
-        glGenerateMipmap(GL_TEXTURE_2D);
+        Image image_data;
+        Texture::loadImage(image, &image_data);
+        
+        // Upload it.
+        this->upload(image_data, name, slot, param1, param2);
+        
+    }
 
-        // Clean the memory.
-        stbi_image_free(image_bytes);
+    Texture::Texture(const Image& image, const char* name, GLuint slot, GLint param1, GLint param2) {
+        
+        this->upload(image, name, slot, param1, param2);
+        
+    }
 
-        // Unbinds the OpenGL Texture.
-        glBindTexture(GL_TEXTURE_2D, 0);
+    bool Texture::loadImage(const char* filename, Image* image) {
 
+        PROFILE_ZONE("Texture::loadImage");
+        
+        // This has to be used because OpenGL loads texture the opposite way than this library,
+        // so images appear upside down. It is set for this thread only, images may be decoded on several.
+        stbi_set_flip_vertically_on_load_thread(true);
+        
+        unsigned char* bytes = stbi_load(filename, &image->width, &image->height, &image->channels, 0);
+        
+        if (bytes == NULL)
+            return false;
+        
+        image->pixels.assign(bytes, bytes + (size_t) image->width * image->height * image->channels);
+        stbi_image_free(bytes);
+        
+        return true;
+        
     }
 
-	GLuint Texture::getID() {
+	GLuint Texture::getID() const {
 
 		return this->ID;
 
 	}
 
-	GLuint Texture::getSlot() {
+	GLuint Texture::getSlot() const {
 
 		return this->slot;
 
@@ -162,7 +97,7 @@ namespace bgq_opengl {
 
 	}
 
-	std::string Texture::getName() {
+	std::string Texture::getName() const {
 
 		return this->name;
 
@@ -171,21 +106,68 @@ namespace bgq_opengl {
 	void Texture::bind() {
 
 		// Activate the texture and bind it.
-		glActiveTexture(GL_TEXTURE0 + this->slot);
-		glBindTexture(GL_TEXTURE_2D, this->ID);
+		GLState::bindTexture(GL_TEXTURE_2D, this->slot, this->ID);
 
 	}
 
 	void Texture::remove() {
 
+		GLState::forgetTexture(this->ID);
 		glDeleteTextures(1, &this->ID);
 
 	}
 
 	void Texture::unbind() {
 
-		glBindTexture(GL_TEXTURE_2D, 0);
+		GLState::bindTexture(GL_TEXTURE_2D, this->slot, 0);
 
 	}
 
+    void Texture::upload(const Image& image, const char* name, GLuint slot, GLint param1, GLint param2) {
+
+        PROFILE_ZONE("Texture::upload");
+        
+        // The slot has to be a positive number because OpenGL does weird stuff on macOS else.
+        if (slot < 1) assert(false);
+
+        // Generate a texture in OpenGL and store the parameters in the attributes.
+        glGenTextures(1, &this->ID);
+        this->name = std::string(name);
+        this->slot = slot;
+        this->texture_width = image.width;
+        this->texture_height = image.height;
+        this->texture_channels = image.channels;
+
+        // Set the slot for the texture.
+        GLState::bindTexture(GL_TEXTURE_2D, slot, this->ID);
+
+        // Configure the magnifying algorithm, minifying algorithm and repetition.
+        // This tells OpenGL how to apply intrpolation.
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, param1);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, param2);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+
+        // Get the color model for the image.
+        GLenum color_model = GL_RGBA;
+
+        if (this->texture_channels == 4)
+            color_model = GL_RGBA;
+        else if (this->texture_channels == 3)
+            color_model = GL_RGB;
+        else if (this->texture_channels == 1)
+            color_model = GL_RED;
+        else
+            assert(false);
+
+        // Load the image to OpenGL.
+        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, this->texture_width, this->texture_height,
+                0, color_model, GL_UNSIGNED_BYTE, image.pixels.data());
+        glGenerateMipmap(GL_TEXTURE_2D);
+
+        // Unbinds the OpenGL Texture.
+        GLState::bindTexture(GL_TEXTURE_2D, slot, 0);
+
+    }
+
 } // namespace bgq_opengl
@@ -20,6 +20,8 @@
 
 #include "GL/glew.h"
 
+#include "structs/image/image.h"
+
 namespace bgq_opengl {
 
 	/**
@@ -58,6 +60,33 @@ namespace bgq_opengl {
              */
             Texture(const char* image, const char* name, GLuint slot, GLint param1, GLint param2);
 
+            /**
+             * @brief Creates a texture from an image already decoded.
+             *
+             * Creates a texture from an image decoded with loadImage, maybe on
+             * another thread, and passes it to OpenGL.
+             *
+             * @param image The decoded image.
+             * @param name Texture name in the shader.
+             * @param slot Texture slot.
+             * @param param1 GL_TEXTURE_MIN_FILTER parameter.
+             * @param param2 GL_TEXTURE_MAG_FILTER parameter.
+             */
+            Texture(const Image& image, const char* name, GLuint slot, GLint param1, GLint param2);
+
+            /**
+             * @brief Decodes an image.
+             *
+             * Decodes an image file, bottom row first as OpenGL expects it. It
+             * does not touch OpenGL, so it can run on any thread.
+             *
+             * @param filename The image file.
+             * @param image Outputs the decoded image.
+             *
+             * @returns True if it could be decoded.
+             */
+            static bool loadImage(const char* filename, Image* image);
+
 			/**
 			 * @brief Get the ID of the texture.
 			 * 
@@ -65,7 +94,7 @@ namespace bgq_opengl {
 			 * 
 			 * @returns The ID of the texture.
 			 */
-			GLuint getID();
+			GLuint getID() const;
 
 			/**
 			 * @brief Get the slot of the texture.
@@ -74,7 +103,7 @@ namespace bgq_opengl {
 			 * 
 			 * @returns The slot of the texture.
 			 */
-			GLuint getSlot();
+			GLuint getSlot() const;
 
 			/**
 			 * @brief Gets the width of the image.
@@ -110,7 +139,7 @@ namespace bgq_opengl {
 			 * 
 			 * @returns A char string containing the name name of the texture.
 			 */
-			std::string getName();
+			std::string getName() const;
 
 			/**
 			 * @brief Binds the texture.
@@ -135,6 +164,19 @@ namespace bgq_opengl {
 
 		private:
 
+            /**
+             * @brief Uploads an image.
+             *
+             * Creates the OpenGL texture and uploads the image to it.
+             *
+             * @param image The decoded image.
+             * @param name Texture name in the shader.
+             * @param slot Texture slot.
+             * @param param1 GL_TEXTURE_MIN_FILTER parameter.
+             * @param param2 GL_TEXTURE_MAG_FILTER parameter.
+             */
+            void upload(const Image& image, const char* name, GLuint slot, GLint param1, GLint param2);
+
 			GLuint ID;					/// Texture OpenGL ID.
 			GLuint slot;				/// Stores the texture slot number.
 			int texture_width = 0;		/// Width of the texture in pixels.
@@ -0,0 +1,193 @@
+/**
+ * @file thread_pool.cpp
+ * @brief Thread pool class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "thread_pool.h"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "classes/cpu_profiler/cpu_profiler.h"
+
+namespace bgq_opengl {
+
+	ThreadPool::ThreadPool(int threads) : pending(0), steals(0) {
+
+		threads = std::max(1, threads);
+
+		// One queue per thread, the caller uses the first one.
+		for (int i = 0; i < threads; i++)
+			this->queues.push_back(std::unique_ptr<Queue>(new Queue()));
+
+		// Start the workers.
+		for (int i = 1; i < threads; i++)
+			this->workers.push_back(std::thread(&ThreadPool::work, this, i));
+
+	}
+
+	ThreadPool::~ThreadPool() {
+
+		// Tell the workers to leave.
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->finishing = true;
+		}
+
+		this->has_work.notify_all();
+
+		for (size_t i = 0; i < this->workers.size(); i++)
+			this->workers[i].join();
+
+	}
+
+	unsigned int ThreadPool::getSteals() {
+
+		return this->steals;
+
+	}
+
+	int ThreadPool::getThreads() {
+
+		return (int) this->queues.size();
+
+	}
+
+	void ThreadPool::run(int count, const std::function<void(int task, int thread)> &task) {
+
+		if (count <= 0)
+			return;
+
+		int threads = this->getThreads();
+
+		// Start the run before any task is queued, so whoever takes one sees it.
+		{
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->task = &task;
+			this->pending = count;
+			this->steals = 0;
+			this->generation++;
+		}
+
+		// Give every thread a contiguous block of tasks.
+		for (int i = 0; i < threads; i++) {
+
+			std::lock_guard<std::mutex> lock(this->queues[i]->mutex);
+
+			for (int j = (int) ((long long) count * i / threads); j < (int) ((long long) count * (i + 1) / threads); j++)
+				this->queues[i]->tasks.push_back(j);
+
+		}
+
+		this->has_work.notify_all();
+
+		// Work too, then wait for the tasks the others are still running.
+		this->drain(0);
+
+		std::unique_lock<std::mutex> lock(this->mutex);
+		this->done.wait(lock, [this] { return this->pending == 0 && this->active == 0; });
+		this->task = NULL;
+
+	}
+
+	void ThreadPool::drain(int thread) {
+
+		int threads = this->getThreads();
+
+		while (true) {
+
+			int next = -1;
+
+			// Take from the front of our own queue.
+			{
+				Queue &own = *this->queues[thread];
+				std::lock_guard<std::mutex> lock(own.mutex);
+
+				if (!own.tasks.empty()) {
+
+					next = own.tasks.front();
+					own.tasks.pop_front();
+
+				}
+			}
+
+			// Steal from the back of another one.
+			for (int i = 1; i < threads && next < 0; i++) {
+
+				Queue &victim = *this->queues[(thread + i) % threads];
+				std::lock_guard<std::mutex> lock(victim.mutex);
+
+				if (!victim.tasks.empty()) {
+
+					next = victim.tasks.back();
+					victim.tasks.pop_back();
+					this->steals++;
+
+				}
+
+			}
+
+			// Every queue is empty.
+			if (next < 0)
+				return;
+
+			(*this->task)(next, thread);
+
+			// Wake the caller up if this was the last one.
+			if (--this->pending == 0) {
+
+				std::lock_guard<std::mutex> lock(this->mutex);
+				this->done.notify_all();
+
+			}
+
+		}
+
+	}
+
+	void ThreadPool::work(int thread) {
+
+		CPUProfiler::setThreadName("Worker " + std::to_string(thread));
+
+		unsigned int seen = 0;
+
+		while (true) {
+
+			// Wait for a new run.
+			{
+				std::unique_lock<std::mutex> lock(this->mutex);
+				this->has_work.wait(lock, [this, seen] { return this->finishing || this->generation != seen; });
+
+				if (this->finishing)
+					return;
+
+				seen = this->generation;
+				this->active++;
+			}
+
+			this->drain(thread);
+
+			std::lock_guard<std::mutex> lock(this->mutex);
+			this->active--;
+
+			if (this->active == 0)
+				this->done.notify_all();
+
+		}
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,140 @@
+/**
+ * @file thread_pool.h
+ * @brief Thread pool class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_THREAD_POOL_H_
+#define BGQ_OPENGL_CLASS_THREAD_POOL_H_
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a work-stealing thread pool.
+	 *
+	 * Implementation of a pool of worker threads that run numbered tasks.
+	 * Every run splits the tasks in contiguous blocks, one per thread, so
+	 * neighbouring tasks stay on the same core. A thread that empties its
+	 * own queue steals from the back of the others, so uneven tasks do not
+	 * leave cores idle. The thread that calls run works too.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class ThreadPool {
+
+	public:
+
+		/**
+		 * @brief Starts the workers.
+		 *
+		 * Starts the worker threads.
+		 *
+		 * @param threads Number of threads that run the tasks, counting the caller.
+		 */
+		ThreadPool(int threads);
+
+		/**
+		 * @brief Stops the workers.
+		 *
+		 * Stops and joins the worker threads.
+		 */
+		~ThreadPool();
+
+		/**
+		 * @brief Get the number of steals.
+		 *
+		 * Get the number of tasks taken from another thread's queue in the
+		 * last run.
+		 *
+		 * @returns The number of steals.
+		 */
+		unsigned int getSteals();
+
+		/**
+		 * @brief Get the number of threads.
+		 *
+		 * Get the number of threads that run the tasks, counting the caller.
+		 *
+		 * @returns The number of threads.
+		 */
+		int getThreads();
+
+		/**
+		 * @brief Runs a set of tasks.
+		 *
+		 * Runs the tasks from 0 to count - 1 and waits until all of them are
+		 * done. Tasks may run in any order and at the same time.
+		 *
+		 * @param count Number of tasks.
+		 * @param task Function called with the task and the thread (0 to getThreads() - 1) running it.
+		 */
+		void run(int count, const std::function<void(int task, int thread)> &task);
+
+	private:
+
+		/**
+		 * @brief The tasks of one thread.
+		 */
+		struct Queue {
+
+			std::mutex mutex;		/// Guards the tasks.
+			std::deque<int> tasks;	/// Tasks left, taken from the front by the owner and from the back by thieves.
+
+		};
+
+		ThreadPool(const ThreadPool&) = delete;
+		ThreadPool& operator=(const ThreadPool&) = delete;
+
+		/**
+		 * @brief Runs tasks until there are none left.
+		 *
+		 * Runs the tasks of a thread, then steals from the others.
+		 *
+		 * @param thread The thread.
+		 */
+		void drain(int thread);
+
+		/**
+		 * @brief Waits for runs and drains them.
+		 *
+		 * Body of the worker threads.
+		 *
+		 * @param thread The thread.
+		 */
+		void work(int thread);
+
+		std::vector<std::thread> workers;					/// Worker threads.
+		std::vector<std::unique_ptr<Queue>> queues;			/// Tasks of every thread.
+		const std::function<void(int, int)> *task = NULL;	/// Function of the current run.
+		std::mutex mutex;									/// Guards the run state.
+		std::condition_variable has_work;					/// Signals a new run or the end.
+		std::condition_variable done;						/// Signals the end of a run.
+		unsigned int generation = 0;						/// Number of runs started.
+		int active = 0;										/// Workers inside the current run.
+		std::atomic<int> pending;							/// Tasks not finished yet.
+		std::atomic<unsigned int> steals;					/// Tasks stolen in the current run.
+		bool finishing = false;								/// Whether the workers have to leave.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_THREAD_POOL_H_
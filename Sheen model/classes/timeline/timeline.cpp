@@ -0,0 +1,238 @@
+/**
+ * @file timeline.cpp
+ * @brief Timeline class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "timeline.h"
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "structs/timeline_sample/timeline_sample.h"
+
+namespace bgq_opengl {
+
+	Timeline::Timeline(const TimelineSample& defaults) {
+
+		this->defaults = defaults;
+
+		// Go round the objects, closer on the way, and come back to where it started.
+		glm::vec3 start = defaults.position;
+		glm::vec3 look = defaults.target;
+
+		this->addKey("camera", 0.0f, {start.x, start.y, start.z, look.x, look.y, look.z});
+		this->addKey("camera", 5.0f, {1.0f, 0.6f, 1.0f, 0.0f, 0.0f, 0.0f});
+		this->addKey("camera", 10.0f, {0.0f, 0.3f, 0.8f, 0.0f, 0.0f, 0.0f});
+		this->addKey("camera", 15.0f, {-1.0f, 0.6f, 1.0f, 0.0f, 0.0f, 0.0f});
+		this->addKey("camera", 20.0f, {start.x, start.y, start.z, look.x, look.y, look.z});
+
+		// Half of it with each sheen, over the whole range of alpha.
+		this->addKey("sheenType", 0.0f, {2.0f});
+		this->addKey("sheenType", 10.0f, {1.0f});
+		this->addKey("alpha", 0.0f, {0.2f});
+		this->addKey("alpha", 20.0f, {0.8f});
+
+	}
+
+	Timeline::Timeline(const char* filename, const TimelineSample& defaults) {
+
+		this->defaults = defaults;
+
+		std::ifstream file(filename);
+		if (!file) {
+
+			std::cerr << "Timeline error: timeline " << filename << " could not be loaded." << std::endl;
+			exit(1);
+
+		}
+
+		std::string line;
+
+		while (std::getline(file, line)) {
+
+			// Split the line in tokens.
+			std::istringstream stream(line);
+			std::vector<std::string> tokens;
+			std::string token;
+
+			while (stream >> token)
+				tokens.push_back(token);
+
+			// Skip empty lines and comments.
+			if (tokens.empty() || tokens[0][0] == '#')
+				continue;
+
+			// The name, the time and the values.
+			size_t size = Timeline::getTrackSize(tokens[0]);
+
+			if (size == 0) {
+
+				std::cerr << "Timeline error: unknown track " << tokens[0] << "." << std::endl;
+				exit(1);
+
+			}
+
+			std::vector<float> numbers;
+			bool parsed = tokens.size() == size + 2;
+
+			for (size_t i = 1; i < tokens.size() && parsed; i++) {
+
+				char* end;
+				numbers.push_back(strtof(tokens[i].c_str(), &end));
+				parsed = *end == '\0';
+
+			}
+
+			if (!parsed || numbers[0] < 0.0f) {
+
+				std::cerr << "Timeline error: could not parse the key in \"" << line << "\"." << std::endl;
+				exit(1);
+
+			}
+
+			this->addKey(tokens[0], numbers[0], std::vector<float>(numbers.begin() + 1, numbers.end()));
+
+		}
+
+	}
+
+	void Timeline::addKey(const std::string& track, float time, const std::vector<float>& values) {
+
+		Key key;
+		key.time = time;
+		key.values = values;
+
+		// Keys at the same time keep the order of the file, so the last one wins.
+		std::vector<Key>& keys = this->tracks[track];
+		std::vector<Key>::iterator it = keys.begin();
+
+		while (it != keys.end() && it->time <= time)
+			it++;
+
+		keys.insert(it, key);
+
+	}
+
+	float Timeline::getDuration() {
+
+		float duration = 0.0f;
+
+		for (std::map<std::string, std::vector<Key>>::iterator it = this->tracks.begin(); it != this->tracks.end(); it++)
+			duration = std::max(duration, it->second.back().time);
+
+		return duration;
+
+	}
+
+	size_t Timeline::getTrackSize(const std::string& track) {
+
+		if (track == "camera")
+			return 6;
+
+		if (track == "alpha" || track == "beta" || track == "csheen" || track == "sheenType" || track == "roughness" || track == "intensity")
+			return 1;
+
+		return 0;
+
+	}
+
+	TimelineSample Timeline::sample(float time) {
+
+		TimelineSample sample = this->defaults;
+
+		std::vector<float> camera = {sample.position.x, sample.position.y, sample.position.z, sample.target.x, sample.target.y, sample.target.z};
+		this->sampleTrack("camera", time, &camera);
+		sample.position = glm::vec3(camera[0], camera[1], camera[2]);
+		sample.target = glm::vec3(camera[3], camera[4], camera[5]);
+
+		std::vector<float> value;
+
+		value = {sample.alpha};
+		this->sampleTrack("alpha", time, &value);
+		sample.alpha = value[0];
+
+		value = {sample.beta};
+		this->sampleTrack("beta", time, &value);
+		sample.beta = value[0];
+
+		value = {sample.csheen};
+		this->sampleTrack("csheen", time, &value);
+		sample.csheen = value[0];
+
+		value = {(float) sample.sheen_type};
+		this->sampleTrack("sheenType", time, &value);
+		sample.sheen_type = (int) lround(value[0]);
+
+		value = {sample.roughness};
+		this->sampleTrack("roughness", time, &value);
+		sample.roughness = value[0];
+
+		value = {sample.intensity};
+		this->sampleTrack("intensity", time, &value);
+		sample.intensity = value[0];
+
+		return sample;
+
+	}
+
+	void Timeline::sampleTrack(const std::string& track, float time, std::vector<float>* values) {
+
+		std::map<std::string, std::vector<Key>>::iterator it = this->tracks.find(track);
+
+		if (it == this->tracks.end())
+			return;
+
+		const std::vector<Key>& keys = it->second;
+
+		// Find the first key after the time.
+		size_t next = 0;
+
+		while (next < keys.size() && keys[next].time <= time)
+			next++;
+
+		// Before the first key or after the last one, hold it.
+		if (next == 0) {
+
+			*values = keys.front().values;
+			return;
+
+		}
+
+		const Key& previous = keys[next - 1];
+
+		if (next == keys.size() || track == "sheenType") {
+
+			*values = previous.values;
+			return;
+
+		}
+
+		const Key& following = keys[next];
+		float t = (time - previous.time) / (following.time - previous.time);
+
+		for (size_t i = 0; i < values->size(); i++)
+			(*values)[i] = previous.values[i] + t * (following.values[i] - previous.values[i]);
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,144 @@
+/**
+ * @file timeline.h
+ * @brief Timeline class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_TIMELINE_H_
+#define BGQ_OPENGL_CLASS_TIMELINE_H_
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include "structs/timeline_sample/timeline_sample.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a scripted timeline.
+	 *
+	 * Implementation of a camera path and parameter timeline read from a
+	 * file. Every line of the file is a key of a track: the name of the
+	 * track (camera, alpha, beta, csheen, sheenType, roughness or
+	 * intensity), the time in seconds and the values. Camera keys take the
+	 * position and the point looked at. Lines starting with # are comments:
+	 *
+	 *     camera 0 0 0.5 1.4 0 0 0
+	 *     camera 10 1 0.6 1 0 0 0
+	 *     sheenType 5 1
+	 *     alpha 0 0.2
+	 *     alpha 10 0.8
+	 *
+	 * The tracks are linearly interpolated between their keys, except for the
+	 * sheen type, which holds until the next key, and they keep their first
+	 * and last values before and after them. Tracks without keys keep their
+	 * default value.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class Timeline {
+
+	public:
+
+		/**
+		 * @brief Builds the default timeline.
+		 *
+		 * Builds a 20 second timeline that circles the camera around the
+		 * origin and switches from the cosine-based sheen to Zeltner's
+		 * halfway.
+		 *
+		 * @param defaults Values of the tracks without keys.
+		 */
+		Timeline(const TimelineSample& defaults);
+
+		/**
+		 * @brief Reads a timeline.
+		 *
+		 * Reads a timeline file.
+		 *
+		 * @param filename Name of the timeline file.
+		 * @param defaults Values of the tracks without keys.
+		 */
+		Timeline(const char* filename, const TimelineSample& defaults);
+
+		/**
+		 * @brief Get the duration.
+		 *
+		 * Get the time of the last key of any track.
+		 *
+		 * @returns The duration in seconds.
+		 */
+		float getDuration();
+
+		/**
+		 * @brief Samples the timeline.
+		 *
+		 * Gets the camera and the parameters at a point in time.
+		 *
+		 * @param time The time in seconds.
+		 *
+		 * @returns The sample.
+		 */
+		TimelineSample sample(float time);
+
+	private:
+
+		/**
+		 * @brief A key of a track.
+		 */
+		struct Key {
+
+			float time = 0.0f;				/// Time of the key in seconds.
+			std::vector<float> values;		/// Values of the track at that time.
+
+		};
+
+		/**
+		 * @brief Adds a key to a track.
+		 *
+		 * Adds a key to a track, after the keys at the same time or earlier.
+		 *
+		 * @param track The name of the track.
+		 * @param time The time of the key.
+		 * @param values The values, as many as the track takes.
+		 */
+		void addKey(const std::string& track, float time, const std::vector<float>& values);
+
+		/**
+		 * @brief Samples a track.
+		 *
+		 * Gets the values of a track at a point in time.
+		 *
+		 * @param track The name of the track.
+		 * @param time The time in seconds.
+		 * @param values Output values, left untouched if the track has no keys.
+		 */
+		void sampleTrack(const std::string& track, float time, std::vector<float>* values);
+
+		/**
+		 * @brief Get the number of values of a track.
+		 *
+		 * @param track The name of the track.
+		 *
+		 * @returns The number of values, or 0 if there is no such track.
+		 */
+		static size_t getTrackSize(const std::string& track);
+
+		std::map<std::string, std::vector<Key>> tracks;	/// Keys of every track, in time order.
+		TimelineSample defaults;							/// Values of the tracks without keys.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_TIMELINE_H_
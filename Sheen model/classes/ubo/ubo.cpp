@@ -0,0 +1,85 @@
+/**
+ * @file ubo.cpp
+ * @brief UBO class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "ubo.h"
+
+#include <cstring>
+#include <vector>
+
+#include "GL/glew.h"
+
+namespace bgq_opengl {
+
+	UBO::UBO(GLsizeiptr size, GLuint binding) {
+
+		// Store the parameters.
+		this->binding = binding;
+		this->contents = std::vector<unsigned char>(size, 0);
+
+		// Generate the buffer and allocate its storage.
+		glGenBuffers(1, &this->ID);
+		glBindBuffer(GL_UNIFORM_BUFFER, this->ID);
+		glBufferData(GL_UNIFORM_BUFFER, size, NULL, GL_DYNAMIC_DRAW);
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+	}
+
+	void UBO::bind() {
+
+		// Attach the buffer to its binding point.
+		glBindBufferBase(GL_UNIFORM_BUFFER, this->binding, this->ID);
+
+	}
+
+	GLuint UBO::getBinding() {
+
+		return this->binding;
+
+	}
+
+	void UBO::remove() {
+
+		// Delete the buffer in OpenGL.
+		glDeleteBuffers(1, &this->ID);
+
+	}
+
+	void UBO::unbind() {
+
+		// Attach nothing to the binding point.
+		glBindBufferBase(GL_UNIFORM_BUFFER, this->binding, 0);
+
+	}
+
+	bool UBO::update(const void* data) {
+
+		// Nothing to do if the block has not changed since the last upload.
+		if (this->uploaded && memcmp(this->contents.data(), data, this->contents.size()) == 0)
+			return false;
+
+		// Keep a copy to compare the next update against.
+		memcpy(this->contents.data(), data, this->contents.size());
+		this->uploaded = true;
+
+		// Upload the whole block.
+		glBindBuffer(GL_UNIFORM_BUFFER, this->ID);
+		glBufferSubData(GL_UNIFORM_BUFFER, 0, (GLsizeiptr) this->contents.size(), this->contents.data());
+		glBindBuffer(GL_UNIFORM_BUFFER, 0);
+
+		return true;
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,100 @@
+/**
+ * @file ubo.h
+ * @brief UBO class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASS_UBO_H_
+#define BGQ_OPENGL_CLASS_UBO_H_
+
+#include <vector>
+
+#include "GL/glew.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Implementation of a UBO class.
+	 *
+	 * Implementation of a Uniform Buffer Object class that holds a std140
+	 * uniform block and attaches it to a binding point of the GL pipe.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class UBO {
+
+	public:
+
+		/**
+		 * @brief Constructs a Uniform Buffer Object.
+		 *
+		 * Constructs a Uniform Buffer Object and allocates its storage.
+		 *
+		 * @param size Size of the block in bytes, as laid out by std140.
+		 * @param binding Binding point the block will be attached to.
+		 */
+		UBO(GLsizeiptr size, GLuint binding);
+
+		/**
+		 * @brief Binds the UBO.
+		 *
+		 * Attaches the UBO to its binding point so the shaders read from it.
+		 */
+		void bind();
+
+		/**
+		 * @brief Get the binding point.
+		 *
+		 * Get the binding point the block is attached to.
+		 *
+		 * @returns The binding point.
+		 */
+		GLuint getBinding();
+
+		/**
+		 * @brief Removes the UBO.
+		 *
+		 * Removes the UBO from OpenGL.
+		 */
+		void remove();
+
+		/**
+		 * @brief Unbinds the UBO.
+		 *
+		 * Detaches the UBO from its binding point.
+		 */
+		void unbind();
+
+		/**
+		 * @brief Updates the contents of the block.
+		 *
+		 * Uploads the contents of the block, unless they are the same as the
+		 * ones uploaded last time.
+		 *
+		 * @param data The new contents, as big as the size of the block.
+		 *
+		 * @returns True if the block was uploaded.
+		 */
+		bool update(const void* data);
+
+	private:
+
+		GLuint ID;								/// GL ID of the UBO.
+		GLuint binding;							/// Binding point of the block.
+		std::vector<unsigned char> contents;	/// Copy of the last uploaded contents.
+		bool uploaded = false;					/// Whether the block has been uploaded yet.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_CLASS_UBO_H_
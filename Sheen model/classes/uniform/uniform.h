@@ -0,0 +1,155 @@
+/**
+ * @file uniform.h
+ * @brief Uniform handle class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_UNIFORM_H_
+#define BGQ_OPENGL_CLASSES_UNIFORM_H_
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+#include "glm/gtc/type_ptr.hpp"
+
+namespace bgq_opengl {
+
+    /**
+     * @brief Implements a typed handle to a shader uniform.
+     *
+     * Implements a handle that stores the location of a uniform once it has
+     * been resolved by the Shader, so it can be set later on without looking
+     * its name up again. The program that owns the uniform has to be active
+     * when the value is set.
+     *
+     * @author Borja García Quiroga <garcaqub@tcd.ie>
+     */
+    template <typename T>
+    class Uniform {
+
+        public:
+
+            /**
+             * @brief Constructs an inactive uniform handle.
+             *
+             * Constructs a handle that does not point to any uniform. Setting
+             * it is a no-op, the same as with a name the program does not use.
+             */
+            Uniform() : location(-1) {}
+
+            /**
+             * @brief Constructs a uniform handle from its location.
+             *
+             * Constructs a uniform handle from its location in the program.
+             *
+             * @param location The location of the uniform in the program.
+             */
+            explicit Uniform(GLint location) : location(location) {}
+
+            /**
+             * @brief Get the location of the uniform.
+             *
+             * Get the location of the uniform in the program.
+             *
+             * @returns The location, or -1 if the uniform is not active.
+             */
+            GLint getLocation() const { return this->location; }
+
+            /**
+             * @brief Whether the uniform is used by the program.
+             *
+             * Whether the uniform is used by the program.
+             *
+             * @returns True if the program has an active uniform with this handle.
+             */
+            bool isActive() const { return this->location >= 0; }
+
+            /**
+             * @brief Set the value of the uniform.
+             *
+             * Set the value of the uniform in the currently active program.
+             *
+             * @param value The value that will be passed.
+             */
+            void set(const T& value) const;
+
+        private:
+
+            GLint location; /// Location of the uniform in the program.
+
+    };
+
+    template <>
+    inline void Uniform<bool>::set(const bool& value) const {
+
+        glUniform1i(this->location, (int) value);
+
+    }
+
+    template <>
+    inline void Uniform<int>::set(const int& value) const {
+
+        glUniform1i(this->location, value);
+
+    }
+
+    template <>
+    inline void Uniform<float>::set(const float& value) const {
+
+        glUniform1f(this->location, value);
+
+    }
+
+    template <>
+    inline void Uniform<glm::vec2>::set(const glm::vec2& value) const {
+
+        glUniform2f(this->location, value.x, value.y);
+
+    }
+
+    template <>
+    inline void Uniform<glm::vec3>::set(const glm::vec3& value) const {
+
+        glUniform3f(this->location, value.x, value.y, value.z);
+
+    }
+
+    template <>
+    inline void Uniform<glm::vec4>::set(const glm::vec4& value) const {
+
+        glUniform4f(this->location, value.x, value.y, value.z, value.w);
+
+    }
+
+    template <>
+    inline void Uniform<glm::mat2>::set(const glm::mat2& value) const {
+
+        glUniformMatrix2fv(this->location, 1, GL_FALSE, glm::value_ptr(value));
+
+    }
+
+    template <>
+    inline void Uniform<glm::mat3>::set(const glm::mat3& value) const {
+
+        glUniformMatrix3fv(this->location, 1, GL_FALSE, glm::value_ptr(value));
+
+    }
+
+    template <>
+    inline void Uniform<glm::mat4>::set(const glm::mat4& value) const {
+
+        glUniformMatrix4fv(this->location, 1, GL_FALSE, glm::value_ptr(value));
+
+    }
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_UNIFORM_H_
@@ -17,6 +17,7 @@
 
 #include "GL/glew.h"
 
+#include "classes/gl_state/gl_state.h"
 #include "classes/vbo/vbo.h"
 
 namespace bgq_opengl {
@@ -29,23 +30,32 @@ namespace bgq_opengl {
 
 	}
 
+	VAO::VAO(GLuint ID) {
+
+		this->ID = ID;
+
+	}
+
 	void VAO::bind() {
 
 		// Bind the VAO.
-		glBindVertexArray(this->ID);
+		GLState::bindVertexArray(this->ID);
 
 	}
 
 	void VAO::link_attribute(VBO& vbo, GLuint layout, GLuint num_components, GLenum type,
-		GLsizeiptr step, void* offset) {
+		GLsizeiptr step, void* offset, GLboolean normalized, GLuint divisor) {
 
 		// Bind the VBO.
 		vbo.bind();
 
 		// Tell OpenGL where the data in the VBO is located and activate the layout.
-		glVertexAttribPointer(layout, num_components, type, GL_FALSE, (GLsizei) step, offset);
+		glVertexAttribPointer(layout, num_components, type, normalized, (GLsizei) step, offset);
 		glEnableVertexAttribArray(layout);
 
+		if (divisor != 0)
+			glVertexAttribDivisor(layout, divisor);
+
 		// Unbind the vbo again.
 		vbo.unbind();
 
@@ -53,7 +63,12 @@ namespace bgq_opengl {
 
 	void VAO::remove() {
 
+		// There is nothing to delete if it was never generated.
+		if (this->ID == 0)
+			return;
+
 		// Deletes the VAO from the GL pipe.
+		GLState::forgetVertexArray(this->ID);
 		glDeleteVertexArrays(1, &this->ID);
 
 	}
@@ -61,7 +76,7 @@ namespace bgq_opengl {
 	void VAO::unbind() {
 
 		// Unbind the VAO by binding no VAO.
-		glBindVertexArray(0);
+		GLState::bindVertexArray(0);
 
 	}
 
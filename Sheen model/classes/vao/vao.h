@@ -41,6 +41,16 @@ namespace bgq_opengl {
 		 */
 		VAO();
 
+		/**
+		 * @brief Wraps a Vertex Array Object.
+		 *
+		 * Wraps a Vertex Array Object that already exists, or none if the
+		 * ID is 0, without touching OpenGL.
+		 *
+		 * @param ID The OpenGL VAO ID.
+		 */
+		explicit VAO(GLuint ID);
+
 		/**
 		 * @brief Binds the VBO.
 		 *
@@ -51,7 +61,10 @@ namespace bgq_opengl {
 		/**
 		 * @brief Links a VBO attribute to the VAO.
 		 *
-		 * Links a VBO attribute such as color, UV, or others.
+		 * Links a VBO attribute such as color, UV, or others. Integer types
+		 * can be normalized to [0, 1] or [-1, 1], and packed types such as
+		 * GL_INT_2_10_10_10_REV take 4 components. Attributes with a divisor
+		 * advance once every that many instances instead of once per vertex.
 		 *
 		 * @param vbo The VBO to link the attribute to.
 		 * @param layout The layout identifier that will be used in the shader.
@@ -59,9 +72,11 @@ namespace bgq_opengl {
 		 * @param type The type of data that we will be passing.
 		 * @param step The amount of bytes we have to skip to find the next item.
 		 * @param offset The amount of data we have to skip to find the first item.
+		 * @param normalized Whether integer values are normalized.
+		 * @param divisor Instances per item, or 0 to read one per vertex.
 		 */
 		void link_attribute(VBO& vbo, GLuint layout, GLuint num_components, GLenum type,
-			GLsizeiptr step, void* offset);
+			GLsizeiptr step, void* offset, GLboolean normalized = GL_FALSE, GLuint divisor = 0);
 
 		/**
 		 * @brief Remove the VAO.
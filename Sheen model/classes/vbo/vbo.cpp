@@ -23,14 +23,20 @@
 
 namespace bgq_opengl {
 
-	VBO::VBO(const std::vector<Vertex> &vertices) {
+	VBO::VBO() {}
+
+	VBO::VBO(const std::vector<Vertex> &vertices) : VBO(vertices.data(), vertices.size()) {}
+
+	VBO::VBO(const Vertex* vertices, size_t count) : VBO((const void*) vertices, count * sizeof(Vertex)) {}
+
+	VBO::VBO(const void* data, size_t size) {
 
 		// Generate the buffer.
 		glGenBuffers(1, &this->ID);
 		glBindBuffer(GL_ARRAY_BUFFER, this->ID);
 
 		// Link the vertices.
-		glBufferData(GL_ARRAY_BUFFER, vertices.size() * sizeof(Vertex), vertices.data(), GL_STATIC_DRAW);
+		glBufferData(GL_ARRAY_BUFFER, size, data, GL_STATIC_DRAW);
 
 	}
 
@@ -56,4 +62,15 @@ namespace bgq_opengl {
 
 	}
 
+	void VBO::update(const void* data, size_t size) {
+
+		if (this->ID == 0)
+			glGenBuffers(1, &this->ID);
+
+		// Reallocate it instead of writing over what may still be drawn.
+		glBindBuffer(GL_ARRAY_BUFFER, this->ID);
+		glBufferData(GL_ARRAY_BUFFER, size, data, GL_DYNAMIC_DRAW);
+
+	}
+
 }  // namespace bgq_opengl
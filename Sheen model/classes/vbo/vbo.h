@@ -36,6 +36,14 @@ namespace bgq_opengl {
 
 	public:
 
+		/**
+		 * @brief Constructs an empty Vertex Buffer Object.
+		 *
+		 * Constructs a handle with no buffer behind it. The buffer is
+		 * generated by the first update.
+		 */
+		VBO();
+
 		/**
 		 * @brief Constructs a Vertex Buffer Object.
 		 *
@@ -45,6 +53,28 @@ namespace bgq_opengl {
 		 */
 		VBO(const std::vector<Vertex> &vertices);
 
+		/**
+		 * @brief Constructs a Vertex Buffer Object.
+		 *
+		 * Constructs a Vertex Buffer Object from vertices that are not in a
+		 * vector, such as a mapped file.
+		 *
+		 * @param vertices Vertices that will be linked.
+		 * @param count Number of vertices.
+		 */
+		VBO(const Vertex* vertices, size_t count);
+
+		/**
+		 * @brief Constructs a Vertex Buffer Object.
+		 *
+		 * Constructs a Vertex Buffer Object from vertices already packed in
+		 * some other layout.
+		 *
+		 * @param data The packed vertices.
+		 * @param size Size of the data, in bytes.
+		 */
+		VBO(const void* data, size_t size);
+
 		/**
 		 * @brief Binds the VBO.
 		 *
@@ -66,9 +96,21 @@ namespace bgq_opengl {
 		 */
 		void unbind();
 
+		/**
+		 * @brief Replaces the data of the VBO.
+		 *
+		 * Replaces the data of the VBO, generating the buffer if there was
+		 * none. The storage is orphaned, so the draws still reading the old
+		 * data do not stall the upload.
+		 *
+		 * @param data The new data.
+		 * @param size Size of the data, in bytes.
+		 */
+		void update(const void* data, size_t size);
+
 	private:
 
-		GLuint ID; // GL ID of the VBO.
+		GLuint ID = 0; // GL ID of the VBO.
 
 	};
 
@@ -0,0 +1,221 @@
+/**
+ * @file vertex_packer.cpp
+ * @brief Vertex packer class implementation file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#include "vertex_packer.h"
+
+#include <math.h>
+#include <string.h>
+
+#include <vector>
+
+#include "glm/glm.hpp"
+#include "glm/gtc/packing.hpp"
+
+#include "structs/packed_vertex/packed_vertex.h"
+#include "structs/vertex/vertex.h"
+
+namespace bgq_opengl {
+
+	namespace {
+
+		/**
+		 * Converts a float in [-1, 1] to a normalized short.
+		 */
+		int16_t toSnorm(float value) {
+
+			return (int16_t) roundf(glm::clamp(value, -1.0f, 1.0f) * 32767.0f);
+
+		}
+
+		/**
+		 * Converts a normalized short to a float, as OpenGL 4.2 and later do.
+		 */
+		float fromSnorm(int16_t value) {
+
+			return glm::max(value / 32767.0f, -1.0f);
+
+		}
+
+		/**
+		 * Gets the sign the bitangent has to be rebuilt with.
+		 */
+		float bitangentSign(const Vertex& vertex) {
+
+			return glm::dot(glm::cross(vertex.normal, vertex.tangent), vertex.bitangent) < 0.0f ? -1.0f : 1.0f;
+
+		}
+
+		/**
+		 * Packs the attributes both layouts store the same way.
+		 */
+		template <typename Packed>
+		void packDirections(const Vertex& vertex, Packed* packed) {
+
+			VertexPacker::octEncode(vertex.normal, packed->normal);
+			VertexPacker::octEncode(vertex.tangent, packed->tangent);
+			packed->uv[0] = glm::packHalf1x16(vertex.uv.x);
+			packed->uv[1] = glm::packHalf1x16(vertex.uv.y);
+
+		}
+
+		/**
+		 * Decodes the attributes both layouts store the same way.
+		 */
+		template <typename Packed>
+		void decodeDirections(const Packed& packed, float sign, Vertex* vertex) {
+
+			vertex->normal = VertexPacker::octDecode(packed.normal);
+			vertex->tangent = VertexPacker::octDecode(packed.tangent);
+			vertex->bitangent = glm::cross(vertex->normal, vertex->tangent) * sign;
+			vertex->uv = glm::vec2(glm::unpackHalf1x16(packed.uv[0]), glm::unpackHalf1x16(packed.uv[1]));
+			vertex->color = glm::vec3(0.0f);
+
+		}
+
+	}  // namespace
+
+	Vertex VertexPacker::decode(const unsigned char* bytes, VertexFormat format) {
+
+		Vertex vertex;
+
+		if (format == VERTEX_FORMAT_HALF) {
+
+			PackedVertexHalf packed;
+			memcpy(&packed, bytes, sizeof(packed));
+
+			vertex.position = glm::vec3(glm::unpackHalf1x16(packed.position[0]), glm::unpackHalf1x16(packed.position[1]), glm::unpackHalf1x16(packed.position[2]));
+			decodeDirections(packed, glm::unpackHalf1x16(packed.position[3]), &vertex);
+
+		} else {
+
+			PackedVertexFloat packed;
+			memcpy(&packed, bytes, sizeof(packed));
+
+			vertex.position = glm::vec3(packed.position[0], packed.position[1], packed.position[2]);
+			decodeDirections(packed, packed.position[3], &vertex);
+
+		}
+
+		return vertex;
+
+	}
+
+	const char* VertexPacker::getFormatName(VertexFormat format) {
+
+		switch (format) {
+
+			case VERTEX_FORMAT_HALF: return "half";
+			case VERTEX_FORMAT_FLOAT: return "float";
+			default: return "full";
+
+		}
+
+	}
+
+	size_t VertexPacker::getStride(VertexFormat format) {
+
+		switch (format) {
+
+			case VERTEX_FORMAT_HALF: return sizeof(PackedVertexHalf);
+			case VERTEX_FORMAT_FLOAT: return sizeof(PackedVertexFloat);
+			default: return sizeof(Vertex);
+
+		}
+
+	}
+
+	glm::vec3 VertexPacker::octDecode(const int16_t encoded[2]) {
+
+		// Fold the lower half of the square back onto the bottom of the octahedron.
+		glm::vec3 vector(fromSnorm(encoded[0]), fromSnorm(encoded[1]), 0.0f);
+		vector.z = 1.0f - fabsf(vector.x) - fabsf(vector.y);
+
+		float fold = glm::max(-vector.z, 0.0f);
+		vector.x += vector.x >= 0.0f ? -fold : fold;
+		vector.y += vector.y >= 0.0f ? -fold : fold;
+
+		return glm::normalize(vector);
+
+	}
+
+	void VertexPacker::octEncode(const glm::vec3& vector, int16_t encoded[2]) {
+
+		float length = fabsf(vector.x) + fabsf(vector.y) + fabsf(vector.z);
+
+		if (length == 0.0f) {
+
+			encoded[0] = 0;
+			encoded[1] = 0;
+			return;
+
+		}
+
+		// Project it on the octahedron, and unfold the bottom half onto the corners.
+		glm::vec2 point = glm::vec2(vector.x, vector.y) / length;
+
+		if (vector.z < 0.0f) {
+
+			glm::vec2 unfolded = 1.0f - glm::abs(glm::vec2(point.y, point.x));
+			point.x = point.x >= 0.0f ? unfolded.x : -unfolded.x;
+			point.y = point.y >= 0.0f ? unfolded.y : -unfolded.y;
+
+		}
+
+		encoded[0] = toSnorm(point.x);
+		encoded[1] = toSnorm(point.y);
+
+	}
+
+	void VertexPacker::pack(const Vertex* vertices, size_t count, VertexFormat format, std::vector<unsigned char>* bytes) {
+
+		bytes->resize(count * VertexPacker::getStride(format));
+		unsigned char* out = bytes->data();
+
+		// The structs are copied in, so the buffer does not have to be aligned.
+		if (format == VERTEX_FORMAT_HALF) {
+
+			for (size_t i = 0; i < count; i++) {
+
+				PackedVertexHalf packed;
+				packed.position[0] = glm::packHalf1x16(vertices[i].position.x);
+				packed.position[1] = glm::packHalf1x16(vertices[i].position.y);
+				packed.position[2] = glm::packHalf1x16(vertices[i].position.z);
+				packed.position[3] = glm::packHalf1x16(bitangentSign(vertices[i]));
+				packDirections(vertices[i], &packed);
+
+				memcpy(out + i * sizeof(packed), &packed, sizeof(packed));
+
+			}
+
+		} else {
+
+			for (size_t i = 0; i < count; i++) {
+
+				PackedVertexFloat packed;
+				packed.position[0] = vertices[i].position.x;
+				packed.position[1] = vertices[i].position.y;
+				packed.position[2] = vertices[i].position.z;
+				packed.position[3] = bitangentSign(vertices[i]);
+				packDirections(vertices[i], &packed);
+
+				memcpy(out + i * sizeof(packed), &packed, sizeof(packed));
+
+			}
+
+		}
+
+	}
+
+}  // namespace bgq_opengl
@@ -0,0 +1,118 @@
+/**
+ * @file vertex_packer.h
+ * @brief Vertex packer class header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_CLASSES_VERTEX_PACKER_H_
+#define BGQ_OPENGL_CLASSES_VERTEX_PACKER_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+#include "glm/glm.hpp"
+
+#include "structs/packed_vertex/packed_vertex.h"
+#include "structs/vertex/vertex.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Packs vertices into the compact layouts.
+	 *
+	 * Packs Vertex arrays into the layouts of VertexFormat before they are
+	 * uploaded, and decodes them back, as the vertex shader does, to check
+	 * how much they lose.
+	 *
+	 * @author Borja García Quiroga <garcaqub@tcd.ie>
+	 */
+	class VertexPacker {
+
+		public:
+
+			/**
+			 * @brief Decodes a packed vertex.
+			 *
+			 * Decodes a vertex the same way ltc.vert does. The color is not
+			 * in the packed vertex and comes out as black.
+			 *
+			 * @param bytes The packed vertex.
+			 * @param format Its layout, not VERTEX_FORMAT_FULL.
+			 *
+			 * @returns The vertex.
+			 */
+			static Vertex decode(const unsigned char* bytes, VertexFormat format);
+
+			/**
+			 * @brief Get the name of a layout.
+			 *
+			 * Get the name of a layout, as the --vertex-format option takes it.
+			 *
+			 * @param format The layout.
+			 *
+			 * @returns The name.
+			 */
+			static const char* getFormatName(VertexFormat format);
+
+			/**
+			 * @brief Get the size of a vertex.
+			 *
+			 * Get the bytes of one vertex in a layout.
+			 *
+			 * @param format The layout.
+			 *
+			 * @returns The stride of the vertex buffer.
+			 */
+			static size_t getStride(VertexFormat format);
+
+			/**
+			 * @brief Decodes an octahedral vector.
+			 *
+			 * Decodes a unit vector encoded with octEncode.
+			 *
+			 * @param encoded The two normalized shorts.
+			 *
+			 * @returns The unit vector.
+			 */
+			static glm::vec3 octDecode(const int16_t encoded[2]);
+
+			/**
+			 * @brief Encodes an octahedral vector.
+			 *
+			 * Encodes a vector in two normalized shorts, by projecting it on
+			 * an octahedron and unfolding it on a square. It does not have to
+			 * be normalized. A zero vector comes out as +Z.
+			 *
+			 * @param vector The vector.
+			 * @param encoded Outputs the two normalized shorts.
+			 */
+			static void octEncode(const glm::vec3& vector, int16_t encoded[2]);
+
+			/**
+			 * @brief Packs vertices.
+			 *
+			 * Packs some vertices into a layout.
+			 *
+			 * @param vertices The vertices.
+			 * @param count Number of vertices.
+			 * @param format The layout, not VERTEX_FORMAT_FULL.
+			 * @param bytes Outputs the packed vertices.
+			 */
+			static void pack(const Vertex* vertices, size_t count, VertexFormat format, std::vector<unsigned char>* bytes);
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_CLASSES_VERTEX_PACKER_H_
@@ -16,11 +16,17 @@
 #include "main.h"
 
 #include <math.h>
+#include <sys/resource.h>
 
 #include <algorithm>
 #include <chrono>
+#include <iomanip>
+#include <fstream>
 #include <iostream>
 #include <random>
+#include <string>
+#include <thread>
+#include <utility>
 #include <vector>
 
 #include "GL/glew.h"
@@ -33,242 +39,306 @@
 #include "glm/common.hpp"
 #include "glm/gtx/string_cast.hpp"
 
+#include "classes/asset_loader/asset_loader.h"
 #include "classes/camera/camera.h"
+#include "classes/json/json.h"
 #include "classes/light/light.h"
 #include "classes/object/object.h"
 #include "classes/shader/shader.h"
+#include "classes/software_renderer/software_renderer.h"
+#include "classes/frame_reader/frame_reader.h"
+#include "classes/frame_writer/frame_writer.h"
+#include "classes/ltc_accuracy/ltc_accuracy.h"
+#include "classes/ltc_file/ltc_file.h"
 #include "classes/ltc_matrix/ltc_matrix.h"
+#include "classes/sweep/sweep.h"
+#include "classes/timeline/timeline.h"
+#include "classes/ubo/ubo.h"
+#include "classes/vertex_packer/vertex_packer.h"
 #include "structs/bounding_box/bounding_box.h"
+#include "structs/frustum/frustum.h"
+#include "structs/frame/frame.h"
+#include "structs/image/image.h"
+#include "structs/instance_data/instance_data.h"
+#include "structs/scene_draw/scene_draw.h"
+#include "structs/sweep_point/sweep_point.h"
+#include "structs/light_block/light_block.h"
+#include "structs/material_block/material_block.h"
 
 void clean() {
+    
+    // Unmap the LTC tables, if they were still needed.
+    for (int i = 0; i < ltc_files.size(); i++)
+        ltc_files[i].remove();
+    
+    // Write the CPU zones, the rings of the threads that are gone included.
+    if (!cpu_trace_file.empty()) {
+        
+        if (bgq_opengl::CPUProfiler::writeTrace(cpu_trace_file))
+            std::cerr << "CPU trace written to " << cpu_trace_file << " (" << bgq_opengl::CPUProfiler::getDropped() << " zones dropped)" << std::endl;
+        else
+            std::cerr << "Error 121-1009 - Could not write the CPU trace to " << cpu_trace_file << "." << std::endl;
+        
+    }
+    
+    // The software renderer has nothing in OpenGL.
+    if (software) {
+        
+        delete software_renderer;
+        return;
+        
+    }
 
 	// Delete all the shaders.
-    shader_ltc->remove();
+    ltc_shaders->remove();
+    
+    // Delete the uniform buffers.
+    light_block->remove();
+    
+    for (int i = 0; i < materials_1.size(); i++)
+        materials_1[i].remove();
+    
+    for (int i = 0; i < materials_2.size(); i++)
+        materials_2[i].remove();
+    
+    if (gpu_profiler != NULL) {
+        
+        if (!gpu_profile_file.empty())
+            writeGPUProfile(gpu_profile_file);
+        
+        gpu_profiler->remove();
+        delete gpu_profiler;
+        
+    }
+    
+    for (int i = 0; i < pools_1.size(); i++) {
+        
+        pools_1[i]->remove();
+        delete pools_1[i];
+        
+    }
     
-    // Terminate ImGUI.
-    ImGui_ImplGlfwGL3_Shutdown();
+    for (int i = 0; i < pools_2.size(); i++) {
+        
+        pools_2[i]->remove();
+        delete pools_2[i];
+        
+    }
     
-    // Close GL context and any other GLFW resources.
-    glfwTerminate();
+    if (headless) {
+        
+        // Delete the framebuffer and close the offscreen context.
+        framebuffer->remove();
+        offscreen->remove();
+        
+    } else {
+        
+        // Terminate ImGUI.
+        ImGui_ImplGlfwGL3_Shutdown();
+        
+        // Close GL context and any other GLFW resources.
+        glfwTerminate();
+        
+    }
 
 }
 
 void clear() {
     
+    gpu_profiler->beginPass("Clear");
+    
     // Specify the color of the background
     glClearColor(background.x, background.y, background.z, background.w);
 
     // Clean the back buffer and depth buffer
     glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
     
+    gpu_profiler->endPass();
+    
 }
 
 void displayElements() {
     
-    if (selected_scene == 1) {
+    PROFILE_ZONE("displayElements");
+    
+    // Move the objects and get what to draw.
+    bgq_opengl::LightBlock light;
+    std::vector<bgq_opengl::SceneDraw> draws;
+    setupScene(&light, &draws);
+    
+    // The light is the same for every object, so upload it once per frame.
+    light_block->update(&light);
+    
+    std::vector<bgq_opengl::Object> &scene = selected_scene == 1 ? scene_1 : scene_2;
+    std::vector<bgq_opengl::UBO> &materials = selected_scene == 1 ? materials_1 : materials_2;
+    std::vector<bgq_opengl::GeometryPool*> &pools = selected_scene == 1 ? pools_1 : pools_2;
+    std::vector<int> &pool_indices = selected_scene == 1 ? pool_indices_1 : pool_indices_2;
+    std::vector<int> &pool_slots = selected_scene == 1 ? pool_slots_1 : pool_slots_2;
+    
+    bgq_opengl::Frustum frustum = camera->getFrustum();
+    cull_stats = bgq_opengl::Object::CullStats();
+    
+    // Textures bound for the draws queued in a pool, -1 if none yet, the permutation they are drawn with and the pool.
+    int batch_textures = -1;
+    bgq_opengl::Shader *batch_shader = NULL;
+    bgq_opengl::GeometryPool *batch_pool = NULL;
+    
+    // Every object is timed as a pass, and the pool as another one.
+    std::string pass_prefix = "Scene " + std::to_string(selected_scene) + " ";
+    std::string pool_pass = pass_prefix + "pool";
+    
+    for (size_t i = 0; i < draws.size(); i++) {
+        
+        int object = draws[i].object;
+        
+        // Skip the whole object, material and textures included, if none of it is in view. Instances are spread out, so they are not.
+        if (!draws[i].instanced && !bgq_opengl::intersects(frustum, scene[object].getWorldBoundingBox())) {
+            
+            cull_stats.tested += (unsigned int) scene[object].getNumOfGeometries();
+            cull_stats.culled += (unsigned int) scene[object].getNumOfGeometries();
+            continue;
+            
+        }
+        
+        // Draw it with the permutation of its material and path, so the fragments skip what it does not use.
+        bool pooled_draw = !pools.empty() && !draws[i].instanced && pool_indices[object] >= 0;
+        bgq_opengl::Shader &shader = ltc_shaders->get(getPermutation(draws[i].material, draws[i].instanced, pooled_draw));
         
-         // Get info from the model.
-         bgq_opengl::BoundingBox bb = scene_1[0].getBoundingBox();
-         glm::vec3 centre = (bb.min + bb.max) / 2.0f;
-         glm::vec3 size = bb.max - bb.min;
-         float max_dim = std::max(size.x, std::max(size.y, size.z));
-         float scale_rat = NORM_SIZE / max_dim * 0.75f;
-         
-         // Pass the parameters to the shaders.
-         shader_ltc->activate();
-         
-         for (int i = 0; i < scene_1.size(); i++) {
-             
-             // Rotate, center the object and get it in the right position, resize it to normalize it.
-             scene_1[i].resetTransforms();
-             scene_1[i].rotate(0.0, 1.0, 0.0, internal_time * 5.0);
-             scene_1[i].scale(scale_rat, scale_rat, scale_rat);
-             scene_1[i].translate(-centre.x, -centre.y, -centre.z);
-             
-         }
-         
-        // SPHERE
-
-        // Pass variables to the shaders.
-        shader_ltc->passFloat("mainLight.intensity", light_intensity);
-        shader_ltc->passVec("mainLight.color", glm::vec3(1.0f));
-        shader_ltc->passVec("mainLight.points[0]", glm::vec3(3.0f + 0.125, 3.0f + 0.4, 3.0f - 0.575));
-        shader_ltc->passVec("mainLight.points[1]", glm::vec3(3.0f + 0.575, 3.0f - 0.4, 3.0f - 0.175));
-        shader_ltc->passVec("mainLight.points[2]", glm::vec3(3.0f - 0.125, 3.0f - 0.4, 3.0f + 0.575));
-        shader_ltc->passVec("mainLight.points[3]", glm::vec3(3.0f - 0.575, 3.0f + 0.4, 3.0f + 0.175));
-        shader_ltc->passBool("useAlt", true);
-        shader_ltc->passVec("materialalt.diffuse", glm::vec3(0.2f));
-        shader_ltc->passVec("materialalt.normalmap", glm::vec3(0.0f, 0.0f, 1.0f));
-        shader_ltc->passVec("materialalt.specular", glm::vec3(0.3f));
-        shader_ltc->passFloat("materialalt.roughness", 0.01f);
-        shader_ltc->passFloat("alpha", alpha);
-        shader_ltc->passFloat("beta", beta);
-        shader_ltc->passFloat("Csheen", csheen);
-        shader_ltc->passInt("sheenType", sheenType);
-        shader_ltc->passBool("dust", false);
-
-        // Pass the LTC.
-        shader_ltc->passLTC(*ltc_1);
-        shader_ltc->passLTC(*ltc_2);
-        shader_ltc->passLTC(*ltc_sheen);
-
-        // Draw the object.
-        scene_1[1].draw(*shader_ltc, *camera);
-
-        // CLOTH
-
-        // Pass variables to the shaders.
-        shader_ltc->passFloat("mainLight.intensity", light_intensity);
-        shader_ltc->passVec("mainLight.color", glm::vec3(1.0f));
-        shader_ltc->passVec("mainLight.points[0]", glm::vec3(3.0f + 0.125, 3.0f + 0.4, 3.0f - 0.575));
-        shader_ltc->passVec("mainLight.points[1]", glm::vec3(3.0f + 0.575, 3.0f - 0.4, 3.0f - 0.175));
-        shader_ltc->passVec("mainLight.points[2]", glm::vec3(3.0f - 0.125, 3.0f - 0.4, 3.0f + 0.575));
-        shader_ltc->passVec("mainLight.points[3]", glm::vec3(3.0f - 0.575, 3.0f + 0.4, 3.0f + 0.175));
-        shader_ltc->passBool("useAlt", true);
-        shader_ltc->passVec("materialalt.diffuse", fabric_color);
-        shader_ltc->passVec("materialalt.normalmap", glm::vec3(0.0f, 0.0f, 1.0f));
-        shader_ltc->passVec("materialalt.specular", glm::vec3(fabric_specular));
-        shader_ltc->passFloat("materialalt.roughness", fabric_roughness);
-        shader_ltc->passFloat("material.roughness", fabric_roughness);
-        shader_ltc->passFloat("alpha", alpha);
-        shader_ltc->passFloat("beta", beta);
-        shader_ltc->passFloat("Csheen", csheen);
-        shader_ltc->passInt("sheenType", sheenType);
-        shader_ltc->passBool("dust", false);
-
         // Pass the LTC.
-        shader_ltc->passLTC(*ltc_1);
-        shader_ltc->passLTC(*ltc_2);
-        shader_ltc->passLTC(*ltc_sheen);
+        shader.passLTC(*ltc_1);
+        shader.passLTC(*ltc_2);
+        shader.passLTC(*ltc_sheen);
         
-        // Pass the textures.
-        // This one does not have any.
-
-        // Draw the object.
-        scene_1[0].draw(*shader_ltc, *camera);
+        if (pooled_draw) {
+            
+            bgq_opengl::GeometryPool *pool = pools[pool_indices[object]];
+            
+            // Every object shares the texture slots, so the draws queued so far go before others are bound.
+            bool textures_changed = draws[i].textures >= 0 && draws[i].textures != batch_textures;
+            
+            // A batch is drawn from a single pool with a single permutation too.
+            if (batch_pool != NULL && ((textures_changed && batch_textures >= 0) || batch_shader != &shader || batch_pool != pool))
+                submitPool(batch_pool, *batch_shader, pool_pass);
+            
+            if (textures_changed) {
+                
+                shader.passTexture(textures[draws[i].textures]);
+                shader.passTexture(textures[draws[i].textures + 1]);
+                shader.passTexture(textures[draws[i].textures + 2]);
+                batch_textures = draws[i].textures;
+                
+            }
+            
+            batch_shader = &shader;
+            batch_pool = pool;
+            
+            // Queue the geometries in view, with the matrix and material of each in the draw block.
+            bgq_opengl::Object &pooled = scene[object];
+            
+            for (int j = 0; j < (int) pooled.getNumOfGeometries(); j++) {
+                
+                cull_stats.tested++;
+                
+                if (!bgq_opengl::intersects(frustum, pooled.getGeometry(j).getWorldBoundingBox())) {
+                    
+                    cull_stats.culled++;
+                    continue;
+                    
+                }
+                
+                pool->queue(pool_slots[object] + j, pooled.getTransformMat(j), draws[i].material);
+                
+            }
+            
+            continue;
+            
+        }
         
-    } else if (selected_scene == 2) {
+        // The rest are drawn on their own, so what was queued goes first.
+        if (batch_pool != NULL) {
+            
+            submitPool(batch_pool, *batch_shader, pool_pass);
+            batch_textures = -1;
+            
+        }
         
-        // Get info from the model.
-        bgq_opengl::BoundingBox bb = scene_2[1].getBoundingBox();
-        glm::vec3 centre = (bb.min + bb.max) / 2.0f;
-        glm::vec3 size = bb.max - bb.min;
-        float max_dim = std::max(size.x, std::max(size.y, size.z));
-        float scale_rat = NORM_SIZE / max_dim;
+        gpu_profiler->beginPass(pass_prefix + "object " + std::to_string(object));
         
-        // Pass the parameters to the shaders.
-        shader_ltc->activate();
+        // Update the material. It is only uploaded if something changed.
+        materials[object].update(&draws[i].material);
+        materials[object].bind();
         
-        for (int i = 0; i < scene_2.size(); i++) {
+        // Pass the textures, if the object has any.
+        if (draws[i].textures >= 0) {
             
-            // Rotate, center the object and get it in the right position, resize it to normalize it.
-            scene_2[i].resetTransforms();
-            scene_2[i].rotate(0.0, 1.0, 0.0, internal_time * 5.0);
-            scene_2[i].scale(scale_rat, scale_rat, scale_rat);
-            scene_2[i].translate(-centre.x, -centre.y, -centre.z);
+            shader.passTexture(textures[draws[i].textures]);
+            shader.passTexture(textures[draws[i].textures + 1]);
+            shader.passTexture(textures[draws[i].textures + 2]);
             
         }
         
-        // FABRIC
+        // Draw the object. It culls its own geometries, else all the instances go in one call per geometry.
+        if (draws[i].instanced)
+            scene[object].drawInstanced(shader, *camera);
+        else
+            scene[object].draw(shader, *camera);
         
-        // Pass variables to the shaders.
-        shader_ltc->passFloat("mainLight.intensity", light_intensity);
-        shader_ltc->passVec("mainLight.color", glm::vec3(1.0f));
-        shader_ltc->passVec("mainLight.points[0]", glm::vec3(3.0f + 0.125, 3.0f + 0.4, 3.0f - 0.575));
-        shader_ltc->passVec("mainLight.points[1]", glm::vec3(3.0f + 0.575, 3.0f - 0.4, 3.0f - 0.175));
-        shader_ltc->passVec("mainLight.points[2]", glm::vec3(3.0f - 0.125, 3.0f - 0.4, 3.0f + 0.575));
-        shader_ltc->passVec("mainLight.points[3]", glm::vec3(3.0f - 0.575, 3.0f + 0.4, 3.0f + 0.175));
-        shader_ltc->passBool("useAlt", true);
-        shader_ltc->passVec("materialalt.diffuse", fabric_color);
-        shader_ltc->passVec("materialalt.normalmap", glm::vec3(0.0f, 0.0f, 1.0f));
-        shader_ltc->passVec("materialalt.specular", glm::vec3(fabric_specular));
-        shader_ltc->passFloat("materialalt.roughness", fabric_roughness);
-        shader_ltc->passFloat("material.roughness", fabric_roughness);
-        shader_ltc->passFloat("alpha", alpha);
-        shader_ltc->passFloat("beta", beta);
-        shader_ltc->passFloat("Csheen", csheen);
-        shader_ltc->passInt("sheenType", sheenType);
-        shader_ltc->passBool("dust", false);
-
-        // Pass the LTC.
-        shader_ltc->passLTC(*ltc_1);
-        shader_ltc->passLTC(*ltc_2);
-        shader_ltc->passLTC(*ltc_sheen);
+        gpu_profiler->endPass();
         
-        // Pass the textures.
-        // This one does not have any.
-
-        // Draw the object.
-        scene_2[0].draw(*shader_ltc, *camera);
+        cull_stats.tested += scene[object].getCullStats().tested;
+        cull_stats.culled += scene[object].getCullStats().culled;
         
-        // TABLE
+    }
+    
+    // Draw what is left in the pool in one call.
+    if (batch_pool != NULL)
+        submitPool(batch_pool, *batch_shader, pool_pass);
         
-        // Pass variables to the shaders.
-        shader_ltc->passFloat("mainLight.intensity", light_intensity);
-        shader_ltc->passVec("mainLight.color", glm::vec3(1.0f));
-        shader_ltc->passVec("mainLight.points[0]", glm::vec3(3.0f + 0.125, 3.0f + 0.4, 3.0f - 0.575));
-        shader_ltc->passVec("mainLight.points[1]", glm::vec3(3.0f + 0.575, 3.0f - 0.4, 3.0f - 0.175));
-        shader_ltc->passVec("mainLight.points[2]", glm::vec3(3.0f - 0.125, 3.0f - 0.4, 3.0f + 0.575));
-        shader_ltc->passVec("mainLight.points[3]", glm::vec3(3.0f - 0.575, 3.0f + 0.4, 3.0f + 0.175));
-        shader_ltc->passBool("useAlt", false);
-        shader_ltc->passFloat("material.roughness", 0.4f);
-        shader_ltc->passFloat("material.specular_mult", 0.3f);
-        shader_ltc->passFloat("alpha", alpha);
-        shader_ltc->passFloat("beta", beta);
-        shader_ltc->passFloat("Csheen", csheen);
-        shader_ltc->passInt("sheenType", sheenType);
-        shader_ltc->passBool("dust", false);
+}
 
-        // Pass the LTC.
-        shader_ltc->passLTC(*ltc_1);
-        shader_ltc->passLTC(*ltc_2);
-        shader_ltc->passLTC(*ltc_sheen);
+void displaySoftware() {
+    
+    // Move the objects and get what to draw, exactly as the GL path does.
+    bgq_opengl::LightBlock light;
+    std::vector<bgq_opengl::SceneDraw> draws;
+    setupScene(&light, &draws);
+    
+    std::vector<bgq_opengl::Object> &scene = selected_scene == 1 ? scene_1 : scene_2;
+    
+    software_renderer->clear(background);
+    
+    for (size_t i = 0; i < draws.size(); i++) {
         
-        // Pass the textures.
-        shader_ltc->passTexture(textures[0]);
-        shader_ltc->passTexture(textures[1]);
-        shader_ltc->passTexture(textures[2]);
-
-        // Draw the object.
-        scene_2[1].draw(*shader_ltc, *camera);
+        bgq_opengl::Object &object = scene[draws[i].object];
         
-        // SEWING MACHINE
+        // Get the CPU copies of the textures, if the object has any.
+        const bgq_opengl::Image *diffuse = NULL;
+        const bgq_opengl::Image *normalmap = NULL;
+        const bgq_opengl::Image *specular = NULL;
         
-        // Pass variables to the shaders.
-        shader_ltc->passFloat("mainLight.intensity", light_intensity);
-        shader_ltc->passVec("mainLight.color", glm::vec3(1.0f));
-        shader_ltc->passVec("mainLight.points[0]", glm::vec3(3.0f + 0.125, 3.0f + 0.4, 3.0f - 0.575));
-        shader_ltc->passVec("mainLight.points[1]", glm::vec3(3.0f + 0.575, 3.0f - 0.4, 3.0f - 0.175));
-        shader_ltc->passVec("mainLight.points[2]", glm::vec3(3.0f - 0.125, 3.0f - 0.4, 3.0f + 0.575));
-        shader_ltc->passVec("mainLight.points[3]", glm::vec3(3.0f - 0.575, 3.0f + 0.4, 3.0f + 0.175));
-        shader_ltc->passBool("useAlt", false);
-        shader_ltc->passFloat("material.roughness", 0.01f);
-        shader_ltc->passFloat("material.specular_mult", 0.2f);
-        shader_ltc->passFloat("alpha", alpha);
-        shader_ltc->passFloat("beta", beta);
-        shader_ltc->passFloat("Csheen", csheen);
-        shader_ltc->passInt("sheenType", sheenType);
-        shader_ltc->passBool("dust", true);
-
-        // Pass the LTC.
-        shader_ltc->passLTC(*ltc_1);
-        shader_ltc->passLTC(*ltc_2);
-        shader_ltc->passLTC(*ltc_sheen);
+        if (draws[i].textures >= 0) {
+            
+            diffuse = &images[draws[i].textures];
+            normalmap = &images[draws[i].textures + 1];
+            specular = &images[draws[i].textures + 2];
+            
+        }
         
-        // Pass the textures.
-        shader_ltc->passTexture(textures[3]);
-        shader_ltc->passTexture(textures[4]);
-        shader_ltc->passTexture(textures[5]);
-
-        // Draw the object.
-        scene_2[2].draw(*shader_ltc, *camera);
+        // Queue every mesh of the object.
+        for (size_t j = 0; j < object.getNumOfGeometries(); j++)
+            software_renderer->draw(object.getGeometry((int) j), draws[i].material, diffuse, normalmap, specular);
         
     }
-        
+    
+    // Rasterize and shade everything on the CPU.
+    software_renderer->render(camera->getView(), camera->getProjection(), camera->getPosition(), light);
+    
 }
 
 void displayGUI() {
     
+    PROFILE_ZONE("displayGUI");
+    
     // Init ImGUI for rendering.
     ImGui_ImplGlfwGL3_NewFrame();
     
@@ -296,14 +366,55 @@ void displayGUI() {
     ImGui::SliderFloat("Alpha", &alpha, 0.0f, 1.0f);
     ImGui::SliderFloat("Beta", &beta, -10.0f, 10.0f);
     ImGui::SliderFloat("CSheen", &csheen, 0.0f, 20.0f);
-    ImGui::RadioButton("Zeltner", &sheenType, 1);
-    ImGui::RadioButton("Cosine-based", &sheenType, 2);
-    ImGui::RadioButton("None", &sheenType, 0);
+    bool sheen_changed = ImGui::RadioButton("Zeltner", &sheenType, 1);
+    sheen_changed |= ImGui::RadioButton("Cosine-based", &sheenType, 2);
+    sheen_changed |= ImGui::RadioButton("None", &sheenType, 0);
 
     ImGui::End();
     
+    // The samples of one sheen are not mixed with the next, so they can be compared.
+    // This frame already issued its queries, so they are forgotten before the next one.
+    if (sheen_changed)
+        gpu_profile_reset = true;
+    
+    // Show the GPU time of every pass.
+    ImGui::Begin("GPU profile");
+    
+    std::vector<bgq_opengl::GPUProfiler::PassStats> passes = gpu_profiler->getStats();
+    
+    ImGui::Text("%-20s %8s %8s %8s", "Pass (ms)", "min", "avg", "p99");
+    
+    for (size_t i = 0; i < passes.size(); i++)
+        ImGui::Text("%-20s %8.3f %8.3f %8.3f", passes[i].name.c_str(), passes[i].min, passes[i].avg, passes[i].p99);
+    
+    ImGui::Text("%zu samples, %u frames dropped", passes.back().samples, gpu_profiler->getDropped());
+    
+    // The files are named after the sheen, so that both can be exported side by side.
+    std::string sheen_name = sheenType == 1 ? "zeltner" : sheenType == 2 ? "cosine" : "none";
+    std::string profile_name = output_dir + "/gpu-profile-" + sheen_name;
+    
+    if (ImGui::Button("Export CSV"))
+        writeGPUProfile(profile_name + ".csv");
+    
+    ImGui::SameLine();
+    
+    if (ImGui::Button("Export JSON"))
+        writeGPUProfile(profile_name + ".json");
+    
+    ImGui::SameLine();
+    
+    if (ImGui::Button("Reset"))
+        gpu_profile_reset = true;
+    
+    ImGui::End();
+    
     // Render ImGUI.
+    gpu_profiler->beginPass("GUI");
     ImGui::Render();
+    gpu_profiler->endPass();
+    
+    // ImGUI binds its own program, VAO and font texture behind the state cache.
+    bgq_opengl::GLState::invalidate();
     
 }
 
@@ -393,36 +504,239 @@ void handleKeyEvents() {
 
 void initElements() {
     
-    // Init the shader.
-    shader_ltc = new bgq_opengl::Shader("ltc.vert", "ltc.frag");
+    PROFILE_ZONE("initElements");
+    
+    // Init the shaders. The permutations are compiled as the materials need them, or loaded from their binaries.
+    if (!software) {
+        
+        bgq_opengl::ProgramCache::setEnabled(shader_cache);
+        ltc_shaders = new bgq_opengl::ShaderPermutations("ltc.vert", "ltc.frag", ltc_features);
+        
+    }
     
 	// Creates the first camera object
-    camera = new bgq_opengl::Camera(glm::vec3(0.0f, 0.5f, 1.4f), glm::vec3(0.0f, -0.25f, -1.0f), 45.0f, 0.1f, 300.0f, WINDOW_WIDTH, WINDOW_HEIGHT);
+    camera = new bgq_opengl::Camera(camera_start, glm::vec3(0.0f, -0.25f, -1.0f), 45.0f, 0.1f, 300.0f, WINDOW_WIDTH, WINDOW_HEIGHT);
+    
+    // Map the LTC tables and upload them straight from the files.
+    ltc_files.push_back(bgq_opengl::LTCFile("ltc_1.ltc"));
+    ltc_files.push_back(bgq_opengl::LTCFile("ltc_2.ltc"));
+    ltc_files.push_back(bgq_opengl::LTCFile("ltc_sheen.ltc"));
     
-    // Load the LTC matrixes.
-    ltc_1 = new bgq_opengl::LTCMatrix(1, "LTC1", 1);
-    ltc_2 = new bgq_opengl::LTCMatrix(2, "LTC2", 2);
-    ltc_sheen = new bgq_opengl::LTCMatrix(3, "SHEENCOEFFS", 3);
+    if (software) {
+        
+        // The software renderer reads the tables from the mappings for as long as it lives.
+        bgq_opengl::LTCReference reference(ltc_files[0].getTable(), ltc_files[1].getTable(), ltc_files[2].getTable());
+        software_renderer = new bgq_opengl::SoftwareRenderer(WINDOW_WIDTH, WINDOW_HEIGHT, SOFTWARE_TILE_SIZE, render_threads, reference);
+        
+        std::cerr << "Software renderer: " << software_renderer->getThreads() << " threads, " << bgq_opengl::LTCReference::getInstructionSet() << std::endl;
+        
+    } else {
+        
+        ltc_1 = new bgq_opengl::LTCMatrix(ltc_files[0].getTable(), "LTC1", 1, ltc_formats[0]);
+        ltc_2 = new bgq_opengl::LTCMatrix(ltc_files[1].getTable(), "LTC2", 2, ltc_formats[1]);
+        ltc_sheen = new bgq_opengl::LTCMatrix(ltc_files[2].getTable(), "SHEENCOEFFS", 3, ltc_formats[2]);
+        
+        // The GPU has its own copy now.
+        for (int i = 0; i < ltc_files.size(); i++)
+            ltc_files[i].remove();
+        
+    }
+
+    // Decode the textures and import the objects on the loader threads, then upload them here.
+    // Only the software renderer and the pools read the vertices after uploading them, else the CPU copies are not kept.
+    // The software renderer only reads the CPU copies, so nothing is uploaded for it.
+    bgq_opengl::AssetLoader assets(load_threads, vertex_format, software || multi_draw, !software);
+    
+    std::cerr << "Vertex format: " << bgq_opengl::VertexPacker::getFormatName(vertex_format) << ", " << bgq_opengl::VertexPacker::getStride(vertex_format) << " bytes per vertex" << std::endl;
+    
+    assets.addTexture("table_basecolor.png", "material.diffuse", 4, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR);
+    assets.addTexture("table_normal.png", "material.normalmap", 5, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR);
+    assets.addTexture("table_specular.png", "material.specular", 6, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR);
+    assets.addTexture("machine_basecolor.png", "material.diffuse", 4, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR);
+    assets.addTexture("machine_normal.png", "material.normalmap", 5, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR);
+    assets.addTexture("machine_specular.png", "material.specular", 6, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR);
+    
+    assets.addModel("cloth.glb");
+    assets.addModel("sphere.glb");
+    assets.addModel("fabric_front.glb");
+    assets.addModel("table.glb");
+    assets.addModel("sewing.glb");
+    
+    assets.load();
+    
+    // The software renderer samples its own copies of the decoded images, in the same order as the textures.
+    for (int i = 0; i < 6; i++) {
+        
+        if (software)
+            images.push_back(assets.getImage(i));
+        else
+            textures.push_back(assets.getTexture(i));
+        
+    }
+    
+    // The objects are moved out of the loader, so their buffers are not copied.
+    scene_1.push_back(std::move(assets.getObject(0)));
+    scene_1.push_back(std::move(assets.getObject(1)));
 
-    // Load the textures.
-    textures.push_back(bgq_opengl::Texture("table_basecolor.png", "material.diffuse", 4, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR));
-    textures.push_back(bgq_opengl::Texture("table_normal.png", "material.normalmap", 5, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR));
-    textures.push_back(bgq_opengl::Texture("table_specular.png", "material.specular", 6, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR));
-    textures.push_back(bgq_opengl::Texture("machine_basecolor.png", "material.diffuse", 4, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR));
-    textures.push_back(bgq_opengl::Texture("machine_normal.png", "material.normalmap", 5, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR));
-    textures.push_back(bgq_opengl::Texture("machine_specular.png", "material.specular", 6, GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR_MIPMAP_LINEAR));
+    scene_2.push_back(std::move(assets.getObject(2)));
+    scene_2.push_back(std::move(assets.getObject(3)));
+    scene_2.push_back(std::move(assets.getObject(4)));
+    
+    // The rest is only for OpenGL.
+    if (software)
+        return;
+
+    // Point the samplers to their slots once, the passes only bind the textures.
+    ltc_shaders->bindSampler(ltc_1->getName(), ltc_1->getSlot());
+    ltc_shaders->bindSampler(ltc_2->getName(), ltc_2->getSlot());
+    ltc_shaders->bindSampler(ltc_sheen->getName(), ltc_sheen->getSlot());
+    
+    for (int i = 0; i < textures.size(); i++)
+        ltc_shaders->bindSampler(textures[i].getName(), textures[i].getSlot());
+    
+    // Create the uniform buffers for the light and one for each material.
+    light_block = new bgq_opengl::UBO(sizeof(bgq_opengl::LightBlock), LIGHT_BINDING);
+    
+    for (int i = 0; i < scene_1.size(); i++)
+        materials_1.push_back(bgq_opengl::UBO(sizeof(bgq_opengl::MaterialBlock), MATERIAL_BINDING));
+    
+    for (int i = 0; i < scene_2.size(); i++)
+        materials_2.push_back(bgq_opengl::UBO(sizeof(bgq_opengl::MaterialBlock), MATERIAL_BINDING));
+    
+    // Tell the shader where the blocks are. The light never moves from its binding point.
+    ltc_shaders->bindUniformBlock("LightBlock", LIGHT_BINDING);
+    ltc_shaders->bindUniformBlock("MaterialBlock", MATERIAL_BINDING);
+    ltc_shaders->bindUniformBlock("DrawBlock", DRAW_BINDING);
+    light_block->bind();
+    
+    if (multi_draw) {
+        
+        setupPools(scene_1, &pools_1, &pool_indices_1, &pool_slots_1);
+        setupPools(scene_2, &pools_2, &pool_indices_2, &pool_slots_2);
+        
+        size_t pooled_geometries = 0;
+        size_t pooled_vertices = 0;
+        
+        for (int i = 0; i < pools_1.size(); i++) {
+            
+            pooled_geometries += pools_1[i]->getSize();
+            pooled_vertices += pools_1[i]->getVertexCount();
+            
+        }
+        
+        for (int i = 0; i < pools_2.size(); i++) {
+            
+            pooled_geometries += pools_2[i]->getSize();
+            pooled_vertices += pools_2[i]->getVertexCount();
+            
+        }
+        
+        std::cerr << "Geometry pools: " << pools_1.size() + pools_2.size() << " pools, " << pooled_geometries << " geometries, " << pooled_vertices << " vertices, " << (bgq_opengl::GeometryPool::hasIndirect() ? "indirect draws" : "multi-draws with base vertices") << std::endl;
+        
+        // The pools have their own copies now.
+        for (int i = 0; i < scene_1.size(); i++)
+            scene_1[i].releaseVertices();
+        
+        for (int i = 0; i < scene_2.size(); i++)
+            scene_2[i].releaseVertices();
+        
+    }
+    
+    // Compile every permutation the materials can ask for now, so switching the sheen does not stall a frame.
+    // Without pools every object is drawn on its own, else only the ones left out of them.
+    bool unpooled = !multi_draw;
+    
+    for (int i = 0; i < pool_indices_1.size(); i++)
+        unpooled = unpooled || pool_indices_1[i] < 0;
+    
+    for (int i = 0; i < pool_indices_2.size(); i++)
+        unpooled = unpooled || pool_indices_2[i] < 0;
+    
+    bgq_opengl::MaterialBlock material;
+    
+    for (int use_alt = 0; use_alt <= 1; use_alt++) {
+        for (int dust = 0; dust <= 1; dust++) {
+            for (int sheen_type = 0; sheen_type <= 2; sheen_type++) {
+                
+                material.use_alt = use_alt;
+                material.dust = dust;
+                material.sheen_type = sheen_type;
+                
+                // Only the cloth has instances.
+                if (multi_draw)
+                    ltc_shaders->get(getPermutation(material, false, true));
+                
+                if (unpooled)
+                    ltc_shaders->get(getPermutation(material, false, false));
+                
+                if (swatches > 0)
+                    ltc_shaders->get(getPermutation(material, true, false));
+                
+            }
+        }
+    }
+    
+    std::cerr << "Shader permutations: " << ltc_shaders->getCount() << (uber_shader ? " (uber shader)" : "") << std::endl;
+    
+    // A warm start loads every program from the cache, a cold one compiles them all.
+    bgq_opengl::ProgramCache::Stats shader_stats = bgq_opengl::ProgramCache::getStats();
+    std::string start = shader_stats.compiled == 0 ? "warm" : shader_stats.loaded == 0 ? "cold" : "partly warm";
+    
+    std::cerr << "Shader programs: " << shader_stats.loaded << " loaded in " << shader_stats.load_ms << " ms, " << shader_stats.compiled << " compiled in " << shader_stats.compile_ms << " ms, " << start << " start";
+    
+    if (!bgq_opengl::ProgramCache::isEnabled())
+        std::cerr << " without the program cache";
+    else if (shader_stats.rejected > 0)
+        std::cerr << ", " << shader_stats.rejected << " cached binaries rejected";
+    
+    std::cerr << std::endl;
+    
+    // Time the passes of the GPU.
+    gpu_profiler = new bgq_opengl::GPUProfiler(PROFILER_RING_SIZE, bench ? std::max(PROFILER_HISTORY, headless_frames) : PROFILER_HISTORY);
+    
+    if (swatches > 0)
+        setupSwatches();
 
-    // Load the objects.
-    scene_1.push_back(bgq_opengl::Object("cloth.glb", "Assimp"));
-    scene_1.push_back(bgq_opengl::Object("sphere.glb", "Assimp"));
+}
 
-    scene_2.push_back(bgq_opengl::Object("fabric_front.glb", "Assimp"));
-    scene_2.push_back(bgq_opengl::Object("table.glb", "Assimp"));
-    scene_2.push_back(bgq_opengl::Object("sewing.glb", "Assimp"));
+void initEnvironment() {
+    
+    // The software renderer is created with the LTC tables and needs no OpenGL, so it runs where there is no driver at all.
+    if (software) {
+        
+        std::cerr << "Renderer: software, without an OpenGL context" << std::endl;
+        return;
+        
+    }
+    
+    if (headless) {
+        
+        // Create a context without a window. It still loads the meshes, textures and shaders.
+        offscreen = new bgq_opengl::OffscreenContext();
+        
+        std::cerr << "Headless context: " << (offscreen->isSurfaceless() ? "surfaceless EGL" : "hidden window") << std::endl;
+        
+        // Render to a framebuffer.
+        framebuffer = new bgq_opengl::Framebuffer(WINDOW_WIDTH, WINDOW_HEIGHT);
+        
+    } else {
+        
+        initWindow();
+        
+    }
+    
+    // Get version info.
+    std::cerr << "Renderer: " << glGetString(GL_RENDERER) << std::endl;
+    std::cerr << "OpenGL version supported " << glGetString(GL_VERSION) << std::endl;
+    std::cerr << "GLSL version supported " << (char *) glGetString(GL_SHADING_LANGUAGE_VERSION) << std::endl;
 
+    // tell GL to only draw onto a pixel if the shape is closer to the viewer
+    glEnable(GL_DEPTH_TEST); // enable depth-testing
+    glDepthFunc(GL_LESS); // depth-testing interprets a smaller value as "closer"
+    
 }
 
-void initEnvironment(int argc, char** argv) {
+void initWindow() {
     
     // start GL context and O/S window using the GLFW helper library
     if (!glfwInit()) {
@@ -460,81 +774,1034 @@ void initEnvironment(int argc, char** argv) {
 
     }
     
-    // Get version info.
-    std::cerr << "Renderer: " << glGetString(GL_RENDERER) << std::endl;
-    std::cerr << "OpenGL version supported " << glGetString(GL_VERSION) << std::endl;
-    std::cerr << "GLSL version supported " << (char *) glGetString(GL_SHADING_LANGUAGE_VERSION) << std::endl;
-    
     // Setup ImGui binding
     ImGui_ImplGlfwGL3_Init(window, true);
-
-    // tell GL to only draw onto a pixel if the shape is closer to the viewer
-    glEnable(GL_DEPTH_TEST); // enable depth-testing
-    glDepthFunc(GL_LESS); // depth-testing interprets a smaller value as "closer"
     
 }
 
-int main(int argc, char** argv) {
-
-	// Initialise the environment.
-    initEnvironment(argc, argv);
+void parseArguments(int argc, char** argv) {
     
-	// Initialise the objects and elements.
-	initElements();
-
-	// Main loop.
-    while(!glfwWindowShouldClose(window)) {
+    for (int i = 1; i < argc; i++) {
         
-        // Clear the scene.
-        clear();
-        
-        // Get the window size.
-        int width, height;
-        glfwGetWindowSize(window, &width, &height);
-        camera->setWidth(width);
-        camera->setHeight(height);
+        std::string option = argv[i];
         
-        // Get the current time.
-        internal_time = glfwGetTime();
+        // Options that take a value need one more argument.
+        bool has_value = i + 1 < argc;
         
-        // If the loop has been restarted, set the starting time.
-        if (fps_counted == 0) {
+        if (option == "--headless") {
             
-            fps_time = internal_time;
+            headless = true;
             
-        }
-
-        // Handle key events.
-        handleKeyEvents();
-        
-        // Display the scene.
-        displayElements();
-        
-        // Make the things to print everything.
-        displayGUI();
-        
-        // Increment the FPS count in one.
-        fps_counted++;
-        
-        if (fps_counted >= FPS_STEP) {
+        } else if (option == "--frames" && has_value) {
             
-            // Get the elapsed time.
-            double fps_elapsed_time = internal_time - fps_time;
+            headless_frames = std::max(1, atoi(argv[++i]));
             
-            // Calculate the fps.
-            fps = fps_counted / fps_elapsed_time;
+        } else if (option == "--output" && has_value) {
             
-            // Restart the loop.
-            fps_counted = 0;
+            output_dir = argv[++i];
             
-            // Print it.
-            std::cout << "FPS: " << fps << std::endl;
+        } else if (option == "--scene" && has_value) {
             
-        }
-        
+            selected_scene = atoi(argv[++i]) == 2 ? 2 : 1;
+            
+        } else if (option == "--sweep" && has_value) {
+            
+            // Sweeps are always rendered offscreen.
+            sweep_file = argv[++i];
+            headless = true;
+            
+        } else if (option == "--threads" && has_value) {
+            
+            writer_threads = std::max(0, atoi(argv[++i]));
+            
+        } else if (option == "--software") {
+            
+            // The software renderer only writes frames.
+            software = true;
+            headless = true;
+            
+        } else if (option == "--render-threads" && has_value) {
+            
+            render_threads = std::max(0, atoi(argv[++i]));
+            
+        } else if (option == "--load-threads" && has_value) {
+            
+            load_threads = std::max(0, atoi(argv[++i]));
+            
+        } else if (option == "--benchmark") {
+            
+            benchmark = true;
+            software = true;
+            headless = true;
+            
+        } else if (option == "--bench") {
+            
+            // The bench never opens a window, on the GPU unless --software is there too.
+            bench = true;
+            headless = true;
+            
+        } else if (option == "--bench-path" && has_value) {
+            
+            bench_path = argv[++i];
+            
+        } else if (option == "--bench-output" && has_value) {
+            
+            bench_output = argv[++i];
+            
+        } else if (option == "--ltc-format" && has_value) {
+            
+            std::string format = argv[++i];
+            
+            // Full floats, or halves. LTCMatrix also takes RGB10_A2 and RGBA8, but only --ltc-report uses them: the
+            // 2-bit alpha of RGB10_A2 has four levels for the sphere clipping scale of LTC2, and RGBA8 clamps the negative entries.
+            if (format == "float") {
+                
+                ltc_formats[0] = GL_RGBA32F;
+                ltc_formats[1] = GL_RGBA32F;
+                ltc_formats[2] = GL_RGB32F;
+                
+            } else if (format == "half") {
+                
+                ltc_formats[0] = GL_RGBA16F;
+                ltc_formats[1] = GL_RGBA16F;
+                ltc_formats[2] = GL_RGB16F;
+                
+            } else {
+                
+                std::cerr << "Error 121-1005 - Unknown LTC format " << format << "." << std::endl;
+                exit(1);
+                
+            }
+            
+        } else if (option == "--vertex-format" && has_value) {
+            
+            std::string format = argv[++i];
+            
+            // Full keeps the vertices as they are, the others pack them.
+            if (format == "full") {
+                
+                vertex_format = bgq_opengl::VERTEX_FORMAT_FULL;
+                
+            } else if (format == "half") {
+                
+                vertex_format = bgq_opengl::VERTEX_FORMAT_HALF;
+                
+            } else if (format == "float") {
+                
+                vertex_format = bgq_opengl::VERTEX_FORMAT_FLOAT;
+                
+            } else {
+                
+                std::cerr << "Error 121-1006 - Unknown vertex format " << format << "." << std::endl;
+                exit(1);
+                
+            }
+            
+        } else if (option == "--swatches" && has_value) {
+            
+            swatches = std::max(0, atoi(argv[++i]));
+            
+        } else if (option == "--multi-draw") {
+            
+            multi_draw = true;
+            
+        } else if (option == "--gpu-profile" && has_value) {
+            
+            gpu_profile_file = argv[++i];
+            
+        } else if (option == "--cpu-trace" && has_value) {
+            
+            cpu_trace_file = argv[++i];
+            
+        } else if (option == "--uber-shader") {
+            
+            uber_shader = true;
+            
+        } else if (option == "--no-shader-cache") {
+            
+            shader_cache = false;
+            
+        } else if (option == "--ltc-report") {
+            
+            ltc_report = true;
+            
+        } else {
+            
+            std::cerr << "Error 121-1003 - Unknown option " << option << "." << std::endl;
+            std::cerr << "Usage: " << argv[0] << " [--headless] [--frames <n>] [--output <folder>] [--scene <1|2>] [--sweep <spec>] [--threads <n>] [--software] [--render-threads <n>] [--load-threads <n>] [--benchmark] [--bench] [--bench-path <timeline>] [--bench-output <file.json>] [--ltc-format <float|half>] [--vertex-format <full|half|float>] [--swatches <n>] [--multi-draw] [--gpu-profile <file.csv|file.json>] [--cpu-trace <file.json>] [--uber-shader] [--no-shader-cache] [--ltc-report]" << std::endl;
+            exit(1);
+            
+        }
+        
+    }
+    
+    // Without --frames, the bench replays a long path, the benchmark times a few frames and the rest render one.
+    if (headless_frames == 0)
+        headless_frames = bench ? BENCH_FRAMES : benchmark ? BENCHMARK_FRAMES : 1;
+    
+    // By default, leave one core to the render loop and encode on the rest.
+    if (writer_threads == 0)
+        writer_threads = std::max(1, (int) std::thread::hardware_concurrency() - 1);
+    
+}
+
+void drainFrames(bgq_opengl::FrameReader &reader, bgq_opengl::FrameWriter &writer) {
+    
+    bgq_opengl::Frame frame;
+    
+    // Waiting, every frame in flight is collected or the reader stops the program.
+    while (reader.getPending() > 0)
+        if (reader.collect(&frame, true))
+            writer.push(std::move(frame));
+    
+}
+
+void queueFrame(bgq_opengl::FrameReader &reader, bgq_opengl::FrameWriter &writer, const std::string &filename) {
+    
+    bgq_opengl::Frame frame;
+    
+    // Free the oldest buffer if they are all in flight.
+    if (reader.isFull() && reader.collect(&frame, true))
+        writer.push(std::move(frame));
+    
+    reader.request(filename);
+    
+    // Hand over whatever is ready without waiting.
+    while (reader.collect(&frame, false))
+        writer.push(std::move(frame));
+    
+}
+
+void reportLTCFormats() {
+    
+    // Map the tables. Nothing is uploaded, so no context is needed.
+    bgq_opengl::LTCFile file_1("ltc_1.ltc");
+    bgq_opengl::LTCFile file_2("ltc_2.ltc");
+    bgq_opengl::LTCFile file_sheen("ltc_sheen.ltc");
+    
+    bgq_opengl::LightBlock light;
+    setupLight(&light);
+    
+    bgq_opengl::LTCAccuracy accuracy(file_1.getTable(), file_2.getTable(), file_sheen.getTable(), light, camera_start);
+    
+    // Every table on its own first, then whole sets. RGBA8 is what the old unsized uploads got on most drivers.
+    const GLenum candidates[][3] = {
+        {GL_RGBA32F, GL_RGBA32F, GL_RGB32F},
+        {GL_RGBA16F, GL_RGBA32F, GL_RGB32F},
+        {GL_RGB10_A2, GL_RGBA32F, GL_RGB32F},
+        {GL_RGBA8, GL_RGBA32F, GL_RGB32F},
+        {GL_RGBA32F, GL_RGBA16F, GL_RGB32F},
+        {GL_RGBA32F, GL_RGB10_A2, GL_RGB32F},
+        {GL_RGBA32F, GL_RGBA8, GL_RGB32F},
+        {GL_RGBA32F, GL_RGBA32F, GL_RGB16F},
+        {GL_RGBA32F, GL_RGBA32F, GL_RGB10_A2},
+        {GL_RGBA32F, GL_RGBA32F, GL_RGBA8},
+        {GL_RGBA16F, GL_RGBA16F, GL_RGB16F},
+        {GL_RGBA16F, GL_RGB10_A2, GL_RGB16F},
+        {GL_RGBA8, GL_RGBA8, GL_RGBA8},
+    };
+    
+    std::cout << "LTC formats against 32-bit floats, errors in 8-bit steps:" << std::endl;
+    std::cout << std::left << std::setw(10) << "LTC1" << std::setw(10) << "LTC2" << std::setw(10) << "SHEEN" << std::right << std::setw(7) << "Bytes" << std::setw(6) << "Max" << std::setw(9) << "Mean" << std::setw(10) << "Changed" << std::endl;
+    
+    for (size_t i = 0; i < sizeof(candidates) / sizeof(candidates[0]); i++) {
+        
+        bgq_opengl::LTCAccuracy::Result result = accuracy.measure(candidates[i][0], candidates[i][1], candidates[i][2]);
+        
+        std::cout << std::left;
+        
+        for (int j = 0; j < 3; j++)
+            std::cout << std::setw(10) << bgq_opengl::LTCMatrix::getFormatName(candidates[i][j]);
+        
+        std::cout << std::right << std::setw(7) << result.bytes << std::setw(6) << (int) result.max_error << std::setw(9) << std::fixed << std::setprecision(4) << result.mean_error << std::setw(9) << std::setprecision(2) << result.changed * 100.0f << "%" << std::defaultfloat << std::endl;
+        
+    }
+    
+    file_1.remove();
+    file_2.remove();
+    file_sheen.remove();
+    
+}
+
+void renderBenchmark() {
+    
+    // Render the whole image.
+    camera->setWidth(software_renderer->getWidth());
+    camera->setHeight(software_renderer->getHeight());
+    
+    // Every frame is the same, so only the number of threads changes.
+    internal_time = 0.0;
+    int frames = headless_frames;
+    
+    // Try every power of two below the number of cores, and all of them.
+    int cores = std::max(1, (int) std::thread::hardware_concurrency());
+    std::vector<int> counts;
+    
+    for (int threads = 1; threads < cores; threads *= 2)
+        counts.push_back(threads);
+    
+    counts.push_back(cores);
+    
+    double single = 0.0;
+    
+    for (size_t i = 0; i < counts.size(); i++) {
+        
+        software_renderer->setThreads(counts[i]);
+        
+        // Warm up, so the buffers are already allocated.
+        displaySoftware();
+        
+        auto start = std::chrono::steady_clock::now();
+        
+        for (int j = 0; j < frames; j++)
+            displaySoftware();
+        
+        double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count() / frames;
+        
+        if (i == 0)
+            single = ms;
+        
+        // Report the time per frame and how well it scales.
+        bgq_opengl::SoftwareRenderer::Stats stats = software_renderer->getStats();
+        std::cout << counts[i] << " threads: " << ms << " ms/frame, " << single / ms << "x speedup, " << 100.0 * single / ms / counts[i] << "% efficiency, " << stats.steals << " tiles stolen." << std::endl;
+        
+        if (i == 0)
+            std::cout << "  (" << stats.triangles << " triangles and " << stats.fragments << " fragments per frame)" << std::endl;
+        
+    }
+    
+}
+
+void applyTimeline(const bgq_opengl::TimelineSample &sample) {
+    
+    camera->setPose(sample.position, sample.target);
+    
+    alpha = sample.alpha;
+    beta = sample.beta;
+    csheen = sample.csheen;
+    sheenType = sample.sheen_type;
+    fabric_roughness = sample.roughness;
+    light_intensity = sample.intensity;
+    
+}
+
+void renderBench() {
+    
+    // Tracks the timeline does not have keep the start camera and the current parameters.
+    bgq_opengl::TimelineSample defaults;
+    defaults.position = camera_start;
+    defaults.target = camera_start + glm::vec3(0.0f, -0.25f, -1.0f);
+    defaults.alpha = alpha;
+    defaults.beta = beta;
+    defaults.csheen = csheen;
+    defaults.sheen_type = sheenType;
+    defaults.roughness = fabric_roughness;
+    defaults.intensity = light_intensity;
+    
+    bgq_opengl::Timeline timeline = bench_path.empty() ? bgq_opengl::Timeline(defaults) : bgq_opengl::Timeline(bench_path.c_str(), defaults);
+    
+    // Render the whole image.
+    int width = software ? software_renderer->getWidth() : framebuffer->getWidth();
+    int height = software ? software_renderer->getHeight() : framebuffer->getHeight();
+    camera->setWidth(width);
+    camera->setHeight(height);
+    
+    std::string filename = bench_output.empty() ? output_dir + "/bench.json" : bench_output;
+    std::ofstream out(filename);
+    
+    if (!out) {
+        
+        std::cerr << "Error 121-1010 - Could not write the bench results to " << filename << "." << std::endl;
+        exit(1);
+        
+    }
+    
+    // What the numbers depend on, so that only comparable runs are compared, and how long the programs took to build.
+    bgq_opengl::ProgramCache::Stats shader_stats = bgq_opengl::ProgramCache::getStats();
+    
+    out << std::fixed << std::setprecision(4);
+    out << "{" << std::endl;
+    out << "  \"renderer\": ";
+    bgq_opengl::JSON::writeString(out, software ? "software" : (const char*) glGetString(GL_RENDERER));
+    out << "," << std::endl << "  \"gl_version\": ";
+    bgq_opengl::JSON::writeString(out, software ? "none" : (const char*) glGetString(GL_VERSION));
+    out << "," << std::endl << "  \"timeline\": ";
+    bgq_opengl::JSON::writeString(out, bench_path.empty() ? "default" : bench_path);
+    out << "," << std::endl;
+    out << "  \"frames\": " << headless_frames << ", \"warmup\": " << BENCH_WARMUP << ", \"time_step\": " << 1.0 / HEADLESS_FPS << "," << std::endl;
+    out << "  \"width\": " << width << ", \"height\": " << height << "," << std::endl;
+    out << "  \"vertex_format\": \"" << bgq_opengl::VertexPacker::getFormatName(vertex_format) << "\", \"multi_draw\": " << (multi_draw ? "true" : "false") << ", \"swatches\": " << swatches << "," << std::endl;
+    out << "  \"uber_shader\": " << (uber_shader ? "true" : "false") << ", \"shader_permutations\": " << (software ? 0 : ltc_shaders->getCount()) << "," << std::endl;
+    out << "  \"shader_cache\": " << (bgq_opengl::ProgramCache::isEnabled() ? "true" : "false") << ", \"shader_programs_loaded\": " << shader_stats.loaded << ", \"shader_programs_compiled\": " << shader_stats.compiled << ", \"shader_startup_ms\": " << shader_stats.load_ms + shader_stats.compile_ms << "," << std::endl;
+    out << "  \"scenes\": [" << std::endl;
+    
+    for (int scene = 1; scene <= 2; scene++) {
+        
+        selected_scene = scene;
+        
+        // Warm up on the first sample, so that nothing allocated on the first frames is timed.
+        internal_time = 0.0;
+        applyTimeline(timeline.sample(0.0f));
+        
+        for (int i = 0; i < BENCH_WARMUP; i++)
+            renderBenchFrame();
+        
+        if (!software) {
+            
+            glFinish();
+            gpu_profiler->reset();
+            
+        }
+        
+        std::vector<double> frame_ms, cpu_ms;
+        double draw_calls = 0.0, draws = 0.0, culled = 0.0;
+        unsigned int max_draw_calls = 0;
+        
+        for (int i = 0; i < headless_frames; i++) {
+            
+            // The time steps are fixed, so every run renders the same frames.
+            internal_time = i / HEADLESS_FPS;
+            applyTimeline(timeline.sample((float) internal_time));
+            
+            auto start = std::chrono::steady_clock::now();
+            
+            renderBenchFrame();
+            cpu_ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            
+            // Wait for the GPU, so that the frame time covers all of it.
+            if (!software)
+                glFinish();
+            
+            frame_ms.push_back(std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count());
+            
+            if (!software) {
+                
+                const bgq_opengl::GLState::Stats &stats = bgq_opengl::GLState::getStats();
+                draw_calls += stats.draw_calls;
+                draws += stats.draws;
+                culled += cull_stats.culled;
+                max_draw_calls = std::max(max_draw_calls, stats.draw_calls);
+                
+            }
+            
+        }
+        
+        out << "    {\"scene\": " << scene << ", \"frame_ms\": ";
+        writeBenchTimes(out, frame_ms);
+        out << ", \"cpu_ms\": ";
+        writeBenchTimes(out, cpu_ms);
+        
+        std::vector<double> sorted(frame_ms);
+        std::sort(sorted.begin(), sorted.end());
+        std::cout << "Scene " << scene << ": " << sorted[sorted.size() / 2] << " ms median, " << sorted[std::min(sorted.size() - 1, (size_t) (0.99 * sorted.size()))] << " ms p99";
+        
+        if (!software) {
+            
+            // Every frame is finished, so the ring can be read back to the end.
+            for (int i = 0; i < PROFILER_RING_SIZE; i++)
+                gpu_profiler->beginFrame();
+            
+            bgq_opengl::GPUProfiler::PassStats gpu = gpu_profiler->getStats().back();
+            
+            out << ", \"gpu_ms\": {\"min\": " << gpu.min << ", \"avg\": " << gpu.avg << ", \"p99\": " << gpu.p99 << ", \"samples\": " << gpu.samples << "}";
+            out << ", \"draw_calls\": {\"avg\": " << draw_calls / headless_frames << ", \"max\": " << max_draw_calls << "}";
+            out << ", \"draws\": " << draws / headless_frames << ", \"culled\": " << culled / headless_frames;
+            
+            std::cout << ", " << gpu.avg << " ms GPU, " << draw_calls / headless_frames << " draw calls per frame";
+            
+        }
+        
+        out << "}" << (scene < 2 ? "," : "") << std::endl;
+        std::cout << "." << std::endl;
+        
+    }
+    
+    // The peak resident memory of the whole run, both scenes loaded. Linux reports it in KB, macOS in bytes.
+    struct rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    
+#ifdef __APPLE__
+    long long peak_rss = (long long) usage.ru_maxrss;
+#else
+    long long peak_rss = (long long) usage.ru_maxrss * 1024;
+#endif
+    
+    out << "  ]," << std::endl;
+    out << "  \"peak_rss_bytes\": " << peak_rss << std::endl;
+    out << "}" << std::endl;
+    
+    std::cout << "Peak memory: " << peak_rss / (1024.0 * 1024.0) << " MB. Results written to " << filename << "." << std::endl;
+    
+    if (!software)
+        framebuffer->unbind();
+    
+}
+
+void renderBenchFrame() {
+    
+    if (software_renderer != NULL) {
+        
+        displaySoftware();
+        return;
+        
+    }
+    
+    // As renderFrame, without reading it back.
+    bgq_opengl::CPUProfiler::flush();
+    gpu_profiler->beginFrame();
+    framebuffer->bind();
+    clear();
+    
+    bgq_opengl::GLState::beginFrame();
+    displayElements();
+    
+}
+
+void writeBenchTimes(std::ostream &out, std::vector<double> times) {
+    
+    std::sort(times.begin(), times.end());
+    
+    double sum = 0.0;
+    for (size_t i = 0; i < times.size(); i++)
+        sum += times[i];
+    
+    // Picked rather than interpolated, so that every value is one of the frames.
+    size_t last = times.size() - 1;
+    
+    out << "{\"min\": " << times.front();
+    out << ", \"p50\": " << times[std::min(last, (size_t) (0.50 * times.size()))];
+    out << ", \"p90\": " << times[std::min(last, (size_t) (0.90 * times.size()))];
+    out << ", \"p99\": " << times[std::min(last, (size_t) (0.99 * times.size()))];
+    out << ", \"max\": " << times.back();
+    out << ", \"avg\": " << sum / times.size() << "}";
+    
+}
+
+void renderFrame(bgq_opengl::FrameReader *reader, bgq_opengl::FrameWriter &writer, const std::string &filename) {
+    
+    // Move the zones of the last frame out of the rings before they wrap.
+    bgq_opengl::CPUProfiler::flush();
+    
+    PROFILE_ZONE("renderFrame");
+    
+    if (software_renderer != NULL) {
+        
+        // Render on the CPU and hand the image straight to the writers.
+        displaySoftware();
+        
+        bgq_opengl::Frame frame;
+        software_renderer->read(&frame);
+        frame.name = filename;
+        writer.push(std::move(frame));
+        
+        return;
+        
+    }
+    
+    // Render on the GPU and read it back asynchronously.
+    gpu_profiler->beginFrame();
+    framebuffer->bind();
+    clear();
+    
+    bgq_opengl::GLState::beginFrame();
+    displayElements();
+    
+    queueFrame(*reader, writer, filename);
+    
+}
+
+void renderHeadless() {
+    
+    // Render the whole image.
+    int width = software ? software_renderer->getWidth() : framebuffer->getWidth();
+    int height = software ? software_renderer->getHeight() : framebuffer->getHeight();
+    camera->setWidth(width);
+    camera->setHeight(height);
+    
+    // The GPU frames are read back through a ring and encoded on other threads, so the GPU never waits for the disk.
+    bgq_opengl::FrameReader *reader = software ? NULL : new bgq_opengl::FrameReader(width, height, PBO_RING_SIZE);
+    bgq_opengl::FrameWriter writer(writer_threads, WRITER_QUEUE_SIZE);
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    for (int i = 0; i < headless_frames; i++) {
+        
+        // Render the frame with a fixed time step, so runs can be compared.
+        internal_time = i / HEADLESS_FPS;
+        
+        renderFrame(reader, writer, output_dir + "/frame-" + std::to_string(i) + ".png");
+        
+    }
+    
+    // Write the frames still in flight.
+    if (reader != NULL) {
+        
+        drainFrames(*reader, writer);
+        reader->remove();
+        delete reader;
+        framebuffer->unbind();
+        
+    }
+    
+    writer.finish();
+    
+    // Report the throughput.
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Rendered " << headless_frames << " frames in " << elapsed << " s (" << headless_frames / elapsed << " FPS)." << std::endl;
+    
+}
+
+void renderSweep() {
+    
+    // Parameters that the spec does not sweep keep their current value.
+    bgq_opengl::SweepPoint defaults;
+    defaults.alpha = alpha;
+    defaults.beta = beta;
+    defaults.csheen = csheen;
+    defaults.sheen_type = sheenType;
+    defaults.roughness = fabric_roughness;
+    defaults.intensity = light_intensity;
+    
+    bgq_opengl::Sweep sweep(sweep_file.c_str(), defaults);
+    const std::vector<bgq_opengl::SweepPoint> &points = sweep.getPoints();
+    
+    // Render the whole image.
+    int width = software ? software_renderer->getWidth() : framebuffer->getWidth();
+    int height = software ? software_renderer->getHeight() : framebuffer->getHeight();
+    camera->setWidth(width);
+    camera->setHeight(height);
+    
+    // The GPU renders the next images while the previous ones are read back and encoded.
+    bgq_opengl::FrameReader *reader = software ? NULL : new bgq_opengl::FrameReader(width, height, PBO_RING_SIZE);
+    bgq_opengl::FrameWriter writer(writer_threads, WRITER_QUEUE_SIZE);
+    
+    // Every image is rendered at the same time, so only the parameters change.
+    internal_time = 0.0;
+    
+    auto start = std::chrono::steady_clock::now();
+    
+    for (size_t i = 0; i < points.size(); i++) {
+        
+        // Set the parameters as the GUI would.
+        alpha = points[i].alpha;
+        beta = points[i].beta;
+        csheen = points[i].csheen;
+        sheenType = points[i].sheen_type;
+        fabric_roughness = points[i].roughness;
+        light_intensity = points[i].intensity;
+        
+        // Render the image.
+        renderFrame(reader, writer, output_dir + "/" + points[i].name + ".png");
+        
+    }
+    
+    // Write the images still in flight.
+    if (reader != NULL) {
+        
+        drainFrames(*reader, writer);
+        reader->remove();
+        delete reader;
+        framebuffer->unbind();
+        
+    }
+    
+    writer.finish();
+    
+    // Report the throughput.
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "Rendered " << writer.getWritten() << " of " << points.size() << " images in " << elapsed << " s (" << points.size() / elapsed << " images/s)." << std::endl;
+    
+}
+
+void setupLight(bgq_opengl::LightBlock *light) {
+    
+    light->points[0] = glm::vec4(3.0f + 0.125, 3.0f + 0.4, 3.0f - 0.575, 1.0f);
+    light->points[1] = glm::vec4(3.0f + 0.575, 3.0f - 0.4, 3.0f - 0.175, 1.0f);
+    light->points[2] = glm::vec4(3.0f - 0.125, 3.0f - 0.4, 3.0f + 0.575, 1.0f);
+    light->points[3] = glm::vec4(3.0f - 0.575, 3.0f + 0.4, 3.0f + 0.175, 1.0f);
+    light->color = glm::vec3(1.0f);
+    light->intensity = light_intensity;
+    
+}
+
+void setupPools(std::vector<bgq_opengl::Object> &scene, std::vector<bgq_opengl::GeometryPool*> *pools, std::vector<int> *indices, std::vector<int> *slots) {
+    
+    pools->clear();
+    indices->clear();
+    slots->clear();
+    
+    for (int i = 0; i < scene.size(); i++) {
+        
+        int geometries = (int) scene[i].getNumOfGeometries();
+        
+        // An object that does not fit in a draw block, or has nothing to copy, is drawn on its own.
+        bool poolable = geometries <= DRAW_BLOCK_DRAWS;
+        
+        for (int j = 0; j < geometries && poolable; j++)
+            poolable = scene[i].getGeometry(j).hasVertices();
+        
+        if (!poolable) {
+            
+            indices->push_back(-1);
+            slots->push_back(-1);
+            continue;
+            
+        }
+        
+        // The geometries of an object take consecutive slots of the same pool, so start another when the last is full.
+        if (pools->empty() || pools->back()->getSize() + geometries > DRAW_BLOCK_DRAWS)
+            pools->push_back(new bgq_opengl::GeometryPool(vertex_format, DRAW_BINDING));
+        
+        indices->push_back((int) pools->size() - 1);
+        slots->push_back((int) pools->back()->getSize());
+        
+        for (int j = 0; j < geometries; j++)
+            pools->back()->add(scene[i].getGeometry(j));
+        
+    }
+    
+    for (int i = 0; i < pools->size(); i++)
+        (*pools)[i]->upload();
+    
+}
+
+void submitPool(bgq_opengl::GeometryPool *pool, bgq_opengl::Shader &shader, const std::string &pass) {
+    
+    if (pool->getQueued() == 0)
+        return;
+    
+    gpu_profiler->beginPass(pass);
+    pool->submit(shader, *camera);
+    gpu_profiler->endPass();
+    
+}
+
+unsigned int getPermutation(const bgq_opengl::MaterialBlock &material, bool instanced, bool pooled) {
+    
+    // Only the permutations of a path have its inputs, so nothing is active that is not bound.
+    unsigned int path = instanced ? LTC_INSTANCED : pooled ? LTC_POOLED : 0;
+    
+    if (uber_shader)
+        return path;
+    
+    unsigned int bits = LTC_SPECIALIZED | path;
+    
+    if (material.use_alt)
+        bits |= LTC_USE_ALT;
+    
+    if (material.dust)
+        bits |= LTC_DUST;
+    
+    // The rest of the materials look the same with any sheen, so they share a permutation.
+    if (material.use_alt || material.dust) {
+        
+        if (material.sheen_type == 1)
+            bits |= LTC_SHEEN_ZELTNER;
+        else if (material.sheen_type == 2)
+            bits |= LTC_SHEEN_COSINE;
+        
+    }
+    
+    return bits;
+    
+}
+
+void writeGPUProfile(const std::string &filename) {
+    
+    bool json = filename.size() >= 5 && filename.compare(filename.size() - 5, 5, ".json") == 0;
+    bool written = json ? gpu_profiler->writeJSON(filename) : gpu_profiler->writeCSV(filename);
+    
+    if (written)
+        std::cerr << "GPU profile written to " << filename << std::endl;
+    else
+        std::cerr << "Error 121-1008 - Could not write the GPU profile to " << filename << "." << std::endl;
+    
+}
+
+void setupScene(bgq_opengl::LightBlock *light, std::vector<bgq_opengl::SceneDraw> *draws) {
+    
+    PROFILE_ZONE("setupScene");
+    
+    // The light is the same for every object.
+    setupLight(light);
+    
+    draws->clear();
+    
+    if (selected_scene == 1) {
+        
+        // Get info from the model.
+        bgq_opengl::BoundingBox bb = scene_1[0].getBoundingBox();
+        glm::vec3 centre = (bb.min + bb.max) / 2.0f;
+        glm::vec3 size = bb.max - bb.min;
+        float max_dim = std::max(size.x, std::max(size.y, size.z));
+        float scale_rat = NORM_SIZE / max_dim * 0.75f;
+        
+        for (int i = 0; i < scene_1.size(); i++) {
+            
+            // Rotate, center the object and get it in the right position, resize it to normalize it.
+            scene_1[i].resetTransforms();
+            scene_1[i].rotate(0.0, 1.0, 0.0, internal_time * 5.0);
+            scene_1[i].scale(scale_rat, scale_rat, scale_rat);
+            scene_1[i].translate(-centre.x, -centre.y, -centre.z);
+            
+        }
+        
+        // SPHERE
+        bgq_opengl::SceneDraw sphere;
+        sphere.object = 1;
+        sphere.material.use_alt = true;
+        sphere.material.alt_diffuse = glm::vec3(0.2f);
+        sphere.material.alt_normal = glm::vec3(0.0f, 0.0f, 1.0f);
+        sphere.material.alt_specular = glm::vec3(0.3f);
+        sphere.material.roughness = 0.01f;
+        sphere.material.alpha = alpha;
+        sphere.material.beta = beta;
+        sphere.material.csheen = csheen;
+        sphere.material.sheen_type = sheenType;
+        sphere.material.dust = false;
+        draws->push_back(sphere);
+        
+        // CLOTH
+        // This one does not have any textures.
+        bgq_opengl::SceneDraw cloth;
+        cloth.object = 0;
+        cloth.material.use_alt = true;
+        cloth.material.alt_diffuse = fabric_color;
+        cloth.material.alt_normal = glm::vec3(0.0f, 0.0f, 1.0f);
+        cloth.material.alt_specular = glm::vec3(fabric_specular);
+        cloth.material.roughness = fabric_roughness;
+        cloth.material.alpha = alpha;
+        cloth.material.beta = beta;
+        cloth.material.csheen = csheen;
+        cloth.material.sheen_type = sheenType;
+        cloth.material.dust = false;
+        cloth.instanced = swatches > 0;
+        draws->push_back(cloth);
+        
+    } else if (selected_scene == 2) {
+        
+        // Get info from the model.
+        bgq_opengl::BoundingBox bb = scene_2[1].getBoundingBox();
+        glm::vec3 centre = (bb.min + bb.max) / 2.0f;
+        glm::vec3 size = bb.max - bb.min;
+        float max_dim = std::max(size.x, std::max(size.y, size.z));
+        float scale_rat = NORM_SIZE / max_dim;
+        
+        for (int i = 0; i < scene_2.size(); i++) {
+            
+            // Rotate, center the object and get it in the right position, resize it to normalize it.
+            scene_2[i].resetTransforms();
+            scene_2[i].rotate(0.0, 1.0, 0.0, internal_time * 5.0);
+            scene_2[i].scale(scale_rat, scale_rat, scale_rat);
+            scene_2[i].translate(-centre.x, -centre.y, -centre.z);
+            
+        }
+        
+        // FABRIC
+        // This one does not have any textures.
+        bgq_opengl::SceneDraw fabric;
+        fabric.object = 0;
+        fabric.material.use_alt = true;
+        fabric.material.alt_diffuse = fabric_color;
+        fabric.material.alt_normal = glm::vec3(0.0f, 0.0f, 1.0f);
+        fabric.material.alt_specular = glm::vec3(fabric_specular);
+        fabric.material.roughness = fabric_roughness;
+        fabric.material.alpha = alpha;
+        fabric.material.beta = beta;
+        fabric.material.csheen = csheen;
+        fabric.material.sheen_type = sheenType;
+        fabric.material.dust = false;
+        draws->push_back(fabric);
+        
+        // TABLE
+        bgq_opengl::SceneDraw table;
+        table.object = 1;
+        table.textures = 0;
+        table.material.use_alt = false;
+        table.material.roughness = 0.4f;
+        table.material.specular_mult = 0.3f;
+        table.material.alpha = alpha;
+        table.material.beta = beta;
+        table.material.csheen = csheen;
+        table.material.sheen_type = sheenType;
+        table.material.dust = false;
+        draws->push_back(table);
+        
+        // SEWING MACHINE
+        bgq_opengl::SceneDraw machine;
+        machine.object = 2;
+        machine.textures = 3;
+        machine.material.use_alt = false;
+        machine.material.roughness = 0.01f;
+        machine.material.specular_mult = 0.2f;
+        machine.material.alpha = alpha;
+        machine.material.beta = beta;
+        machine.material.csheen = csheen;
+        machine.material.sheen_type = sheenType;
+        machine.material.dust = true;
+        draws->push_back(machine);
+        
+    }
+    
+}
+
+void setupSwatches() {
+    
+    // Fit the grid in the space of a single cloth, facing the camera.
+    int side = (int) ceil(sqrt((double) swatches));
+    float cell = NORM_SIZE / side;
+    
+    std::vector<bgq_opengl::InstanceData> instances(swatches);
+    
+    for (int i = 0; i < swatches; i++) {
+        
+        int row = i / side;
+        int col = i % side;
+        float u = side > 1 ? col / (float) (side - 1) : 0.5f;
+        float v = side > 1 ? row / (float) (side - 1) : 0.5f;
+        
+        glm::vec3 position((col - (side - 1) / 2.0f) * cell, (row - (side - 1) / 2.0f) * cell, 0.0f);
+        instances[i].model = glm::scale(glm::translate(glm::mat4(1.0f), position), glm::vec3(1.0f / side));
+        
+        // Go around the hues along the catalogue, and change the sheen along the rows and columns.
+        float hue = i / (float) swatches * 6.2831853f;
+        instances[i].diffuse = glm::vec3(0.5f) + 0.4f * glm::vec3(cos(hue), cos(hue - 2.0943951f), cos(hue + 2.0943951f));
+        instances[i].roughness = 0.3f + 0.7f * u;
+        instances[i].alpha = v;
+        instances[i].csheen = csheen * (0.5f + u);
+        
+    }
+    
+    scene_1[0].setInstances(instances);
+    
+    std::cerr << "Swatches: " << swatches << " instances of the cloth in a " << side << "x" << side << " grid" << std::endl;
+    
+}
+
+int main(int argc, char** argv) {
+
+    // Read the options.
+    parseArguments(argc, argv);
+    
+    // Only record the CPU zones if they are going to be written.
+    bgq_opengl::CPUProfiler::setThreadName("Main");
+    bgq_opengl::CPUProfiler::setEnabled(!cpu_trace_file.empty());
+    
+    // The LTC report runs on the CPU only.
+    if (ltc_report) {
+        
+        reportLTCFormats();
+        return 0;
+        
+    }
+    
+	// Initialise the environment.
+    initEnvironment();
+    
+	// Initialise the objects and elements.
+	initElements();
+    
+    // Without a window, render the frames and leave.
+    if (headless) {
+        
+        if (bench)
+            renderBench();
+        else if (benchmark)
+            renderBenchmark();
+        else if (sweep_file.empty())
+            renderHeadless();
+        else
+            renderSweep();
+        
+        clean();
+        return 0;
+        
+    }
+
+	// Main loop.
+    while(!glfwWindowShouldClose(window)) {
+        
+        // Move the zones of the last frame out of the rings before they wrap.
+        bgq_opengl::CPUProfiler::flush();
+        
+        // Forget the samples if the GUI asked to, before the frame issues any query.
+        if (gpu_profile_reset) {
+            
+            gpu_profiler->reset();
+            gpu_profile_reset = false;
+            
+        }
+        
+        // Clear the scene. Its queries go in the next slot of the profiler.
+        gpu_profiler->beginFrame();
+        clear();
+        
+        // Get the window size.
+        int width, height;
+        glfwGetWindowSize(window, &width, &height);
+        camera->setWidth(width);
+        camera->setHeight(height);
+        
+        // Get the current time.
+        internal_time = glfwGetTime();
+        
+        // If the loop has been restarted, set the starting time.
+        if (fps_counted == 0) {
+            
+            fps_time = internal_time;
+            
+        }
+
+        // Handle key events.
+        handleKeyEvents();
+        
+        // Display the scene and count the uniforms it looked up by name and the GL calls it saved.
+        ltc_shaders->resetUniformLookups();
+        bgq_opengl::GLState::beginFrame();
+        displayElements();
+        uniform_lookups = ltc_shaders->getUniformLookups();
+        gl_stats = bgq_opengl::GLState::getStats();
+        
+        // Make the things to print everything.
+        displayGUI();
+        
+        // Increment the FPS count in one.
+        fps_counted++;
+        
+        if (fps_counted >= FPS_STEP) {
+            
+            // Get the elapsed time.
+            double fps_elapsed_time = internal_time - fps_time;
+            
+            // Calculate the fps.
+            fps = fps_counted / fps_elapsed_time;
+            
+            // Restart the loop.
+            fps_counted = 0;
+            
+            // Print it.
+            std::cout << "FPS: " << fps << std::endl;
+            std::cout << "Uniform lookups per frame: " << uniform_lookups << std::endl;
+            std::cout << "GL calls per frame (issued / avoided):" << std::endl;
+            std::cout << "  Programs: " << gl_stats.program_binds << " / " << gl_stats.program_skips << std::endl;
+            std::cout << "  VAOs: " << gl_stats.vao_binds << " / " << gl_stats.vao_skips << std::endl;
+            std::cout << "  Texture units: " << gl_stats.unit_changes << " / " << gl_stats.unit_skips << std::endl;
+            std::cout << "  Textures: " << gl_stats.texture_binds << " / " << gl_stats.texture_skips << std::endl;
+            std::cout << "  Camera uniforms: " << gl_stats.uniform_uploads << " / " << gl_stats.uniform_skips << std::endl;
+            std::cout << "Geometries per frame (drawn / culled): " << cull_stats.tested - cull_stats.culled << " / " << cull_stats.culled << std::endl;
+            
+        }
+        
         // Update other events like input handling.
-        glfwPollEvents();
-        glfwSwapBuffers(window);
+        {
+            PROFILE_ZONE("glfwPollEvents");
+            glfwPollEvents();
+        }
+        
+        {
+            PROFILE_ZONE("glfwSwapBuffers");
+            glfwSwapBuffers(window);
+        }
         
     }
 
@@ -21,6 +21,25 @@
 #define GAME_NAME "Real-time animation"
 #define NORM_SIZE 1.0
 #define FPS_STEP 1000
+#define LIGHT_BINDING 0
+#define MATERIAL_BINDING 1
+#define DRAW_BINDING 2
+#define PBO_RING_SIZE 3
+#define HEADLESS_FPS 30.0
+#define WRITER_QUEUE_SIZE 8
+#define SOFTWARE_TILE_SIZE 32
+#define BENCHMARK_FRAMES 10
+#define BENCH_FRAMES 600
+#define BENCH_WARMUP 10
+#define PROFILER_RING_SIZE 2
+#define PROFILER_HISTORY 600
+#define LTC_SPECIALIZED 1
+#define LTC_USE_ALT 2
+#define LTC_DUST 4
+#define LTC_SHEEN_ZELTNER 8
+#define LTC_SHEEN_COSINE 16
+#define LTC_POOLED 32
+#define LTC_INSTANCED 64
 
 #include <vector>
 #include <string>
@@ -30,24 +49,81 @@
 #include "GLFW/glfw3.h"
 
 #include "classes/camera/camera.h"
+#include "classes/cpu_profiler/cpu_profiler.h"
+#include "classes/frame_reader/frame_reader.h"
+#include "classes/frame_writer/frame_writer.h"
+#include "classes/framebuffer/framebuffer.h"
+#include "classes/geometry_pool/geometry_pool.h"
+#include "classes/gl_state/gl_state.h"
+#include "classes/gpu_profiler/gpu_profiler.h"
 #include "classes/object/object.h"
+#include "classes/offscreen_context/offscreen_context.h"
+#include "classes/program_cache/program_cache.h"
 #include "classes/shader/shader.h"
+#include "classes/shader_permutations/shader_permutations.h"
+#include "classes/software_renderer/software_renderer.h"
 #include "classes/texture/texture.h"
 #include "classes/turbulence/turbulence.h"
+#include "classes/ltc_file/ltc_file.h"
 #include "classes/ltc_matrix/ltc_matrix.h"
+#include "classes/ubo/ubo.h"
+#include "structs/image/image.h"
+#include "structs/light_block/light_block.h"
+#include "structs/material_block/material_block.h"
+#include "structs/packed_vertex/packed_vertex.h"
+#include "structs/scene_draw/scene_draw.h"
+#include "structs/timeline_sample/timeline_sample.h"
 
 std::vector<bgq_opengl::Object> scene_1;    /// Holds all the displayed objects in scene 1.
 std::vector<bgq_opengl::Object> scene_2;    /// Holds all the displayed objects in scene 1.
+std::vector<bgq_opengl::UBO> materials_1;   /// Material block of each object in scene 1.
+std::vector<bgq_opengl::UBO> materials_2;   /// Material block of each object in scene 2.
+bgq_opengl::UBO *light_block;               /// Light block shared by all the objects.
 bgq_opengl::Camera *camera;                 /// Holds all the existing cameras.
-bgq_opengl::Shader *shader_ltc;             /// Holds the initialised
+bgq_opengl::ShaderPermutations *ltc_shaders;    /// Permutations of the LTC shaders, one per kind of material.
+const std::vector<std::string> ltc_features = {"SPECIALIZED", "USE_ALT", "DUST", "SHEEN_ZELTNER", "SHEEN_COSINE", "POOLED", "INSTANCED"};   /// Macro of each bit of the permutations.
+bool uber_shader = false;                   /// Whether to draw every material with the permutations that read its features.
+bool shader_cache = true;                   /// Whether to load the programs from their binaries of a previous run.
 std::vector<bgq_opengl::Texture> textures;  /// The initialised textures.
+int load_threads = 0;                       /// Threads decoding and importing the assets, 0 to use all the cores.
+bgq_opengl::VertexFormat vertex_format = bgq_opengl::VERTEX_FORMAT_FULL;    /// Layout the vertices are uploaded in.
 bgq_opengl::LTCMatrix *ltc_1;               
 bgq_opengl::LTCMatrix *ltc_2;
 bgq_opengl::LTCMatrix *ltc_sheen;
+std::vector<bgq_opengl::LTCFile> ltc_files;   /// Mapped LTC tables, kept while the software renderer reads them.
+GLenum ltc_formats[3] = {GL_RGBA16F, GL_RGBA16F, GL_RGB16F};    /// Internal formats of LTC1, LTC2 and SHEENCOEFFS.
+bool ltc_report = false;                    /// Whether to print the LTC format accuracy report and leave.
+int swatches = 0;                           /// Copies of the cloth drawn as a catalogue in scene 1, 0 to draw it once.
+bool multi_draw = false;                    /// Whether to draw each scene from a single pool of buffers.
+std::vector<bgq_opengl::GeometryPool*> pools_1;    /// Pools of scene 1, if multi_draw, each of up to DRAW_BLOCK_DRAWS geometries.
+std::vector<bgq_opengl::GeometryPool*> pools_2;    /// Pools of scene 2, if multi_draw, each of up to DRAW_BLOCK_DRAWS geometries.
+std::vector<int> pool_indices_1;            /// Pool of each object of scene 1, -1 if it is drawn on its own.
+std::vector<int> pool_indices_2;            /// Pool of each object of scene 2, -1 if it is drawn on its own.
+std::vector<int> pool_slots_1;              /// Slot of the first geometry of each object of scene 1 in its pool.
+std::vector<int> pool_slots_2;              /// Slot of the first geometry of each object of scene 2 in its pool.
 int selected_scene = 1;
 GLFWwindow *window = 0;						/// Window ID.
 double internal_time = 0;					/// Time that will rule everything in the game.
 
+// Headless mode.
+bool headless = false;                              /// Whether to render offscreen instead of to a window.
+int headless_frames = 0;                            /// Number of frames to render offscreen, 0 until set.
+std::string output_dir = ".";                       /// Folder the offscreen frames are written to.
+std::string sweep_file = "";                        /// Sweep spec to render, if any.
+int writer_threads = 0;                             /// Threads writing PNGs, 0 to use all but one core.
+bgq_opengl::OffscreenContext *offscreen = NULL;     /// The context used instead of a window.
+bgq_opengl::Framebuffer *framebuffer = NULL;        /// Where the offscreen frames are rendered.
+
+// Software rendering.
+bool software = false;                                      /// Whether to render the frames on the CPU.
+bool benchmark = false;                                     /// Whether to time the software renderer instead of writing frames.
+bool bench = false;                                         /// Whether to replay a timeline on both scenes and time it.
+std::string bench_path = "";                                /// Timeline the bench replays, the default one if empty.
+std::string bench_output = "";                              /// File the bench results are written to, bench.json in the output folder if empty.
+int render_threads = 0;                                     /// Threads rendering on the CPU, 0 to use all the cores.
+std::vector<bgq_opengl::Image> images;                      /// CPU copies of the textures, in the same order.
+bgq_opengl::SoftwareRenderer *software_renderer = NULL;     /// Renders the frames on the CPU.
+
 // GUI Vars.
 glm::vec3 fabric_color(0.30f, 0.65f, 0.46f);
 float light_intensity = 10;
@@ -61,8 +137,16 @@ int sheenType = 2;
 double fps = 0.0;
 int fps_counted = 0;
 double fps_time = 0.0;
+unsigned int uniform_lookups = 0;           /// Uniform lookups by name in the last frame.
+bgq_opengl::GLState::Stats gl_stats;        /// GL calls issued and avoided in the last frame.
+bgq_opengl::Object::CullStats cull_stats;   /// Geometries tested and culled in the last frame.
+bgq_opengl::GPUProfiler *gpu_profiler = NULL;   /// GPU time of every pass, on the GL path.
+bool gpu_profile_reset = false;             /// Whether to forget the GPU samples before the next frame.
+std::string gpu_profile_file = "";          /// File the GPU profile is written to on exit, if any.
+std::string cpu_trace_file = "";            /// File the CPU zones are written to on exit as a Chrome trace, if any.
 
 const glm::vec4 background(82 / 255.0, 103 / 255.0, 125 / 255.0, 1.0);
+const glm::vec3 camera_start(0.0f, 0.5f, 1.4f);
 
 /**
  * @brief Clean everything to end the program.
@@ -92,6 +176,13 @@ void displayElements();
  */
 void displayGUI();
 
+/**
+ * @brief Display the scene on the CPU.
+ *
+ * Render the same scene as displayElements with the software renderer.
+ */
+void displaySoftware();
+
 /**
  * @brief Handles the key events.
  *
@@ -102,16 +193,227 @@ void handleKeyEvents(unsigned char key, int x, int y);
 /**
  * @brief Init the elements of the program
  *
- * Initialize the objects, elements and all.
+ * Initialize the objects, elements and all. With the software renderer,
+ * only the CPU copies of the scene are loaded.
  */
 void initElements();
 
 /**
  * @brief Init the environment.
  *
- * Initialize the OpenGL, Glew and Freeglut environments.
+ * Initialize the OpenGL, Glew and Freeglut environments. The software
+ * renderer needs none of them.
+ */
+void initEnvironment();
+
+/**
+ * @brief Parse the command line.
+ *
+ * Parse the command line options: --headless, --frames <n>, --output <folder>,
+ * --scene <1|2>, --sweep <spec>, --threads <n>, --software,
+ * --render-threads <n>, --load-threads <n>, --benchmark,
+ * --ltc-format <float|half>, --vertex-format <full|half|float>,
+ * --swatches <n>, --multi-draw, --gpu-profile <file.csv|file.json>,
+ * --cpu-trace <file.json>, --bench, --bench-path <timeline>,
+ * --bench-output <file.json>, --uber-shader, --no-shader-cache and
+ * --ltc-report.
+ */
+void parseArguments(int argc, char** argv);
+
+/**
+ * @brief Write the frames still in flight.
+ *
+ * Wait for the frames still in flight and hand them to the writers.
+ *
+ * @param reader The frame reader.
+ * @param writer The frame writer.
+ */
+void drainFrames(bgq_opengl::FrameReader &reader, bgq_opengl::FrameWriter &writer);
+
+/**
+ * @brief Apply a sample of a timeline.
+ *
+ * Place the camera and set the parameters of the sheen model as a sample of
+ * a timeline says.
+ *
+ * @param sample The sample.
+ */
+void applyTimeline(const bgq_opengl::TimelineSample &sample);
+
+/**
+ * @brief Replay a timeline on both scenes and time it.
+ *
+ * Render both scenes offscreen along a timeline with a fixed time step,
+ * without writing the frames, and write the frame times, draw calls and
+ * memory use as JSON. Runs with the same options and timeline render the
+ * same frames, so they can be compared across commits.
+ */
+void renderBench();
+
+/**
+ * @brief Render a frame of the bench.
+ *
+ * Render a frame offscreen, on the GPU or the CPU, without reading it back.
+ */
+void renderBenchFrame();
+
+/**
+ * @brief Write the statistics of some times as JSON.
+ *
+ * Write the minimum, percentiles, maximum and mean of some times as a JSON
+ * object.
+ *
+ * @param out The stream to write to.
+ * @param times The times, in milliseconds.
+ */
+void writeBenchTimes(std::ostream &out, std::vector<double> times);
+
+/**
+ * @brief Read the rendered frame back.
+ *
+ * Request the frame just rendered into the framebuffer and hand the frames
+ * that are ready to the writers, waiting only if the ring is full.
+ *
+ * @param reader The frame reader.
+ * @param writer The frame writer.
+ * @param filename File the frame will be written to.
+ */
+void queueFrame(bgq_opengl::FrameReader &reader, bgq_opengl::FrameWriter &writer, const std::string &filename);
+
+/**
+ * @brief Render the software renderer benchmark.
+ *
+ * Render the scene on the CPU with 1, 2, 4... threads up to the number of
+ * cores, and print the milliseconds per frame of each.
+ */
+void renderBenchmark();
+
+/**
+ * @brief Render one offscreen frame.
+ *
+ * Render one frame, on the GPU or the CPU, and hand it to the writers.
+ *
+ * @param reader The frame reader, or NULL when rendering on the CPU.
+ * @param writer The frame writer.
+ * @param filename File the frame will be written to.
+ */
+void renderFrame(bgq_opengl::FrameReader *reader, bgq_opengl::FrameWriter &writer, const std::string &filename);
+
+/**
+ * @brief Print the LTC format accuracy report.
+ *
+ * Compare the images the LTC tables give in every supported texture format
+ * to the 32-bit ones with the CPU reference, and print the errors and the
+ * bytes fetched per fragment.
+ */
+void reportLTCFormats();
+
+/**
+ * @brief Render the frames offscreen.
+ *
+ * Render the frames into a framebuffer, read them back asynchronously and
+ * write them as PNG files to the output folder.
+ */
+void renderHeadless();
+
+/**
+ * @brief Render a parameter sweep offscreen.
+ *
+ * Render every combination of the sweep spec with the scene, textures and
+ * program already loaded, and write them as PNG files to the output folder.
+ */
+void renderSweep();
+
+/**
+ * @brief Set the light up.
+ *
+ * Set the area light up, as every scene uses it.
+ *
+ * @param light Output light.
+ */
+void setupLight(bgq_opengl::LightBlock *light);
+
+/**
+ * @brief Pool the geometries of a scene.
+ *
+ * Copy the geometries of a scene into pools, in order, so they can be
+ * drawn with multi-draws. The geometries of an object go in the same pool,
+ * and a new pool is started when they do not fit in the draw block of the
+ * last one. An object with more geometries than a whole draw block, or
+ * without its CPU copies, is left out and drawn on its own.
+ *
+ * @param scene The objects of the scene, with their CPU copies.
+ * @param pools Output pools, already uploaded.
+ * @param indices Output pool of each object, -1 if it is left out.
+ * @param slots Output slot of the first geometry of each object in its pool.
+ */
+void setupPools(std::vector<bgq_opengl::Object> &scene, std::vector<bgq_opengl::GeometryPool*> *pools, std::vector<int> *indices, std::vector<int> *slots);
+
+/**
+ * @brief Draw what is queued in a pool.
+ *
+ * Draw the geometries queued in a pool, timed as a pass of its own, if
+ * there are any.
+ *
+ * @param pool The pool.
+ * @param shader The permutation the queued geometries are drawn with.
+ * @param pass The name of the pass.
+ */
+void submitPool(bgq_opengl::GeometryPool *pool, bgq_opengl::Shader &shader, const std::string &pass);
+
+/**
+ * @brief Get the permutation of a material.
+ *
+ * Get the bits of the LTC shader permutation that draws a material. The
+ * sheen is only applied to the constant materials and the dust, so the
+ * rest do not depend on it. With uber_shader, it is always the one that
+ * reads every feature from the material. The instances and the pools
+ * have permutations of their own either way, as only those have the
+ * instance attributes and the DrawBlock.
+ *
+ * @param material The material.
+ * @param instanced Whether it is drawn with instances.
+ * @param pooled Whether it is drawn from a pool.
+ *
+ * @returns The bits of the permutation.
+ */
+unsigned int getPermutation(const bgq_opengl::MaterialBlock &material, bool instanced, bool pooled);
+
+/**
+ * @brief Write the GPU profile.
+ *
+ * Write the statistics of the GPU profiler as JSON if the file ends in
+ * .json, else as CSV.
+ *
+ * @param filename The file to write.
+ */
+void writeGPUProfile(const std::string &filename);
+
+/**
+ * @brief Set the scene up for the frame.
+ *
+ * Move the objects of the selected scene and list which ones to draw and
+ * how, so both renderers draw the same thing.
+ *
+ * @param light Output light of the frame.
+ * @param draws Output objects to draw, in order.
+ */
+void setupScene(bgq_opengl::LightBlock *light, std::vector<bgq_opengl::SceneDraw> *draws);
+
+/**
+ * @brief Set the swatch catalogue up.
+ *
+ * Lay the copies of the cloth out in a grid, each with its own color,
+ * roughness and sheen, and upload them as its instances.
+ */
+void setupSwatches();
+
+/**
+ * @brief Init the window.
+ *
+ * Create the window, its context and GLEW, and set ImGui up.
  */
-void initEnvironment(int argc, char** argv);
+void initWindow();
 
 /**
  * @brief Main function.
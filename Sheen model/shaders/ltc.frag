@@ -10,49 +10,113 @@ in vec3 vertexColor;        // Color from the VS.
 in vec2 vertexUV;           // UV coordinates from the VS.
 in vec3 vertexTangent;     // Tangents from the VS.
 in vec3 vertexBitangent;   // Bitangents from the VS.
+flat in vec4 instanceMaterial;  // Diffuse color and roughness of the instance, if INSTANCED.
+flat in vec2 instanceSheen;     // Alpha and Csheen of the instance, if INSTANCED.
+flat in int drawSlot;           // Slot of the geometry in its pool, if POOLED.
 
 // Defines the DS for light areas.
-struct Light {
-    float intensity;
-    vec3 color;
+// Shared by every object, so it is uploaded once per frame.
+layout (std140) uniform LightBlock {
     vec3 points[4];
-};
+    vec3 color;
+    float intensity;
+} mainLight;
 
-// Defines the DS for materials.
+// Defines the DS for the material textures.
 struct Material {
     sampler2D diffuse;      // The texture that controls the base color.
     sampler2D normalmap;    // The texture that controls the normals.
     sampler2D specular;    // The texture that controls the roughness of the material.
-    float roughness;         // Controls the specular of the material.
-    float specular_mult;
 };
 
-struct MaterialAlt {
-    vec3 diffuse;           // The texture that controls the base color.
-    vec3 normalmap;         // The texture that controls the normals.
-    vec3 specular;    // The texture that controls the roughness of the material.
-    float roughness;         // Controls the specular of the material.
+// Defines the DS for the material parameters.
+// Each material has its own buffer, so drawing an object only binds it. The geometries of a pool
+// bring theirs in the DrawBlock instead, so only one of the blocks is in a permutation.
+#ifndef POOLED
+layout (std140) uniform MaterialBlock {
+    vec3 altDiffuse;        // The base color when useAlt is set.
+    float roughness;        // Controls the specular of the material.
+    vec3 altNormal;         // The tangent-space normal when useAlt is set.
+    float specularMult;     // Multiplies the specular texture.
+    vec3 altSpecular;       // The specular when useAlt is set.
+    float alpha;
+    float beta;
+    float Csheen;
+    int sheenType;
+    bool useAlt;            // Whether to use alt or regular material.
+    bool dust;
+};
+#endif
+
+// The same parameters, for the ones that do not come from the MaterialBlock.
+struct MaterialData {
+    vec3 altDiffuse;
+    float roughness;
+    vec3 altNormal;
+    float specularMult;
+    vec3 altSpecular;
+    float alpha;
+    float beta;
+    float Csheen;
+    int sheenType;
+    bool useAlt;
+    bool dust;
 };
 
+#ifdef POOLED
+
+// The matrix and material of every geometry of a pool, indexed by its slot.
+struct DrawData {
+    mat4 model;
+    MaterialData material;
+};
+
+layout (std140) uniform DrawBlock {
+    DrawData draws[112];    // DRAW_BLOCK_DRAWS.
+};
+
+#endif
+
 uniform mat4 Model;            // Imports the model matrix.
 uniform mat4 View;            // Imports the View matrix.
 uniform mat4 Projection;    // Imports the projection matrix.
-uniform Light mainLight;            // The LTC lights.
-uniform Material material;          // The material controling the object.
-uniform MaterialAlt materialalt;    // The material controling the object.
+uniform Material material;          // The textures of the material controling the object.
 uniform vec3 cameraPosition;        // Position of the camera.
-uniform bool useAlt;                // Whether to use alt or regular material.
-uniform float alpha;
-uniform float beta;
-uniform bool dust;
-uniform float Csheen;
-uniform int sheenType;
 uniform sampler2D LTC1;             // For inverse M
 uniform sampler2D LTC2;             // GGX norm, fresnel, 0(unused), sphere
 uniform sampler2D SHEENCOEFFS;      // The sheen lookup table
 
 out vec4 outColor;          // Outputs color in RGBA.
 
+MaterialData mat;           // Material of the block, the draw or the instance, set at the start of main.
+
+// Permutations define SPECIALIZED and the features of the material they draw, so its branches are
+// resolved when compiling and the ones it does not take are compiled out. Without it, every fragment
+// reads them from the material.
+#ifdef SPECIALIZED
+#ifdef USE_ALT
+#define MATERIAL_USE_ALT true
+#else
+#define MATERIAL_USE_ALT false
+#endif
+#ifdef DUST
+#define MATERIAL_DUST true
+#else
+#define MATERIAL_DUST false
+#endif
+#if defined(SHEEN_ZELTNER)
+#define MATERIAL_SHEEN_TYPE 1
+#elif defined(SHEEN_COSINE)
+#define MATERIAL_SHEEN_TYPE 2
+#else
+#define MATERIAL_SHEEN_TYPE 0
+#endif
+#else
+#define MATERIAL_USE_ALT mat.useAlt
+#define MATERIAL_DUST mat.dust
+#define MATERIAL_SHEEN_TYPE mat.sheenType
+#endif
+
 const float LUT_SIZE  = 64.0;                           // LTC Lookup table size.
 const float LUT_SCALE = (LUT_SIZE - 1.0) / LUT_SIZE;    // How much is the lookup table scaled.
 const float LUT_BIAS  = 0.5 / LUT_SIZE;                 // The bias this LTC presents.
@@ -208,7 +272,7 @@ vec3 rotateVector(vec3 v, vec3 axis, float angle) {
 vec3 fetchCoeffs(vec3 wo, float cosThetaO) {
     
     // Compute table indices and interpolation factors.
-    float row = max(0.0, min(alpha, 1.0));
+    float row = max(0.0, min(mat.alpha, 1.0));
     float col = max(0.0, min(cosThetaO, 1.0));
 
     return texture(SHEENCOEFFS, vec2(col, row)).xyz;
@@ -269,7 +333,7 @@ vec3 sheenModel(vec3 worldPosition, vec3 worldNormal) {
 
     // Consider the overall reflectance `R` and the artist-specified sheen scale.
     float R = ltcCoeffs[2];
-    value *= R * Csheen;
+    value *= R * mat.Csheen;
     
     float res = value; // cosThetaI;
     res = clamp(res, 0.0, 1.0);
@@ -304,7 +368,7 @@ vec3 cosineSheen(vec3 worldPosition, vec3 worldNormal) {
     // Obtain the angle from 0 to 1.
     // Now we will get the sheen using alpha by limiting what is considered sheen.
     // Now we are only considering as sheen what is in the range 1-alpha - 1.0;
-    float sheen = 1.0 - scaleFloat(cosThetaO, beta);
+    float sheen = 1.0 - scaleFloat(cosThetaO, mat.beta);
     
     return vec3(sheen, sheen, sheen);
         
@@ -312,22 +376,36 @@ vec3 cosineSheen(vec3 worldPosition, vec3 worldNormal) {
 
 void main() {
     
+    // Pooled geometries bring their own material, and instances their own color, roughness and sheen.
+#ifdef POOLED
+    mat = draws[drawSlot].material;
+#else
+    mat = MaterialData(altDiffuse, roughness, altNormal, specularMult, altSpecular, alpha, beta, Csheen, sheenType, useAlt, dust);
+#endif
+    
+#ifdef INSTANCED
+    mat.altDiffuse = instanceMaterial.rgb;
+    mat.roughness = instanceMaterial.a;
+    mat.alpha = instanceSheen.x;
+    mat.Csheen = instanceSheen.y;
+#endif
+    
     // Selec the right elements for the materials.
     vec3 diffuse_val;
     vec3 specular_val;
     vec3 normals_val;
     float roughness_val;
-    if (useAlt) {
-        diffuse_val = materialalt.diffuse;
-        specular_val = materialalt.specular;
-        normals_val = materialalt.normalmap;
-        roughness_val = materialalt.roughness;
+    if (MATERIAL_USE_ALT) {
+        diffuse_val = mat.altDiffuse;
+        specular_val = mat.altSpecular;
+        normals_val = mat.altNormal;
+        roughness_val = mat.roughness;
         specular_val = toLinear(specular_val);
     } else {
         diffuse_val = texture(material.diffuse, vertexUV).xyz;
-        specular_val = texture(material.specular, vertexUV).xyz * material.specular_mult;
+        specular_val = texture(material.specular, vertexUV).xyz * mat.specularMult;
         normals_val = texture(material.normalmap, vertexUV).xyz;
-        roughness_val = material.roughness;
+        roughness_val = mat.roughness;
         specular_val = toLinear(specular_val);
     }
     
@@ -341,7 +419,7 @@ void main() {
     vec3 worldNormal = normalize(toTangentSpace * normals_val.xyz);
     
     // SHEEN MODEL.
-    if (dust) {
+    if (MATERIAL_DUST) {
         worldNormal = normalize(vertexNormal);
     }
     
@@ -387,28 +465,28 @@ void main() {
     result = toSRGB(result);
     
     // SHEEN MODEL.
-    if (useAlt) {
+    if (MATERIAL_USE_ALT) {
         
-        if (sheenType == 1) {
+        if (MATERIAL_SHEEN_TYPE == 1) {
             
             // Apply the sheen model.
             vec3 sheenLayer = sheenModel(worldPosition, worldNormal);
             result += sheenLayer;
             
-        } else if (sheenType == 2) {
+        } else if (MATERIAL_SHEEN_TYPE == 2) {
                         
             vec3 sheenLayer = cosineSheen(worldPosition, worldNormal);
             
-            result += sheenLayer * (Csheen / 10.0);
+            result += sheenLayer * (mat.Csheen / 10.0);
             
         }
         
     }
     
     // SHEEN MODEL.
-    if (dust) {
+    if (MATERIAL_DUST) {
         
-        if (sheenType == 1) {
+        if (MATERIAL_SHEEN_TYPE == 1) {
             
             // Apply the sheen model.
             vec3 sheenLayer = sheenModel(worldPosition, worldNormal);
@@ -418,14 +496,14 @@ void main() {
             
             result += sheenLayer * howUp;
                         
-        } else if (sheenType == 2) {
+        } else if (MATERIAL_SHEEN_TYPE == 2) {
                         
             vec3 sheenLayer = cosineSheen(worldPosition, worldNormal);
             
             // Get how up the normal is.
             float howUp = clamp(-worldNormal.y, 0.0, 1.0);
 
-            result += sheenLayer * (Csheen / 10.0) * howUp;
+            result += sheenLayer * (mat.Csheen / 10.0) * howUp;
                         
         }
         
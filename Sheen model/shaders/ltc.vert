@@ -1,17 +1,53 @@
 #version 330 core
 
-layout (location = 0) in vec3 inVertex;    // Vertex.
-layout (location = 1) in vec3 inNormal;    // Normal (not necessarily normalized).
+layout (location = 0) in vec4 inVertex;    // Vertex, and the bitangent sign in w if packed.
+layout (location = 1) in vec3 inNormal;    // Normal (not necessarily normalized), octahedral in xy if packed.
 layout (location = 2) in vec3 inColor;    // Color (not necessarily normalized).
 layout (location = 3) in vec2 inUV;        // UV coordinates.
-layout (location = 4) in vec3 inTangents;   // UV coordinates.
-layout (location = 5) in vec3 inBitangents; // UV coordinates.
+layout (location = 4) in vec3 inTangents;   // Tangent, octahedral in xy if packed.
+layout (location = 5) in vec3 inBitangents; // Bitangent, not there if packed.
+layout (location = 6) in mat4 inInstanceModel;      // Model matrix of the instance, locations 6 to 9.
+layout (location = 10) in vec4 inInstanceMaterial;  // Diffuse color and roughness of the instance.
+layout (location = 11) in vec2 inInstanceSheen;     // Alpha and Csheen of the instance.
+layout (location = 12) in float inDrawSlot;         // Slot of the geometry in its pool, if pooled.
+
+// Permutations define POOLED to draw the geometries of a pool and INSTANCED to draw instances, so the
+// DrawBlock is only in the programs that have one bound, and the instance attributes are only read when fed.
+#ifdef POOLED
+
+// The parameters of a material, laid out as the MaterialBlock in ltc.frag.
+struct MaterialData {
+    vec3 altDiffuse;
+    float roughness;
+    vec3 altNormal;
+    float specularMult;
+    vec3 altSpecular;
+    float alpha;
+    float beta;
+    float Csheen;
+    int sheenType;
+    bool useAlt;
+    bool dust;
+};
+
+// The matrix and material of every geometry of a pool, indexed by its slot.
+struct DrawData {
+    mat4 model;
+    MaterialData material;
+};
+
+layout (std140) uniform DrawBlock {
+    DrawData draws[112];    // DRAW_BLOCK_DRAWS.
+};
+
+#endif
 
 uniform mat4 Model;            // Imports the model matrix.
 uniform mat4 View;            // Imports the View matrix.
 uniform mat4 Projection;    // Imports the projection matrix.
 uniform mat4 modelView;        // Imports the modelView already multiplied.
 uniform mat4 normalMatrix;    // Imports the normal matrix.
+uniform bool packedVertices;  // Whether the normal and tangent are octahedral and the bitangent has to be rebuilt.
 
 out vec3 vertexNormal;        // Passes the normal to the fragment shader.
 out vec3 vertexColor;        // Passes the color to the fragment shader.
@@ -19,18 +55,67 @@ out vec2 vertexUV;            // Passes the UV coordinates to the fragment shade
 out vec3 vertexPosition;    // Passes the current vertex to the fragment shader.
 out vec3 vertexTangent;
 out vec3 vertexBitangent;
+flat out vec4 instanceMaterial;  // Passes the material of the instance to the fragment shader.
+flat out vec2 instanceSheen;
+flat out int drawSlot;           // Passes the slot of the geometry to the fragment shader.
+
+// Decodes a unit vector encoded on an octahedron.
+vec3 octDecode(vec2 encoded) {
+    
+    vec3 vector = vec3(encoded, 1.0 - abs(encoded.x) - abs(encoded.y));
+    float fold = max(-vector.z, 0.0);
+    vector.xy += mix(vec2(fold), vec2(-fold), greaterThanEqual(vector.xy, vec2(0.0)));
+    
+    return normalize(vector);
+    
+}
 
 void main() {
+    
+    // Unpack the vertex if it has to be.
+    vec3 normal = inNormal;
+    vec3 tangent = inTangents;
+    vec3 bitangent = inBitangents;
+    
+    if (packedVertices) {
+        
+        normal = octDecode(inNormal.xy);
+        tangent = octDecode(inTangents.xy);
+        bitangent = cross(normal, tangent) * inVertex.w;
+        
+    }
+
+    // Instances are moved after the transforms of the object.
+    mat4 model = Model;
+    mat4 model_view = modelView;
+    
+#if defined(INSTANCED)
+    
+    model = inInstanceModel * Model;
+    model_view = View * model;
+    
+    instanceMaterial = inInstanceMaterial;
+    instanceSheen = inInstanceSheen;
+    
+#elif defined(POOLED)
+    
+    // The geometries of a pool are drawn together, each with its own matrix.
+    model = draws[int(inDrawSlot)].model;
+    model_view = View * model;
+    
+    drawSlot = int(inDrawSlot);
+    
+#endif
 
     // Assigns the direct passes.
-    vertexNormal = vec3(Model * vec4(inNormal, 0.0));
+    vertexNormal = vec3(model * vec4(normal, 0.0));
     vertexColor = inColor;
     vertexUV = mat2(0.0, -1.0, 1.0, 0.0) * inUV;
-    vertexPosition = vec3(Model * vec4(inVertex, 1.0));
-    vertexTangent = vec3(Model * vec4(inTangents, 0.0));
-    vertexBitangent = vec3(Model * vec4(inBitangents, 0.0));
+    vertexPosition = vec3(model * vec4(inVertex.xyz, 1.0));
+    vertexTangent = vec3(model * vec4(tangent, 0.0));
+    vertexBitangent = vec3(model * vec4(bitangent, 0.0));
 
     // Sets the visualized position by applying the camera matrix.
-    gl_Position = Projection * modelView * vec4(inVertex, 1.0);
+    gl_Position = Projection * model_view * vec4(inVertex.xyz, 1.0);
     
 }
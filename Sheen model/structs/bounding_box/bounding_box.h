@@ -39,15 +39,50 @@ namespace bgq_opengl {
      *
      * @param a The first struct.
      * @param b The second struct.
+     *
+     * @returns The smallest box holding both.
      */
-    static BoundingBox get_union(const BoundingBox& a, const BoundingBox& b) {
+    inline BoundingBox get_union(const BoundingBox& a, const BoundingBox& b) {
         
-        BoundingBox ret = a;
+        BoundingBox ret;
+        ret.min = glm::min(a.min, b.min);
+        ret.max = glm::max(a.max, b.max);
         
         return ret;
                 
     }
 
+    /**
+     * @brief Transforms a bounding box.
+     *
+     * Calculates the box holding a bounding box after a transform, from its
+     * centre and half size, without transforming its eight corners.
+     *
+     * @param box The struct.
+     * @param matrix The affine transform.
+     *
+     * @returns The smallest axis-aligned box holding the transformed box.
+     */
+    inline BoundingBox get_transformed(const BoundingBox& box, const glm::mat4& matrix) {
+        
+        glm::vec3 centre = (box.min + box.max) * 0.5f;
+        glm::vec3 half = (box.max - box.min) * 0.5f;
+        
+        // The half size grows by the absolute value of every axis it is rotated onto.
+        glm::mat3 linear(matrix);
+        glm::mat3 absolute(glm::abs(linear[0]), glm::abs(linear[1]), glm::abs(linear[2]));
+        
+        glm::vec3 new_centre = glm::vec3(matrix * glm::vec4(centre, 1.0f));
+        glm::vec3 new_half = absolute * half;
+        
+        BoundingBox ret;
+        ret.min = new_centre - new_half;
+        ret.max = new_centre + new_half;
+        
+        return ret;
+        
+    }
+
 } // namespace bgq_opengl
 
 #endif //!BGQ_OPENGL_STRUCT_BOUNDINGBOX_H_
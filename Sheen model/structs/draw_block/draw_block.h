@@ -0,0 +1,60 @@
+/**
+ * @file draw_block.h
+ * @brief Draw uniform block structure.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_DRAWBLOCK_H_
+#define BGQ_OPENGL_STRUCT_DRAWBLOCK_H_
+
+#include "glm/glm.hpp"
+
+#include "structs/material_block/material_block.h"
+
+// Draws a block holds. 16 KB is the least GL_MAX_UNIFORM_BLOCK_SIZE can be.
+#define DRAW_BLOCK_DRAWS 112
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief The matrix and material of one draw of a pool.
+	 *
+	 * This Struct mirrors the std140 layout of DrawData in ltc.vert and
+	 * ltc.frag. The material is laid out as a MaterialBlock, which std140
+	 * already rounds up to 16 bytes inside a struct.
+	 */
+	struct DrawData {
+
+		glm::mat4 model = glm::mat4(1.0f);		/// Model matrix.
+		MaterialBlock material;					/// Material.
+
+	};
+
+	/**
+	 * @brief The draw uniform block.
+	 *
+	 * This Struct mirrors the std140 layout of the DrawBlock in ltc.vert and
+	 * ltc.frag, one DrawData for every geometry of a GeometryPool, indexed by
+	 * the slot the pool gave it.
+	 */
+	struct DrawBlock {
+
+		DrawData draws[DRAW_BLOCK_DRAWS];		/// Matrix and material of every slot.
+
+	};
+
+	static_assert(sizeof(DrawData) == 144, "DrawData does not match the std140 layout.");
+	static_assert(sizeof(DrawBlock) <= 16384, "DrawBlock does not fit in the smallest uniform block.");
+
+} // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_STRUCT_DRAWBLOCK_H_
@@ -0,0 +1,41 @@
+/**
+ * @file frame.h
+ * @brief Frame struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_FRAME_H_
+#define BGQ_OPENGL_STRUCT_FRAME_H_
+
+#include <string>
+#include <vector>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief A frame read back from the GPU.
+	 *
+	 * This Struct holds the RGBA pixels of a rendered frame, bottom row first
+	 * as OpenGL reads them, and the name it will be saved with.
+	 */
+	struct Frame {
+
+		std::string name;					// Name of the frame, usually its file name.
+		int width = 0;						// Width in pixels.
+		int height = 0;						// Height in pixels.
+		std::vector<unsigned char> pixels;	// RGBA pixels.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_FRAME_H_
@@ -0,0 +1,69 @@
+/**
+ * @file frustum.h
+ * @brief Frustum struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_FRUSTUM_H_
+#define BGQ_OPENGL_STRUCT_FRUSTUM_H_
+
+#include "glm/glm.hpp"
+
+#include "structs/bounding_box/bounding_box.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief A view frustum.
+	 *
+	 * This Struct represents the six planes of a view frustum: left, right,
+	 * bottom, top, near and far. Every plane is (normal, distance), with the
+	 * normal pointing inside and normalized, so a point p is inside all of
+	 * them when dot(normal, p) + distance >= 0.
+	 */
+	struct Frustum {
+
+		glm::vec4 planes[6];	// The planes.
+
+	};
+
+    /**
+     * @brief Whether a bounding box touches a frustum.
+     *
+     * Whether a bounding box is, at least in part, inside a frustum. Boxes
+     * near a corner of the frustum may pass without touching it.
+     *
+     * @param frustum The frustum.
+     * @param box The bounding box.
+     *
+     * @returns False if the box is entirely outside one of the planes.
+     */
+    inline bool intersects(const Frustum& frustum, const BoundingBox& box) {
+        
+        for (int i = 0; i < 6; i++) {
+            
+            // Test the corner furthest along the normal.
+            const glm::vec4& plane = frustum.planes[i];
+            glm::vec3 corner(plane.x > 0.0f ? box.max.x : box.min.x, plane.y > 0.0f ? box.max.y : box.min.y, plane.z > 0.0f ? box.max.z : box.min.z);
+            
+            if (glm::dot(glm::vec3(plane), corner) + plane.w < 0.0f)
+                return false;
+            
+        }
+        
+        return true;
+        
+    }
+
+} // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_STRUCT_FRUSTUM_H_
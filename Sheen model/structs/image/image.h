@@ -0,0 +1,40 @@
+/**
+ * @file image.h
+ * @brief Image struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_IMAGE_H_
+#define BGQ_OPENGL_STRUCT_IMAGE_H_
+
+#include <vector>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief An image kept in memory.
+	 *
+	 * This Struct holds the pixels of a texture on the CPU, bottom row first
+	 * as Texture uploads them, for the renderers that do not use OpenGL.
+	 */
+	struct Image {
+
+		int width = 0;						// Width in pixels.
+		int height = 0;						// Height in pixels.
+		int channels = 0;					// Channels per pixel.
+		std::vector<unsigned char> pixels;	// The pixels.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_IMAGE_H_
@@ -0,0 +1,47 @@
+/**
+ * @file instance_data.h
+ * @brief Instance data structure.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_INSTANCE_DATA_H_
+#define BGQ_OPENGL_STRUCT_INSTANCE_DATA_H_
+
+#include "glm/glm.hpp"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief The attributes of one instance.
+	 *
+	 * This Struct holds what changes from one copy of an object to the next
+	 * when they are drawn in a single instanced call. It is read by ltc.vert
+	 * from locations 6 to 9 (the model matrix), 10 (diffuse and roughness)
+	 * and 11 (alpha and Csheen). The material values replace the ones of the
+	 * MaterialBlock.
+	 */
+	struct InstanceData {
+
+		glm::mat4 model = glm::mat4(1.0f);			/// Model matrix, applied after the transforms of the object.
+		glm::vec3 diffuse = glm::vec3(0.0f);		/// Constant base color, used when the material sets use_alt.
+		float roughness = 0.0f;						/// Roughness of the material.
+		float alpha = 0.0f;							/// Roughness of the Zeltner sheen.
+		float csheen = 0.0f;						/// Scale of the sheen.
+		float padding[2] = {0.0f, 0.0f};			/// Keeps every instance a multiple of 16 bytes.
+
+	};
+
+	static_assert(sizeof(InstanceData) == 96, "InstanceData does not match the instance attributes.");
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_INSTANCE_DATA_H_
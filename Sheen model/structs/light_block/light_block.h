@@ -0,0 +1,41 @@
+/**
+ * @file light_block.h
+ * @brief Light uniform block struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_LIGHTBLOCK_H_
+#define BGQ_OPENGL_STRUCT_LIGHTBLOCK_H_
+
+#include "glm/glm.hpp"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief The area light uniform block.
+	 *
+	 * This Struct mirrors the std140 layout of the LightBlock in ltc.frag. Every
+	 * element of a vec3 array takes 16 bytes, so the points are stored as vec4.
+	 */
+	struct LightBlock {
+
+		glm::vec4 points[4];	/// Corners of the area light (w is padding).
+		glm::vec3 color;		/// Color of the light in RGB.
+		float intensity;		/// Intensity of the light.
+
+	};
+
+	static_assert(sizeof(LightBlock) == 80, "LightBlock does not match the std140 layout.");
+
+} // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_STRUCT_LIGHTBLOCK_H_
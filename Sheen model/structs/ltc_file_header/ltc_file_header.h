@@ -0,0 +1,54 @@
+/**
+ * @file ltc_file_header.h
+ * @brief LTCFileHeader struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_LTC_FILE_HEADER_H_
+#define BGQ_OPENGL_STRUCT_LTC_FILE_HEADER_H_
+
+#define LTC_FILE_MAGIC "LTCT"
+#define LTC_FILE_VERSION 1
+#define LTC_FILE_ALIGNMENT 16
+
+#define LTC_PRECISION_FLOAT32 0
+
+#include <stdint.h>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Header of a binary LTC table file.
+	 *
+	 * This Struct is written at the start of every .ltc file, little endian,
+	 * and tells how the texels after it are laid out. They are stored as
+	 * LTCTable describes them, starting at data_offset, so they can be mapped
+	 * and uploaded without copying.
+	 */
+	struct LTCFileHeader {
+
+		char magic[4];				// LTC_FILE_MAGIC, without the terminator.
+		uint32_t version;			// LTC_FILE_VERSION of the writer.
+		uint32_t width;				// Texels per row.
+		uint32_t height;			// Rows.
+		uint32_t channels;			// Channels per texel.
+		uint32_t precision;			// How every channel is stored, LTC_PRECISION_FLOAT32.
+		uint32_t data_offset;		// Bytes from the start of the file to the texels, a multiple of LTC_FILE_ALIGNMENT.
+		uint32_t data_size;			// Bytes of texels.
+
+	};
+
+	static_assert(sizeof(LTCFileHeader) == 32, "The LTC file header has to be 32 bytes.");
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_LTC_FILE_HEADER_H_
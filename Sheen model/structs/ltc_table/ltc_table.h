@@ -0,0 +1,41 @@
+/**
+ * @file ltc_table.h
+ * @brief LTCTable struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_LTC_TABLE_H_
+#define BGQ_OPENGL_STRUCT_LTC_TABLE_H_
+
+#include <stddef.h>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief A lookup table of the LTC model.
+	 *
+	 * This Struct points to the texels of a lookup table, laid out as they
+	 * are uploaded to OpenGL: row after row starting from v = 0, with the
+	 * channels of every texel next to each other. It does not own them.
+	 */
+	struct LTCTable {
+
+		const float *data = NULL;	// The texels.
+		int width = 0;				// Texels per row.
+		int height = 0;				// Rows.
+		int channels = 0;			// Channels per texel.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_LTC_TABLE_H_
@@ -0,0 +1,52 @@
+/**
+ * @file material_block.h
+ * @brief Material uniform block struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_MATERIALBLOCK_H_
+#define BGQ_OPENGL_STRUCT_MATERIALBLOCK_H_
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief The material uniform block.
+	 *
+	 * This Struct mirrors the std140 layout of the MaterialBlock in ltc.frag.
+	 * Each vec3 is followed by a float that fills the rest of its 16 bytes, and
+	 * bools take 4 bytes like ints.
+	 */
+	struct MaterialBlock {
+
+		glm::vec3 alt_diffuse = glm::vec3(0.0f);		/// Constant base color when use_alt is set.
+		float roughness = 0.0f;							/// Roughness of the material.
+		glm::vec3 alt_normal = glm::vec3(0.0f);			/// Constant tangent-space normal when use_alt is set.
+		float specular_mult = 0.0f;						/// Multiplier for the specular map.
+		glm::vec3 alt_specular = glm::vec3(0.0f);		/// Constant specular when use_alt is set.
+		float alpha = 0.0f;								/// Roughness of the Zeltner sheen.
+		float beta = 0.0f;								/// Falloff of the cosine-based sheen.
+		float csheen = 0.0f;							/// Scale of the sheen.
+		GLint sheen_type = 0;							/// Sheen model (0 none, 1 Zeltner, 2 cosine-based).
+		GLint use_alt = 0;								/// Whether to use the constant material.
+		GLint dust = 0;									/// Whether the sheen is applied as dust.
+		GLint padding[3] = {0, 0, 0};					/// The block size is rounded up to 16 bytes.
+
+	};
+
+	static_assert(sizeof(MaterialBlock) == 80, "MaterialBlock does not match the std140 layout.");
+
+} // namespace bgq_opengl
+
+#endif //!BGQ_OPENGL_STRUCT_MATERIALBLOCK_H_
@@ -0,0 +1,48 @@
+/**
+ * @file mesh_cache_entry.h
+ * @brief MeshCacheEntry struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_MESH_CACHE_ENTRY_H_
+#define BGQ_OPENGL_STRUCT_MESH_CACHE_ENTRY_H_
+
+#include <stdint.h>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief One geometry in a mesh cache file.
+	 *
+	 * This Struct describes one geometry of a mesh cache. The vertices are
+	 * the final interleaved Vertex array and the indices are GLuint, both at
+	 * offsets aligned to MESH_CACHE_ALIGNMENT so they can be uploaded
+	 * straight from the mapped file.
+	 */
+	struct MeshCacheEntry {
+
+		uint64_t vertex_offset;		// Bytes from the start of the file to the vertices.
+		uint64_t index_offset;		// Bytes from the start of the file to the indices.
+		uint32_t vertex_count;		// Number of vertices.
+		uint32_t index_count;		// Number of indices.
+		float shininess;			// Shininess of the material.
+		float min[3];				// Minimum vertex of the bounding box.
+		float max[3];				// Maximum vertex of the bounding box.
+		uint32_t padding;			// Keeps the entries 8-byte aligned.
+
+	};
+
+	static_assert(sizeof(MeshCacheEntry) == 56, "A mesh cache entry has to be 56 bytes.");
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_MESH_CACHE_ENTRY_H_
@@ -0,0 +1,53 @@
+/**
+ * @file mesh_cache_header.h
+ * @brief MeshCacheHeader struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_MESH_CACHE_HEADER_H_
+#define BGQ_OPENGL_STRUCT_MESH_CACHE_HEADER_H_
+
+#define MESH_CACHE_MAGIC "MSHC"
+#define MESH_CACHE_VERSION 1
+#define MESH_CACHE_ALIGNMENT 16
+#define MESH_CACHE_EXTENSION ".meshcache"
+
+#include <stdint.h>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Header of a binary mesh cache file.
+	 *
+	 * This Struct is written at the start of every mesh cache, little endian.
+	 * It says which model and import the cache was made from, so a stale one
+	 * is never used, and where the MeshCacheEntry of every geometry is.
+	 */
+	struct MeshCacheHeader {
+
+		char magic[4];				// MESH_CACHE_MAGIC, without the terminator.
+		uint32_t version;			// MESH_CACHE_VERSION of the writer.
+		uint32_t vertex_size;		// sizeof(Vertex) of the writer, so a new layout is never read as the old one.
+		uint32_t import_flags;		// Assimp post-processing flags the model was imported with.
+		uint64_t source_hash;		// Hash of the contents of the model file.
+		uint64_t source_size;		// Bytes of the model file.
+		uint64_t file_size;			// Bytes of the whole cache, to tell a truncated one.
+		uint32_t geometry_count;	// Number of entries.
+		uint32_t entry_offset;		// Bytes from the start of the file to the first entry.
+
+	};
+
+	static_assert(sizeof(MeshCacheHeader) == 48, "The mesh cache header has to be 48 bytes.");
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_MESH_CACHE_HEADER_H_
@@ -0,0 +1,46 @@
+/**
+ * @file mesh_data.h
+ * @brief MeshData struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_MESH_DATA_H_
+#define BGQ_OPENGL_STRUCT_MESH_DATA_H_
+
+#include <vector>
+
+#include "GL/glew.h"
+
+#include "structs/bounding_box/bounding_box.h"
+#include "structs/vertex/vertex.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief A mesh imported but not uploaded yet.
+	 *
+	 * This Struct holds one mesh of a model on the CPU, already converted to
+	 * the layout Geometry uploads, so the import can run on any thread and
+	 * only the upload on the one that owns the context.
+	 */
+	struct MeshData {
+
+		std::vector<Vertex> vertices;	// Interleaved vertices.
+		std::vector<GLuint> indices;	// Indices, three per triangle.
+		float shininess = 0.0f;			// Shininess of the material.
+		BoundingBox bounding_box;		// Bounding box of the vertices.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_MESH_DATA_H_
@@ -0,0 +1,73 @@
+/**
+ * @file packed_vertex.h
+ * @brief PackedVertex structs header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_PACKED_VERTEX_H_
+#define BGQ_OPENGL_STRUCT_PACKED_VERTEX_H_
+
+#include <stdint.h>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Layouts the vertices can be uploaded in.
+	 *
+	 * Layouts the vertex buffers can have. The CPU copies are always Vertex.
+	 */
+	enum VertexFormat {
+
+		VERTEX_FORMAT_FULL,			// Vertex as it is, every attribute in 32-bit floats.
+		VERTEX_FORMAT_HALF,			// PackedVertexHalf.
+		VERTEX_FORMAT_FLOAT			// PackedVertexFloat.
+
+	};
+
+	/**
+	 * @brief A compact vertex with a 16-bit position.
+	 *
+	 * This Struct is a Vertex packed to 20 bytes. The normal and tangent are
+	 * octahedral-encoded as normalized shorts, and the bitangent is rebuilt
+	 * from them and the sign kept in the w of the position. The color is the
+	 * same for the whole mesh, so it is not stored per vertex.
+	 */
+	struct PackedVertexHalf {
+
+		uint16_t position[4];	// Position in half floats, and the bitangent sign in w.
+		int16_t normal[2];		// Octahedral normal.
+		int16_t tangent[2];		// Octahedral tangent.
+		uint16_t uv[2];			// UV coordinates in half floats.
+
+	};
+
+	/**
+	 * @brief A compact vertex with a 32-bit position.
+	 *
+	 * This Struct is PackedVertexHalf with the position kept in full
+	 * precision, for meshes too large or too detailed for half floats.
+	 */
+	struct PackedVertexFloat {
+
+		float position[4];		// Position, and the bitangent sign in w.
+		int16_t normal[2];		// Octahedral normal.
+		int16_t tangent[2];		// Octahedral tangent.
+		uint16_t uv[2];			// UV coordinates in half floats.
+
+	};
+
+	static_assert(sizeof(PackedVertexHalf) == 20, "The half packed vertex has to be 20 bytes.");
+	static_assert(sizeof(PackedVertexFloat) == 28, "The float packed vertex has to be 28 bytes.");
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_PACKED_VERTEX_H_
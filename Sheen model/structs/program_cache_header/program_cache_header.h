@@ -0,0 +1,51 @@
+/**
+ * @file program_cache_header.h
+ * @brief Program cache header struct file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_PROGRAM_CACHE_HEADER_H_
+#define BGQ_OPENGL_STRUCT_PROGRAM_CACHE_HEADER_H_
+
+#define PROGRAM_CACHE_MAGIC "PRGC"
+#define PROGRAM_CACHE_VERSION 1
+#define PROGRAM_CACHE_EXTENSION ".programcache"
+
+#include <stdint.h>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief Header of a program binary cache file.
+	 *
+	 * This Struct is written at the start of every program cache, followed
+	 * by the binary the driver gave. It says which sources and which driver
+	 * the binary was made from, so a stale one is never loaded.
+	 */
+	struct ProgramCacheHeader {
+
+		char magic[4];				// PROGRAM_CACHE_MAGIC, without the terminator.
+		uint32_t version;			// PROGRAM_CACHE_VERSION of the writer.
+		uint64_t source_hash;		// Hash of both sources, with the defines of the permutation in them.
+		uint64_t driver_hash;		// Hash of the GL vendor, renderer and version.
+		uint32_t binary_format;		// Format of the binary, as the driver gave it.
+		uint32_t binary_size;		// Bytes of the binary.
+		uint64_t binary_hash;		// Hash of the binary, to tell a corrupted one.
+		uint64_t file_size;			// Bytes of the whole cache, to tell a truncated one.
+
+	};
+
+	static_assert(sizeof(ProgramCacheHeader) == 48, "The program cache header has to be 48 bytes.");
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_PROGRAM_CACHE_HEADER_H_
@@ -0,0 +1,41 @@
+/**
+ * @file scene_draw.h
+ * @brief SceneDraw struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_SCENE_DRAW_H_
+#define BGQ_OPENGL_STRUCT_SCENE_DRAW_H_
+
+#include "structs/material_block/material_block.h"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief An object of the scene and how to draw it.
+	 *
+	 * This Struct tells the renderers which object of the selected scene to
+	 * draw, with which material and which textures, so the OpenGL and the
+	 * software paths draw the same thing.
+	 */
+	struct SceneDraw {
+
+		int object = 0;				// Index of the object in the scene.
+		MaterialBlock material;		// Its material.
+		int textures = -1;			// First of its diffuse, normal and specular textures, or -1 if it has none.
+		bool instanced = false;		// Whether to draw all the instances of the object in one call, on the GL path.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_SCENE_DRAW_H_
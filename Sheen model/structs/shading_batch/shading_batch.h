@@ -0,0 +1,64 @@
+/**
+ * @file shading_batch.h
+ * @brief ShadingBatch struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_SHADING_BATCH_H_
+#define BGQ_OPENGL_STRUCT_SHADING_BATCH_H_
+
+#include <vector>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief A batch of shading points.
+	 *
+	 * This Struct holds the shading points of a batch as a structure of
+	 * arrays, one array per component, so SIMD kernels load several points
+	 * at once. The positions and normals are in world space, and the normals
+	 * are the ones the fragment shader ends up with, after normal mapping
+	 * and flipping the front faces. The diffuse and specular colors are only
+	 * read for materials that do not use the alt values, and the specular has
+	 * to be already multiplied by the specular multiplier. The color is the
+	 * output, as the fragment shader would write it.
+	 */
+	struct ShadingBatch {
+
+		std::vector<float> px, py, pz;	// Positions.
+		std::vector<float> nx, ny, nz;	// Normals.
+		std::vector<float> dr, dg, db;	// Diffuse colors.
+		std::vector<float> sr, sg, sb;	// Specular colors.
+		std::vector<float> r, g, b;		// Output colors.
+
+		// Get the number of points.
+		size_t size() const {
+
+			return this->px.size();
+
+		}
+
+		// Resize every array to hold a number of points.
+		void resize(size_t count) {
+
+			std::vector<float>* arrays[15] = {&px, &py, &pz, &nx, &ny, &nz, &dr, &dg, &db, &sr, &sg, &sb, &r, &g, &b};
+
+			for (int i = 0; i < 15; i++)
+				arrays[i]->resize(count, 0.0f);
+
+		}
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_SHADING_BATCH_H_
@@ -0,0 +1,43 @@
+/**
+ * @file sweep_point.h
+ * @brief SweepPoint struct header file.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_SWEEP_POINT_H_
+#define BGQ_OPENGL_STRUCT_SWEEP_POINT_H_
+
+#include <string>
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief A combination of parameters of a sweep.
+	 *
+	 * This Struct holds the value of every parameter of the sheen model for
+	 * one of the images of a sweep, and the name the image is saved with.
+	 */
+	struct SweepPoint {
+
+		float alpha = 0.5f;			// Alpha of the sheen model.
+		float beta = 0.5f;			// Beta of the cosine-based sheen.
+		float csheen = 0.5f;		// Sheen coefficient.
+		int sheen_type = 2;			// 0 for none, 1 for Zeltner, 2 for cosine-based.
+		float roughness = 1.0f;		// Roughness of the fabric.
+		float intensity = 10.0f;	// Intensity of the area light.
+		std::string name;			// Name of the image, without folder or extension.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_SWEEP_POINT_H_
@@ -0,0 +1,45 @@
+/**
+ * @file timeline_sample.h
+ * @brief Timeline sample structure.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ */
+
+#ifndef BGQ_OPENGL_STRUCT_TIMELINE_SAMPLE_H_
+#define BGQ_OPENGL_STRUCT_TIMELINE_SAMPLE_H_
+
+#include "glm/glm.hpp"
+
+namespace bgq_opengl {
+
+	/**
+	 * @brief The camera and parameters at a point of a timeline.
+	 *
+	 * This Struct holds where the camera is and what it looks at, and the
+	 * value of every parameter of the sheen model, at one point in time of a
+	 * scripted timeline.
+	 */
+	struct TimelineSample {
+
+		glm::vec3 position = glm::vec3(0.0f, 0.5f, 1.4f);	// Coordinates of the camera.
+		glm::vec3 target = glm::vec3(0.0f, 0.25f, 0.4f);	// Point the camera looks at.
+		float alpha = 0.5f;									// Alpha of the sheen model.
+		float beta = 0.5f;									// Beta of the cosine-based sheen.
+		float csheen = 0.5f;								// Sheen coefficient.
+		int sheen_type = 2;									// 0 for none, 1 for Zeltner, 2 for cosine-based.
+		float roughness = 1.0f;								// Roughness of the fabric.
+		float intensity = 10.0f;							// Intensity of the area light.
+
+	};
+
+}  // namespace bgq_opengl
+
+#endif  //!BGQ_OPENGL_STRUCT_TIMELINE_SAMPLE_H_
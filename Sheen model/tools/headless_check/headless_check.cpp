@@ -0,0 +1,241 @@
+/**
+ * @file headless_check.cpp
+ * @brief End to end check of the headless frame output.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ *
+ * This is a separate program, not part of the viewer. It opens an
+ * OffscreenContext, clears a Framebuffer to a different color every frame,
+ * with a marker in the top left corner, and sends the frames through a
+ * FrameReader and a FrameWriter the same way --headless does. It renders more
+ * frames than the PBO ring holds, so the ring wraps. Then it decodes every PNG
+ * and checks each pixel, which also checks that the rows are flipped. Build it
+ * from the "Sheen model" folder:
+ *
+ *     c++ -std=c++11 -O2 -DBGQ_OPENGL_EGL -I. tools/headless_check/headless_check.cpp \
+ *         classes/offscreen_context/offscreen_context.cpp \
+ *         classes/framebuffer/framebuffer.cpp \
+ *         classes/frame_reader/frame_reader.cpp \
+ *         classes/frame_writer/frame_writer.cpp \
+ *         classes/png_writer/png_writer.cpp -lGLEW -lglfw -lEGL -lGL -lpthread -o headless_check
+ *     ./headless_check /tmp
+ */
+
+#include <stdlib.h>
+
+#include <iostream>
+#include <string>
+#include <utility>
+
+#include "GL/glew.h"
+
+#include "classes/frame_reader/frame_reader.h"
+#include "classes/frame_writer/frame_writer.h"
+#include "classes/framebuffer/framebuffer.h"
+#include "classes/offscreen_context/offscreen_context.h"
+#include "structs/frame/frame.h"
+
+#define STB_IMAGE_IMPLEMENTATION
+#include "stb/stb_image.h"
+
+#define CHECK_WIDTH 1200		/// Width of the frames, as WINDOW_WIDTH.
+#define CHECK_HEIGHT 800		/// Height of the frames, as WINDOW_HEIGHT.
+#define CHECK_FRAMES 8			/// Frames rendered, more than the ring holds.
+#define CHECK_RING 3			/// Size of the PBO ring, as PBO_RING_SIZE.
+#define CHECK_MARKER_WIDTH 100	/// Width of the marker in the top left corner.
+#define CHECK_MARKER_HEIGHT 50	/// Height of the marker in the top left corner.
+
+/**
+ * @brief Color of a frame.
+ *
+ * Get a channel of the background or the marker of a frame. Every frame and
+ * channel gets a different 8-bit value, so a swapped or repeated frame shows.
+ *
+ * @param frame The frame.
+ * @param channel The channel, 0 to 2.
+ * @param marker Whether this is the marker instead of the background.
+ * @returns The 8-bit value.
+ */
+unsigned char getColor(int frame, int channel, bool marker) {
+
+	if (marker)
+		return (unsigned char) (255 - (frame * 20 + channel * 70) % 256);
+
+	return (unsigned char) ((frame * 30 + channel * 50 + 10) % 256);
+
+}
+
+/**
+ * @brief Queue a frame.
+ *
+ * Request the current frame and hand every finished one to the writer, as
+ * queueFrame in main.cpp.
+ *
+ * @param reader The reader.
+ * @param writer The writer.
+ * @param filename Name of the file.
+ */
+void queueFrame(bgq_opengl::FrameReader &reader, bgq_opengl::FrameWriter &writer, const std::string &filename) {
+
+	bgq_opengl::Frame frame;
+
+	if (reader.isFull() && reader.collect(&frame, true))
+		writer.push(std::move(frame));
+
+	reader.request(filename);
+
+	while (reader.collect(&frame, false))
+		writer.push(std::move(frame));
+
+}
+
+/**
+ * @brief Drain the reader.
+ *
+ * Wait for every pending frame and hand it to the writer, as drainFrames in
+ * main.cpp.
+ *
+ * @param reader The reader.
+ * @param writer The writer.
+ */
+void drainFrames(bgq_opengl::FrameReader &reader, bgq_opengl::FrameWriter &writer) {
+
+	bgq_opengl::Frame frame;
+
+	while (reader.getPending() > 0)
+		if (reader.collect(&frame, true))
+			writer.push(std::move(frame));
+
+}
+
+/**
+ * @brief Check a file.
+ *
+ * Decode a PNG and count the channels that differ from what was cleared.
+ *
+ * @param filename Name of the file.
+ * @param frame The frame it holds.
+ * @returns The number of channels that differ, or -1 if it cannot be read.
+ */
+long checkFile(const std::string &filename, int frame) {
+
+	int width, height, channels;
+	unsigned char *pixels = stbi_load(filename.c_str(), &width, &height, &channels, 4);
+
+	if (pixels == NULL)
+		return -1;
+
+	if (width != CHECK_WIDTH || height != CHECK_HEIGHT) {
+
+		stbi_image_free(pixels);
+		return -1;
+
+	}
+
+	// The image goes top row first, so the marker is in the first rows.
+	long wrong = 0;
+
+	for (int y = 0; y < height; y++) {
+		for (int x = 0; x < width; x++) {
+
+			unsigned char *pixel = pixels + ((size_t) y * width + x) * 4;
+			bool marker = x < CHECK_MARKER_WIDTH && y < CHECK_MARKER_HEIGHT;
+
+			for (int c = 0; c < 3; c++)
+				if (pixel[c] != getColor(frame, c, marker))
+					wrong++;
+
+			if (pixel[3] != 255)
+				wrong++;
+
+		}
+	}
+
+	stbi_image_free(pixels);
+
+	return wrong;
+
+}
+
+/**
+ * @brief Main function.
+ *
+ * Render the frames, write them and check them.
+ *
+ * @param argc Number of arguments.
+ * @param argv The folder to write the frames to, the current one by default.
+ * @returns 0 if every frame is right, 1 otherwise.
+ */
+int main(int argc, char** argv) {
+
+	std::string folder = argc > 1 ? argv[1] : ".";
+
+	bgq_opengl::OffscreenContext context;
+	std::cout << "Context: " << (context.isSurfaceless() ? "EGL surfaceless" : "hidden window") << ", " << glGetString(GL_RENDERER) << ", " << glGetString(GL_VERSION) << std::endl;
+
+	bgq_opengl::Framebuffer *framebuffer = new bgq_opengl::Framebuffer(CHECK_WIDTH, CHECK_HEIGHT);
+	bgq_opengl::FrameReader *reader = new bgq_opengl::FrameReader(CHECK_WIDTH, CHECK_HEIGHT, CHECK_RING);
+	bgq_opengl::FrameWriter *writer = new bgq_opengl::FrameWriter(2, 2 * CHECK_RING);
+
+	for (int i = 0; i < CHECK_FRAMES; i++) {
+
+		framebuffer->bind();
+
+		glDisable(GL_SCISSOR_TEST);
+		glClearColor(getColor(i, 0, false) / 255.0f, getColor(i, 1, false) / 255.0f, getColor(i, 2, false) / 255.0f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+
+		// GL counts rows from the bottom, so the top left corner starts at the last rows.
+		glEnable(GL_SCISSOR_TEST);
+		glScissor(0, CHECK_HEIGHT - CHECK_MARKER_HEIGHT, CHECK_MARKER_WIDTH, CHECK_MARKER_HEIGHT);
+		glClearColor(getColor(i, 0, true) / 255.0f, getColor(i, 1, true) / 255.0f, getColor(i, 2, true) / 255.0f, 1.0f);
+		glClear(GL_COLOR_BUFFER_BIT);
+		glDisable(GL_SCISSOR_TEST);
+
+		queueFrame(*reader, *writer, folder + "/check_" + std::to_string(i) + ".png");
+
+	}
+
+	drainFrames(*reader, *writer);
+	writer->finish();
+
+	std::cout << "Frames written: " << writer->getWritten() << ", failed: " << writer->getFailed() << ", GL error: " << glGetError() << std::endl;
+
+	reader->remove();
+	framebuffer->remove();
+	delete reader;
+	delete framebuffer;
+	delete writer;
+	context.remove();
+
+	// Check every file.
+	int failed = 0;
+
+	for (int i = 0; i < CHECK_FRAMES; i++) {
+
+		std::string filename = folder + "/check_" + std::to_string(i) + ".png";
+		long wrong = checkFile(filename, i);
+
+		if (wrong < 0)
+			std::cout << filename << ": cannot be read or has the wrong size" << std::endl;
+		else
+			std::cout << filename << ": " << wrong << " wrong channels" << std::endl;
+
+		if (wrong != 0)
+			failed++;
+
+	}
+
+	std::cout << (failed == 0 ? "OK" : "FAILED") << std::endl;
+
+	return failed == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+
+}
@@ -0,0 +1,108 @@
+/**
+ * @file ltc_converter.cpp
+ * @brief Offline converter from ltc_matrix_data.h to binary LTC tables.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ *
+ * This is a separate program, not part of the viewer. It is the only file
+ * that still compiles the tables in, and writes ltc_1.ltc, ltc_2.ltc and
+ * ltc_sheen.ltc for LTCFile to map. Build it from the "Sheen model" folder:
+ *
+ *     c++ -std=c++11 -I. tools/ltc_converter/ltc_converter.cpp -o ltc_converter
+ *     ./ltc_converter tables
+ */
+
+#include <stdint.h>
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "classes/ltc_matrix/ltc_matrix_data.h"
+#include "structs/ltc_file_header/ltc_file_header.h"
+
+/**
+ * @brief Write a table file.
+ *
+ * Write a table as a binary LTC file: the header, padding up to the
+ * alignment and the texels as they are.
+ *
+ * @param filename Name of the file.
+ * @param data The texels.
+ * @param count Number of floats in data.
+ * @param width Texels per row.
+ * @param height Rows.
+ * @param channels Channels per texel.
+ *
+ * @returns True if the file was written.
+ */
+bool writeTable(const std::string& filename, const float* data, size_t count, int width, int height, int channels) {
+
+	// The array has to have exactly the shape it is going to be uploaded with.
+	if (count != (size_t) width * height * channels) {
+
+		std::cerr << "LTC converter error: " << filename << " should have " << width * height * channels << " floats, not " << count << "." << std::endl;
+		return false;
+
+	}
+
+	// Fill the header in. The texels start at the first aligned offset after it.
+	bgq_opengl::LTCFileHeader header;
+	memcpy(header.magic, LTC_FILE_MAGIC, 4);
+	header.version = LTC_FILE_VERSION;
+	header.width = width;
+	header.height = height;
+	header.channels = channels;
+	header.precision = LTC_PRECISION_FLOAT32;
+	header.data_offset = (sizeof(header) + LTC_FILE_ALIGNMENT - 1) / LTC_FILE_ALIGNMENT * LTC_FILE_ALIGNMENT;
+	header.data_size = (uint32_t) (count * sizeof(float));
+
+	std::vector<unsigned char> padding(header.data_offset - sizeof(header), 0);
+
+	// Write everything.
+	FILE* file = fopen(filename.c_str(), "wb");
+
+	if (file == NULL) {
+
+		std::cerr << "LTC converter error: could not open " << filename << "." << std::endl;
+		return false;
+
+	}
+
+	bool written = fwrite(&header, sizeof(header), 1, file) == 1;
+	written = written && fwrite(padding.data(), 1, padding.size(), file) == padding.size();
+	written = written && fwrite(data, sizeof(float), count, file) == count;
+	written = fclose(file) == 0 && written;
+
+	if (!written)
+		std::cerr << "LTC converter error: could not write " << filename << "." << std::endl;
+	else
+		std::cout << "Wrote " << filename << ": " << width << "x" << height << ", " << channels << " channels." << std::endl;
+
+	return written;
+
+}
+
+int main(int argc, char** argv) {
+
+	// The tables are written to the given folder, or the current one.
+	std::string folder = argc > 1 ? argv[1] : ".";
+
+	// Same shapes the tables have always been uploaded with.
+	bool written = writeTable(folder + "/ltc_1.ltc", mat_ltc_1, sizeof(mat_ltc_1) / sizeof(float), 64, 64, 4);
+	written = writeTable(folder + "/ltc_2.ltc", mat_ltc_2, sizeof(mat_ltc_2) / sizeof(float), 64, 64, 4) && written;
+	written = writeTable(folder + "/ltc_sheen.ltc", mat_ltc_sheen, sizeof(mat_ltc_sheen) / sizeof(float), 32, 32, 3) && written;
+
+	return written ? 0 : 1;
+
+}
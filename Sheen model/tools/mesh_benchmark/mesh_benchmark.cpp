@@ -0,0 +1,335 @@
+/**
+ * @file mesh_benchmark.cpp
+ * @brief Microbenchmark of the Assimp mesh conversion.
+ * @version 1.0.0 (2026-10-16)
+ * @date 2026-10-16
+ * @author Borja García Quiroga <garcaqub@tcd.ie>
+ *
+ *
+ * Copyright (c) Borja García Quiroga, All Rights Reserved.
+ *
+ * The information and material provided below was developed as partial
+ * requirements for the MSc in Computer Science at Trinity College Dublin,
+ * Ireland.
+ *
+ * This is a separate program, not part of the viewer. It imports every model
+ * once and times converting its meshes to Vertex arrays the old way, a vertex
+ * at a time with push_back, and with MeshConverter on one and on several
+ * threads, checking they all give the same result. It also packs them in
+ * every VertexFormat and prints how much each loses. Build it from the
+ * "Sheen model" folder:
+ *
+ *     c++ -std=c++11 -O2 -I. tools/mesh_benchmark/mesh_benchmark.cpp \
+ *         classes/mesh_converter/mesh_converter.cpp \
+ *         classes/thread_pool/thread_pool.cpp \
+ *         classes/vertex_packer/vertex_packer.cpp -lassimp -lpthread -o mesh_benchmark
+ *     ./mesh_benchmark ../Models/Scene\ 1/cloth.glb ../Models/Scene\ 2/fabric_front.glb
+ */
+
+#include <math.h>
+#include <stdlib.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "GL/glew.h"
+#include "glm/glm.hpp"
+#include "assimp/cimport.h"
+#include "assimp/postprocess.h"
+#include "assimp/scene.h"
+
+#include "classes/mesh_converter/mesh_converter.h"
+#include "classes/thread_pool/thread_pool.h"
+#include "classes/vertex_packer/vertex_packer.h"
+#include "structs/mesh_data/mesh_data.h"
+#include "structs/packed_vertex/packed_vertex.h"
+#include "structs/vertex/vertex.h"
+
+/**
+ * @brief Convert a mesh the old way.
+ *
+ * Convert a mesh as LoaderAssimp::loadGeometry used to, growing the arrays a
+ * vertex and a face at a time, without its logging.
+ *
+ * @param scene The scene the mesh is in.
+ * @param mesh The mesh.
+ * @param data Outputs the converted mesh.
+ */
+void convertLegacy(const aiScene* scene, const aiMesh* mesh, bgq_opengl::MeshData* data) {
+
+	aiMaterial* mat = scene->mMaterials[mesh->mMaterialIndex];
+	aiColor3D color;
+	mat->Get(AI_MATKEY_COLOR_DIFFUSE, color);
+	float shine = 0.0;
+	mat->Get(AI_MATKEY_SHININESS, shine);
+
+	std::vector<bgq_opengl::Vertex> vertices(0);
+	std::vector<GLuint> indices(0);
+
+	for (unsigned int i = 0; i < mesh->mNumVertices; i++) {
+
+		bgq_opengl::Vertex vertex{
+			glm::vec3(0.0f, 0.0f, 0.0f),
+			glm::vec3(1.0f, 1.0f, 1.0f),
+			glm::vec3(0.0f, 0.0f, 1.0f),
+			glm::vec2(0.0f, 0.0f),
+			glm::vec3(0.0f, 1.0f, 0.0f),
+			glm::vec3(1.0f, 0.0f, 0.0f)
+		};
+
+		if (mesh->HasPositions())
+			vertex.position = glm::vec3(mesh->mVertices[i].x, mesh->mVertices[i].y, mesh->mVertices[i].z);
+
+		vertex.color = glm::vec3(color.r, color.g, color.b);
+
+		if (mesh->HasNormals())
+			vertex.normal = glm::vec3(mesh->mNormals[i].x, mesh->mNormals[i].y, mesh->mNormals[i].z);
+
+		if (mesh->HasTextureCoords(0))
+			vertex.uv = glm::vec2(-mesh->mTextureCoords[0][i].y, mesh->mTextureCoords[0][i].x);
+
+		if (mesh->HasTangentsAndBitangents()) {
+
+			vertex.tangent = glm::vec3(mesh->mTangents[i].x, mesh->mTangents[i].y, mesh->mTangents[i].z);
+			vertex.bitangent = glm::vec3(mesh->mBitangents[i].x, mesh->mBitangents[i].y, mesh->mBitangents[i].z);
+
+		}
+
+		vertices.push_back(vertex);
+
+	}
+
+	for (unsigned int j = 0; j < mesh->mNumFaces; j++) {
+
+		indices.push_back(mesh->mFaces[j].mIndices[0]);
+		indices.push_back(mesh->mFaces[j].mIndices[1]);
+		indices.push_back(mesh->mFaces[j].mIndices[2]);
+
+	}
+
+	data->vertices = vertices;
+	data->indices = indices;
+	data->shininess = shine;
+
+}
+
+/**
+ * @brief Time a conversion.
+ *
+ * Convert every mesh of a scene some times and keep the fastest run.
+ *
+ * @param scene The scene.
+ * @param runs Number of runs.
+ * @param convert Converts one mesh.
+ * @param meshes Outputs the meshes of the last run.
+ *
+ * @returns The fastest run, in milliseconds.
+ */
+template <typename Function>
+double timeConversion(const aiScene* scene, int runs, Function convert, std::vector<bgq_opengl::MeshData>* meshes) {
+
+	double best = 0.0;
+
+	for (int run = 0; run < runs; run++) {
+
+		meshes->clear();
+		meshes->resize(scene->mNumMeshes);
+
+		auto start = std::chrono::steady_clock::now();
+
+		for (unsigned int i = 0; i < scene->mNumMeshes; i++)
+			convert(scene->mMeshes[i], &(*meshes)[i]);
+
+		double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+		best = run == 0 ? ms : std::min(best, ms);
+
+	}
+
+	return best;
+
+}
+
+/**
+ * @brief Whether two conversions are the same.
+ *
+ * Whether two conversions have the same vertices, bit for bit, and indices.
+ *
+ * @param a The first conversion.
+ * @param b The second conversion.
+ *
+ * @returns True if they are the same.
+ */
+bool sameMeshes(const std::vector<bgq_opengl::MeshData>& a, const std::vector<bgq_opengl::MeshData>& b) {
+
+	if (a.size() != b.size())
+		return false;
+
+	for (size_t i = 0; i < a.size(); i++) {
+
+		if (a[i].vertices.size() != b[i].vertices.size() || a[i].indices != b[i].indices || a[i].shininess != b[i].shininess)
+			return false;
+
+		if (memcmp(a[i].vertices.data(), b[i].vertices.data(), a[i].vertices.size() * sizeof(bgq_opengl::Vertex)) != 0)
+			return false;
+
+	}
+
+	return true;
+
+}
+
+/**
+ * @brief Get the angle between two directions.
+ *
+ * Get the angle between two directions, which do not have to be normalized.
+ *
+ * @param a The first direction.
+ * @param b The second direction.
+ *
+ * @returns The angle in degrees, or 0 if either is zero.
+ */
+float angleBetween(const glm::vec3& a, const glm::vec3& b) {
+
+	float lengths = glm::length(a) * glm::length(b);
+
+	if (lengths == 0.0f)
+		return 0.0f;
+
+	return glm::degrees(acosf(glm::clamp(glm::dot(a, b) / lengths, -1.0f, 1.0f)));
+
+}
+
+/**
+ * @brief Print how much the packed layouts lose.
+ *
+ * Pack the meshes in every compact VertexFormat, decode them back as the
+ * vertex shader does, and print the bytes and the largest errors.
+ *
+ * @param meshes The meshes.
+ */
+void reportPacking(const std::vector<bgq_opengl::MeshData>& meshes) {
+
+	const bgq_opengl::VertexFormat formats[] = {bgq_opengl::VERTEX_FORMAT_HALF, bgq_opengl::VERTEX_FORMAT_FLOAT};
+
+	for (size_t f = 0; f < sizeof(formats) / sizeof(formats[0]); f++) {
+
+		size_t stride = bgq_opengl::VertexPacker::getStride(formats[f]);
+		float position = 0.0f, normal = 0.0f, tangent = 0.0f, bitangent = 0.0f, uv = 0.0f;
+		size_t vertices = 0;
+
+		for (size_t i = 0; i < meshes.size(); i++) {
+
+			std::vector<unsigned char> bytes;
+			bgq_opengl::VertexPacker::pack(meshes[i].vertices.data(), meshes[i].vertices.size(), formats[f], &bytes);
+
+			for (size_t j = 0; j < meshes[i].vertices.size(); j++) {
+
+				const bgq_opengl::Vertex& original = meshes[i].vertices[j];
+				bgq_opengl::Vertex decoded = bgq_opengl::VertexPacker::decode(bytes.data() + j * stride, formats[f]);
+
+				// The bitangent is compared to the one rebuilt from the original normal and tangent, which is all the sign can give.
+				glm::vec3 rebuilt = glm::cross(original.normal, original.tangent) * (glm::dot(glm::cross(original.normal, original.tangent), original.bitangent) < 0.0f ? -1.0f : 1.0f);
+
+				position = std::max(position, glm::length(decoded.position - original.position));
+				normal = std::max(normal, angleBetween(decoded.normal, original.normal));
+				tangent = std::max(tangent, angleBetween(decoded.tangent, original.tangent));
+				bitangent = std::max(bitangent, angleBetween(decoded.bitangent, rebuilt));
+				uv = std::max(uv, glm::length(decoded.uv - original.uv));
+
+			}
+
+			vertices += meshes[i].vertices.size();
+
+		}
+
+		std::cout << "  " << bgq_opengl::VertexPacker::getFormatName(formats[f]) << ": " << stride << " bytes per vertex, " << vertices * stride / 1024 << " KiB instead of " << vertices * sizeof(bgq_opengl::Vertex) / 1024 << " KiB" << std::endl;
+		std::cout << "    max error: position " << position << ", normal " << normal << " deg, tangent " << tangent << " deg, bitangent " << bitangent << " deg, uv " << uv << std::endl;
+
+	}
+
+}
+
+int main(int argc, char** argv) {
+
+	// Read the options, the rest are the models.
+	int runs = 20;
+	int threads = std::max(1, (int) std::thread::hardware_concurrency());
+	std::vector<std::string> files;
+
+	for (int i = 1; i < argc; i++) {
+
+		std::string option = argv[i];
+
+		if (option == "--runs" && i + 1 < argc)
+			runs = std::max(1, atoi(argv[++i]));
+		else if (option == "--threads" && i + 1 < argc)
+			threads = std::max(1, atoi(argv[++i]));
+		else
+			files.push_back(option);
+
+	}
+
+	if (files.empty()) {
+
+		files.push_back("cloth.glb");
+		files.push_back("fabric_front.glb");
+
+	}
+
+	bgq_opengl::ThreadPool pool(threads);
+	bool same = true;
+
+	for (size_t f = 0; f < files.size(); f++) {
+
+		// Import once, only the conversion is timed.
+		const aiScene* scene = aiImportFile(files[f].c_str(), aiProcess_Triangulate | aiProcess_PreTransformVertices);
+
+		if (scene == NULL) {
+
+			std::cerr << "Mesh benchmark error: could not import " << files[f] << "." << std::endl;
+			return 1;
+
+		}
+
+		size_t vertices = 0;
+
+		for (unsigned int i = 0; i < scene->mNumMeshes; i++)
+			vertices += scene->mMeshes[i]->mNumVertices;
+
+		std::vector<bgq_opengl::MeshData> legacy, bulk, parallel;
+
+		double legacy_ms = timeConversion(scene, runs, [scene](const aiMesh* mesh, bgq_opengl::MeshData* data) {
+			convertLegacy(scene, mesh, data);
+		}, &legacy);
+
+		double bulk_ms = timeConversion(scene, runs, [scene](const aiMesh* mesh, bgq_opengl::MeshData* data) {
+			bgq_opengl::MeshConverter::convert(scene, mesh, data);
+		}, &bulk);
+
+		double parallel_ms = timeConversion(scene, runs, [scene, &pool](const aiMesh* mesh, bgq_opengl::MeshData* data) {
+			bgq_opengl::MeshConverter::convert(scene, mesh, data, &pool);
+		}, &parallel);
+
+		bool file_same = sameMeshes(legacy, bulk) && sameMeshes(legacy, parallel);
+		same = same && file_same;
+
+		std::cout << files[f] << ": " << scene->mNumMeshes << " meshes, " << vertices << " vertices, best of " << runs << " runs" << std::endl;
+		std::cout << "  push_back:          " << legacy_ms << " ms" << std::endl;
+		std::cout << "  bulk:               " << bulk_ms << " ms, " << legacy_ms / bulk_ms << "x" << std::endl;
+		std::cout << "  bulk, " << threads << " threads: " << parallel_ms << " ms, " << legacy_ms / parallel_ms << "x" << std::endl;
+		std::cout << "  " << (file_same ? "same vertices and indices" : "DIFFERENT vertices or indices") << std::endl;
+
+		reportPacking(bulk);
+
+		aiReleaseImport(scene);
+
+	}
+
+	return same ? 0 : 1;
+
+}